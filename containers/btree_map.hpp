@@ -0,0 +1,304 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 11:37:02 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 11:37:02 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_MAP_HPP
+# define BTREE_MAP_HPP
+
+#include <memory>
+#include <cstddef>
+#include "./utils/btree.hpp"
+#include "./utils/btreeIte.hpp"
+#include "./utils/iterator.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: btree_map
+ */
+
+	/**
+	 * @brief btree map
+	 * @note (extension) a map (same interface, same order, unique keys) kept in a B+ tree (see ft::btree):
+	 * the elements are stored by the dozen in arrays of BTREE_NODE_BYTES, the leaves, linked in order.
+	 * a lookup goes down a handful of levels, each a search in one array (branch-free for arithmetic keys
+	 * compared with less), and a scan reads the leaves one after the other: both miss the cache far less
+	 * than the node per element of ft::map. a range sorted by key is loaded in O(n), into full leaves.
+	 *
+	 * the price: elements move between leaves when they split or merge, so insert and erase invalidate
+	 * every iterator, pointer and reference to the elements (erase returns the iterator to go on with).
+	 * there is no node handle, no split / join nor order statistics: use ft::map for those.
+	 *
+	 * @param Key: type of the keys (copy constructible, copied into the internal nodes).
+	 * @param T: type of the mapped values.
+	 * @param Compare: strict weak ordering on keys, see ft::map.
+	 * @param Alloc: type of the allocator object, rebound to the nodes.
+	 */
+	template < class Key,
+		class T,
+		class Compare = ft::less<Key>,
+		class Alloc = std::allocator< ft::pair<const Key, T> > >
+	class btree_map {
+		public:
+		/* member types */
+
+			typedef				Key													key_type;
+			typedef				T													mapped_type;
+			typedef				ft::pair<const key_type, mapped_type>				value_type;
+			typedef				Compare												key_compare;
+
+			/** @brief compares two elements by their keys, see map::value_compare */
+			class value_compare : public binary_function<value_type, value_type, bool> {
+				friend class btree_map;
+
+				protected:
+					key_compare comp;
+
+					value_compare(key_compare c) : comp(c) {}
+
+				public:
+					typedef bool 		result_type;
+					typedef value_type	first_argument_type;
+					typedef value_type	second_argument_type;
+
+					bool operator()(const value_type& x, const value_type& y) const {
+						return comp(x.first, y.first);
+					}
+			};
+
+			typedef				Alloc															allocator_type;
+			typedef	typename	allocator_type::reference										reference;
+			typedef	typename	allocator_type::const_reference									const_reference;
+			typedef	typename	allocator_type::pointer											pointer;
+			typedef	typename	allocator_type::const_pointer									const_pointer;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type									difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type										size_type;
+
+			typedef				ft::btree<key_type, value_type, ft::select_first<value_type>,
+									key_compare, allocator_type>								tree_type;
+
+			typedef typename	tree_type::iterator												iterator;
+			typedef typename	tree_type::const_iterator										const_iterator;
+			typedef				ft::reverse_iterator<iterator>									reverse_iterator;
+			typedef				ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			/** @brief constructor: default, an empty container */
+			explicit btree_map(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {}
+
+			/**
+			 * @brief constructor: range
+			 * @note the elements are appended while the range is sorted by key (bulk loading, O(n) and full leaves),
+			 * inserted otherwise.
+			 */
+			template <class InputIterator>
+			btree_map(InputIterator first, InputIterator last,
+				const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {
+					_tree.insert(first, last);
+			}
+
+			/** @brief constructor: copy, the nodes of x are cloned as they are in O(n) */
+			btree_map(const btree_map& x) : _tree(x._tree) {}
+
+			~btree_map(void) {}
+
+			btree_map& operator=(const btree_map& x) {
+				if (this == &x) return *this;
+
+				_tree = x._tree;
+				return *this;
+			}
+
+		/* member functions: iterators */
+
+			iterator begin() { return _tree.begin(); }
+			const_iterator begin() const { return _tree.begin(); }
+
+			iterator end() { return _tree.end(); }
+			const_iterator end() const { return _tree.end(); }
+
+			reverse_iterator rbegin() { return reverse_iterator(end()); }
+			const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+			reverse_iterator rend() { return reverse_iterator(begin()); }
+			const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+		/* member functions: capacity */
+
+			bool		empty() const { return _tree.empty(); }
+
+			size_type	size() const { return _tree.size(); }
+
+			size_type	max_size(void) const { return _tree.max_size(); }
+
+		/* member functions: element access */
+
+			/**
+			 * @brief access element
+			 * @note inserts a default constructed mapped value if k is absent: the reference is invalidated
+			 * by the next insertion or erasure.
+			 */
+			mapped_type& operator[](const key_type& k) {
+				iterator it = _tree.lower_bound(k);
+
+				// the mapped value is only built when k is absent
+				if (it == end() || key_comp()(k, it->first))
+					it = _tree.insert(it, value_type(k, mapped_type())).first;
+				return it->second;
+			}
+
+		/* member functions: modifiers */
+
+			/**
+			 * @brief insert elements
+			 * @note the hint is taken when the element goes right before it in its leaf, or after the last element
+			 * with end(): appending in key order is amortized O(1). see map::insert.
+			 */
+			ft::pair<iterator, bool> insert(const value_type& val) {
+				return _tree.insert(val);
+			}
+
+			iterator insert(iterator position, const value_type& val) {
+				return _tree.insert(position, val).first;
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last) {
+				_tree.insert(first, last);
+			}
+
+			/**
+			 * @brief erase elements
+			 * @note every iterator is invalidated, the ones returned point to the element which followed the erased ones.
+			 * the key-based version returns the number of elements erased.
+			 */
+			iterator erase(iterator position) {
+				return _tree.erase(position);
+			}
+
+			size_type erase(const key_type& k) {
+				return _tree.erase(k);
+			}
+
+			iterator erase(iterator first, iterator last) {
+				return _tree.erase(first, last);
+			}
+
+			void swap (btree_map& x) { _tree.swap(x._tree); }
+
+			void clear() { _tree.clear(); }
+
+		/* member functions: observers */
+
+			key_compare	key_comp() const { return _tree.getComp(); }
+
+			value_compare  value_comp() const { return value_compare(key_comp()); }
+
+		/* member functions: operations */
+
+			iterator find(const key_type& k) {
+				return _tree.find(k);
+			}
+
+			const_iterator find(const key_type& k) const {
+				return _tree.find(k);
+			}
+
+			size_type count(const key_type& k) const {
+				if (find(k) == end())
+					return 0;
+				return 1;
+			}
+
+			iterator lower_bound(const key_type& k) {
+				return _tree.lower_bound(k);
+			}
+
+			const_iterator lower_bound(const key_type& k) const {
+				return _tree.lower_bound(k);
+			}
+
+			iterator upper_bound(const key_type& k) {
+				return _tree.upper_bound(k);
+			}
+
+			const_iterator upper_bound(const key_type& k) const {
+				return _tree.upper_bound(k);
+			}
+
+			ft::pair<iterator, iterator> equal_range(const key_type& k) {
+				return ft::make_pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+			}
+
+			ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const {
+				return ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
+			}
+
+			/** @brief (extension) number of levels of the tree, 0 when empty */
+			size_type height() const { return _tree.height(); }
+
+		/* member functions: allocator */
+
+			allocator_type get_allocator() const { return _tree.get_allocator(); }
+
+		private:
+		/* attributes */
+
+			tree_type	_tree;
+	};
+
+	/* non-member function: btree_map */
+
+		/** @brief relational operators for btree_map, see map */
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator==(const ft::btree_map<Key, T, Compare, Allocator>& lhs,
+				const ft::btree_map<Key, T, Compare, Allocator>& rhs) {
+					if (lhs.size() != rhs.size())
+						return false;
+					return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+		}
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator!=(const btree_map<Key, T, Compare, Allocator>& lhs,
+				const btree_map<Key, T, Compare, Allocator>& rhs) { return !(lhs == rhs); }
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator< (const btree_map<Key, T, Compare, Allocator>& lhs,
+				const btree_map<Key, T, Compare, Allocator>& rhs) {
+					return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+		}
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator<=(const btree_map<Key, T, Compare, Allocator>& lhs,
+				const btree_map<Key, T, Compare, Allocator>& rhs) { return !(rhs < lhs); }
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator> (const btree_map<Key, T, Compare, Allocator>& lhs,
+				const btree_map<Key, T, Compare, Allocator>& rhs) { return rhs < lhs; }
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator>=(const btree_map<Key, T, Compare, Allocator>& lhs,
+				const btree_map<Key, T, Compare, Allocator>& rhs) { return !(lhs < rhs); }
+
+		template <class Key, class T, class Compare, class Allocator>
+		void swap(btree_map<Key, T, Compare, Allocator>& x,
+			btree_map<Key, T, Compare, Allocator>& y) { x.swap(y); }
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
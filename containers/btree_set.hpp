@@ -0,0 +1,251 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_set.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 11:52:18 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 11:52:18 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_SET_HPP
+# define BTREE_SET_HPP
+
+#include <memory>
+#include <cstddef>
+#include "./utils/btree.hpp"
+#include "./utils/btreeIte.hpp"
+#include "./utils/iterator.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: btree_set
+ */
+
+	/**
+	 * @brief btree set
+	 * @note (extension) a set kept in a B+ tree, see ft::btree_map: the same cache friendly lookups and scans,
+	 * O(n) loading of a sorted range, and the same price: insert and erase invalidate every iterator
+	 * and reference to the elements (erase returns the iterator to go on with).
+	 *
+	 * @param T: type of the elements (copy constructible, copied into the internal nodes).
+	 * @param Compare: strict weak ordering on elements, see ft::set.
+	 * @param Alloc: type of the allocator object, rebound to the nodes.
+	 */
+	template < class T,
+		class Compare = ft::less<T>,
+		class Alloc = std::allocator<T> >
+	class btree_set {
+		public:
+		/* member types */
+
+			typedef				T													key_type;
+			typedef				T													value_type;
+			typedef				Compare												key_compare;
+			typedef				Compare												value_compare;
+
+			typedef				Alloc															allocator_type;
+			typedef	typename	allocator_type::reference										reference;
+			typedef	typename	allocator_type::const_reference									const_reference;
+			typedef	typename	allocator_type::pointer											pointer;
+			typedef	typename	allocator_type::const_pointer									const_pointer;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type									difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type										size_type;
+
+			typedef				ft::btree<key_type, value_type, ft::identity<value_type>,
+									key_compare, allocator_type>								tree_type;
+
+			typedef typename	tree_type::const_iterator										iterator;
+			typedef typename	tree_type::const_iterator										const_iterator;
+			typedef				ft::reverse_iterator<iterator>									reverse_iterator;
+			typedef				ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			/** @brief constructor: default, an empty container */
+			explicit btree_set(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {}
+
+			/**
+			 * @brief constructor: range
+			 * @note the elements are appended while the range is sorted (bulk loading, O(n) and full leaves),
+			 * inserted otherwise.
+			 */
+			template <class InputIterator>
+			btree_set(InputIterator first, InputIterator last,
+				const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {
+					_tree.insert(first, last);
+			}
+
+			/** @brief constructor: copy, the nodes of x are cloned as they are in O(n) */
+			btree_set(const btree_set& x) : _tree(x._tree) {}
+
+			~btree_set(void) {}
+
+			btree_set& operator=(const btree_set& x) {
+				if (this == &x) return *this;
+
+				_tree = x._tree;
+				return *this;
+			}
+
+		/* member functions: iterators */
+
+			iterator begin() const { return _tree.begin(); }
+
+			iterator end() const { return _tree.end(); }
+
+			reverse_iterator rbegin() const { return reverse_iterator(end()); }
+
+			reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+		/* member functions: capacity */
+
+			bool		empty() const { return _tree.empty(); }
+
+			size_type	size() const { return _tree.size(); }
+
+			size_type	max_size(void) const { return _tree.max_size(); }
+
+		/* member functions: modifiers */
+
+			/**
+			 * @brief insert elements
+			 * @note the hint is taken when the element goes right before it in its leaf, or after the last element
+			 * with end(): appending in order is amortized O(1). see set::insert.
+			 */
+			ft::pair<iterator, bool> insert(const value_type& val) {
+				ft::pair<tree_iterator, bool> ret = _tree.insert(val);
+
+				return ft::make_pair<iterator, bool>(ret.first, ret.second);
+			}
+
+			iterator insert(iterator position, const value_type& val) {
+				return _tree.insert(toTree(position), val).first;
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last) {
+				_tree.insert(first, last);
+			}
+
+			/**
+			 * @brief erase elements
+			 * @note every iterator is invalidated, the ones returned point to the element which followed the erased ones.
+			 * the value-based version returns the number of elements erased.
+			 */
+			iterator erase(iterator position) {
+				return _tree.erase(toTree(position));
+			}
+
+			size_type erase(const value_type& val) {
+				return _tree.erase(val);
+			}
+
+			iterator erase(iterator first, iterator last) {
+				return _tree.erase(toTree(first), toTree(last));
+			}
+
+			void swap (btree_set& x) { _tree.swap(x._tree); }
+
+			void clear() { _tree.clear(); }
+
+		/* member functions: observers */
+
+			key_compare	key_comp() const { return _tree.getComp(); }
+
+			value_compare	value_comp() const { return _tree.getComp(); }
+
+		/* member functions: operations */
+
+			iterator find(const value_type& val) const {
+				return _tree.find(val);
+			}
+
+			size_type count(const value_type& val) const {
+				if (find(val) == end())
+					return 0;
+				return 1;
+			}
+
+			iterator lower_bound(const value_type& val) const {
+				return _tree.lower_bound(val);
+			}
+
+			iterator upper_bound(const value_type& val) const {
+				return _tree.upper_bound(val);
+			}
+
+			ft::pair<iterator, iterator> equal_range(const value_type& val) const {
+				return ft::make_pair<iterator, iterator>(lower_bound(val), upper_bound(val));
+			}
+
+			/** @brief (extension) number of levels of the tree, 0 when empty */
+			size_type height() const { return _tree.height(); }
+
+		/* member functions: allocator */
+
+			allocator_type get_allocator() const { return _tree.get_allocator(); }
+
+		private:
+		/* member types (private) */
+
+			typedef typename	tree_type::iterator												tree_iterator;
+
+		/* member functions (private) */
+
+			static tree_iterator	toTree(iterator it) { return tree_iterator(it.getLeaf(), it.getPos()); }
+
+		/* attributes */
+
+			tree_type	_tree;
+	};
+
+	/* non-member function: btree_set */
+
+		/** @brief relational operators for btree_set, see set */
+		template <class T, class Compare, class Alloc>
+		bool operator==(const ft::btree_set<T, Compare, Alloc>& lhs,
+				const ft::btree_set<T, Compare, Alloc>& rhs) {
+					if (lhs.size() != rhs.size())
+						return false;
+					return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+		}
+
+		template <class T, class Compare, class Alloc>
+		bool operator!=(const btree_set<T, Compare, Alloc>& lhs,
+				const btree_set<T, Compare, Alloc>& rhs) { return !(lhs == rhs); }
+
+		template <class T, class Compare, class Alloc>
+		bool operator< (const btree_set<T, Compare, Alloc>& lhs,
+				const btree_set<T, Compare, Alloc>& rhs) {
+					return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+		}
+
+		template <class T, class Compare, class Alloc>
+		bool operator<=(const btree_set<T, Compare, Alloc>& lhs,
+				const btree_set<T, Compare, Alloc>& rhs) { return !(rhs < lhs); }
+
+		template <class T, class Compare, class Alloc>
+		bool operator> (const btree_set<T, Compare, Alloc>& lhs,
+				const btree_set<T, Compare, Alloc>& rhs) { return rhs < lhs; }
+
+		template <class T, class Compare, class Alloc>
+		bool operator>=(const btree_set<T, Compare, Alloc>& lhs,
+				const btree_set<T, Compare, Alloc>& rhs) { return !(lhs < rhs); }
+
+		template <class T, class Compare, class Alloc>
+		void swap(btree_set<T, Compare, Alloc>& x,
+			btree_set<T, Compare, Alloc>& y) { x.swap(y); }
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
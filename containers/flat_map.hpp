@@ -0,0 +1,474 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 15:48:09 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 15:48:09 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_MAP_HPP
+# define FLAT_MAP_HPP
+
+#include <memory>
+#include <cstddef>
+#include "vector.hpp"
+#include "./utils/flatIte.hpp"
+#include "./utils/flatSort.hpp"
+#include "./utils/iterator.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: flat_map
+ */
+
+	/**
+	 * @brief flat map
+	 * @note (extension) a map (same interface, same order, unique keys) kept in two sorted ft::vector:
+	 * the keys in one, the mapped values in the other, at the same positions.
+	 * a lookup is a bisection of the keys array alone, no node nor pointer to follow and no mapped value
+	 * in the way of the cache: for read-mostly tables it beats ft::map on lookups, scans and memory.
+	 * the price is the one of a vector: an insertion or an erasure moves the elements after it (O(n)),
+	 * and invalidates iterators and references, like a reallocation does.
+	 * insert(first, last) sorts the range then merges it in one pass, O(n + m log m) for m elements,
+	 * where inserting them one by one would be O(m n).
+	 *
+	 * an element is not stored as a value_type: iterators dereference to a flatReference,
+	 * a pair of references to the key and to the mapped value (it converts to value_type).
+	 *
+	 * @param Key: type of the keys.
+	 * @param T: type of the mapped values.
+	 * @param Compare: strict weak ordering on keys, see ft::map.
+	 * @param Alloc: type of the allocator object, rebound to the keys and to the mapped values.
+	 */
+	template < class Key,
+		class T,
+		class Compare = ft::less<Key>,
+		class Alloc = std::allocator< ft::pair<const Key, T> > >
+	class flat_map {
+		public:
+		/* member types */
+
+			typedef				Key													key_type;
+			typedef				T													mapped_type;
+			typedef				ft::pair<const key_type, mapped_type>				value_type;
+			typedef				Compare												key_compare;
+
+			/** @brief compares two elements by their keys, see map::value_compare */
+			class value_compare : public binary_function<value_type, value_type, bool> {
+				friend class flat_map;
+
+				protected:
+					key_compare comp;
+
+					value_compare(key_compare c) : comp(c) {}
+
+				public:
+					typedef bool 		result_type;
+					typedef value_type	first_argument_type;
+					typedef value_type	second_argument_type;
+
+					bool operator()(const value_type& x, const value_type& y) const {
+						return comp(x.first, y.first);
+					}
+			};
+
+			typedef				Alloc															allocator_type;
+
+			typedef				ft::flatIterator<key_type, mapped_type, mapped_type>			iterator;
+			typedef				ft::flatIterator<key_type, mapped_type, const mapped_type>		const_iterator;
+			typedef				ft::reverse_iterator<iterator>									reverse_iterator;
+			typedef				ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+
+			/** @note proxies: an element is a key and a mapped value in two arrays (see ft::flatReference) */
+			typedef typename	iterator::reference												reference;
+			typedef typename	const_iterator::reference										const_reference;
+			typedef typename	iterator::pointer												pointer;
+			typedef typename	const_iterator::pointer											const_pointer;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type									difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type										size_type;
+
+			/** @note (extension) the arrays of the keys and of the mapped values */
+			typedef				ft::vector<key_type,
+									typename allocator_type::template rebind<key_type>::other>		key_container_type;
+			typedef				ft::vector<mapped_type,
+									typename allocator_type::template rebind<mapped_type>::other>	mapped_container_type;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			/** @brief constructor: default, an empty container */
+			explicit flat_map(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) :
+				_keys(typename key_container_type::allocator_type(alloc)),
+				_values(typename mapped_container_type::allocator_type(alloc)),
+				_comp(comp) {}
+
+			/**
+			 * @brief constructor: range
+			 * @note the range is sorted then copied, O(n log n) (see insert). of equivalent keys, the first one is kept.
+			 */
+			template <class InputIterator>
+			flat_map(InputIterator first, InputIterator last,
+				const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) :
+				_keys(typename key_container_type::allocator_type(alloc)),
+				_values(typename mapped_container_type::allocator_type(alloc)),
+				_comp(comp) {
+					insert(first, last);
+			}
+
+			flat_map(const flat_map& x) : _keys(x._keys), _values(x._values), _comp(x._comp) {}
+
+			~flat_map(void) {}
+
+			flat_map& operator=(const flat_map& x) {
+				if (this == &x) return *this;
+
+				_keys = x._keys;
+				_values = x._values;
+				_comp = x._comp;
+				return *this;
+			}
+
+		/* member functions: iterators */
+
+			iterator begin() { return position(0); }
+			const_iterator begin() const { return position(0); }
+
+			iterator end() { return position(size()); }
+			const_iterator end() const { return position(size()); }
+
+			reverse_iterator rbegin() { return reverse_iterator(end()); }
+			const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+			reverse_iterator rend() { return reverse_iterator(begin()); }
+			const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+		/* member functions: capacity */
+
+			bool		empty() const { return _keys.empty(); }
+
+			size_type	size() const { return _keys.size(); }
+
+			size_type	max_size(void) const {
+				return _keys.max_size() < _values.max_size() ? _keys.max_size() : _values.max_size();
+			}
+
+			/** @brief (extension) make room for n elements in both arrays, see vector::reserve */
+			void		reserve(size_type n) {
+				_keys.reserve(n);
+				_values.reserve(n);
+			}
+
+		/* member functions: element access */
+
+			/** @brief access element, inserting a default constructed mapped value if k is absent */
+			mapped_type& operator[](const key_type& k) {
+				size_type i = lowerIndex(k);
+
+				if (i == size() || _comp(k, _keys[i]))
+					insertAt(i, k, mapped_type());
+				return _values[i];
+			}
+
+		/* member functions: modifiers */
+
+			/**
+			 * @brief insert elements
+			 * @note the hint is taken when the element goes right before it, so appending in key order
+			 * with end() as the hint is amortized O(1). see map::insert.
+			 */
+			ft::pair<iterator, bool> insert(const value_type& val) {
+				size_type i = lowerIndex(val.first);
+
+				if (i != size() && _comp(val.first, _keys[i]) == false)
+					return ft::make_pair(position(i), false);
+				insertAt(i, val.first, val.second);
+				return ft::make_pair(position(i), true);
+			}
+
+			iterator insert(iterator hint, const value_type& val) {
+				size_type i = indexOf(hint);
+
+				if ((i == 0 || _comp(_keys[i - 1], val.first)) && (i == size() || _comp(val.first, _keys[i]))) {
+					insertAt(i, val.first, val.second);
+					return position(i);
+				}
+				return insert(val).first;
+			}
+
+			/**
+			 * @brief insert a range: sort and merge
+			 * @note the range is copied aside, its positions are sorted (ft::flat_sort, stable),
+			 * then the arrays are merged with it in one pass: O(n + m log m) for m elements.
+			 * keys already in the map, and the repeats of a key in the range, are left out.
+			 */
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last) {
+				key_container_type		keys(_keys.get_allocator());
+				mapped_container_type	values(_values.get_allocator());
+
+				for (; first != last; ++first) {
+					keys.push_back((*first).first);
+					values.push_back((*first).second);
+				}
+				mergeBatch(keys, values);
+			}
+
+			/**
+			 * @brief erase elements
+			 * @note the elements after the erased ones move back, every iterator after them is invalidated:
+			 * the ones returned point to the element which followed the erased ones.
+			 */
+			iterator erase(iterator position) {
+				size_type i = indexOf(position);
+
+				_keys.erase(_keys.begin() + i);
+				_values.erase(_values.begin() + i);
+				return this->position(i);
+			}
+
+			size_type erase(const key_type& k) {
+				iterator it = find(k);
+
+				if (it == end())
+					return 0;
+				erase(it);
+				return 1;
+			}
+
+			iterator erase(iterator first, iterator last) {
+				size_type i = indexOf(first);
+				size_type j = indexOf(last);
+
+				_keys.erase(_keys.begin() + i, _keys.begin() + j);
+				_values.erase(_values.begin() + i, _values.begin() + j);
+				return position(i);
+			}
+
+			void swap (flat_map& x) {
+				key_compare tmp = _comp;
+
+				_keys.swap(x._keys);
+				_values.swap(x._values);
+				_comp = x._comp;
+				x._comp = tmp;
+			}
+
+			void clear() {
+				_keys.clear();
+				_values.clear();
+			}
+
+		/* member functions: observers */
+
+			key_compare	key_comp() const { return _comp; }
+
+			value_compare  value_comp() const { return value_compare(_comp); }
+
+			/** @brief (extension) the sorted keys, and the mapped values at the same positions */
+			key_container_type const &		keys() const { return _keys; }
+
+			mapped_container_type const &	values() const { return _values; }
+
+		/* member functions: operations */
+
+			iterator find(const key_type& k) {
+				return position(findIndex(k));
+			}
+
+			const_iterator find(const key_type& k) const {
+				return position(findIndex(k));
+			}
+
+			size_type count(const key_type& k) const {
+				if (findIndex(k) == size())
+					return 0;
+				return 1;
+			}
+
+			iterator lower_bound(const key_type& k) {
+				return position(lowerIndex(k));
+			}
+
+			const_iterator lower_bound(const key_type& k) const {
+				return position(lowerIndex(k));
+			}
+
+			iterator upper_bound(const key_type& k) {
+				return position(ft::flat_upper_bound(keyData(), size(), k, _comp));
+			}
+
+			const_iterator upper_bound(const key_type& k) const {
+				return position(ft::flat_upper_bound(keyData(), size(), k, _comp));
+			}
+
+			ft::pair<iterator, iterator> equal_range(const key_type& k) {
+				return ft::make_pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+			}
+
+			ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const {
+				return ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
+			}
+
+		/* member functions: allocator */
+
+			allocator_type get_allocator() const { return allocator_type(_keys.get_allocator()); }
+
+		private:
+		/* member types (private) */
+
+			typedef				ft::vector<size_t,
+									typename allocator_type::template rebind<size_t>::other>		order_type;
+
+		/* member functions (private) */
+
+			const key_type *	keyData() const { return _keys.begin().base(); }
+
+			iterator		position(size_type i) { return iterator(_keys.begin().base() + i, _values.begin().base() + i); }
+
+			const_iterator	position(size_type i) const { return const_iterator(_keys.begin().base() + i, _values.begin().base() + i); }
+
+			size_type		indexOf(const_iterator it) const { return it.keyBase() - keyData(); }
+
+			size_type		lowerIndex(const key_type& k) const { return ft::flat_lower_bound(keyData(), size(), k, _comp); }
+
+			/** @return the position of k, size() if it is absent */
+			size_type		findIndex(const key_type& k) const {
+				size_type i = lowerIndex(k);
+
+				if (i == size() || _comp(k, _keys[i]))
+					return size();
+				return i;
+			}
+
+			/** @note the key is taken back if the mapped value cannot be inserted: the arrays stay the same size */
+			void	insertAt(size_type i, const key_type& k, const mapped_type& v) {
+				_keys.insert(_keys.begin() + i, k);
+				try {
+					_values.insert(_values.begin() + i, v);
+				}
+				catch (...) {
+					_keys.erase(_keys.begin() + i);
+					throw;
+				}
+			}
+
+			/**
+			 * @brief merge unsorted keys and mapped values into the map
+			 * @note a batch going after every key is appended in place, otherwise both arrays are rebuilt
+			 * and swapped in at the end: if a copy throws, the map is left as it was.
+			 */
+			void	mergeBatch(key_container_type const & keys, mapped_container_type const & values) {
+				size_type	m = keys.size();
+
+				if (m == 0)
+					return ;
+
+				order_type	order(m);
+				order_type	buffer(m);
+				size_t		*sorted = ft::flat_sort(keys.begin().base(), m, _comp, order.begin().base(), buffer.begin().base());
+				size_type	n = size();
+
+				if (n == 0 || _comp(_keys[n - 1], keys[sorted[0]])) {
+					reserve(n + m);
+					try {
+						for (size_type j = 0; j < m; ++j) {
+							if (j == 0 || _comp(keys[sorted[j - 1]], keys[sorted[j]])) {
+								_keys.push_back(keys[sorted[j]]);
+								_values.push_back(values[sorted[j]]);
+							}
+						}
+					}
+					catch (...) {
+						_keys.erase(_keys.begin() + n, _keys.end());
+						_values.erase(_values.begin() + n, _values.end());
+						throw;
+					}
+					return ;
+				}
+
+				key_container_type		mergedKeys(_keys.get_allocator());
+				mapped_container_type	mergedValues(_values.get_allocator());
+				size_type				i = 0;
+
+				mergedKeys.reserve(n + m);
+				mergedValues.reserve(n + m);
+				for (size_type j = 0; j < m; ++j) {
+					const key_type & k = keys[sorted[j]];
+
+					// the sort is stable: the first of equivalent keys in the range comes first
+					if (j != 0 && _comp(keys[sorted[j - 1]], k) == false)
+						continue;
+					for (; i < n && _comp(_keys[i], k); ++i) {
+						mergedKeys.push_back(_keys[i]);
+						mergedValues.push_back(_values[i]);
+					}
+					if (i < n && _comp(k, _keys[i]) == false)
+						continue;
+					mergedKeys.push_back(k);
+					mergedValues.push_back(values[sorted[j]]);
+				}
+				for (; i < n; ++i) {
+					mergedKeys.push_back(_keys[i]);
+					mergedValues.push_back(_values[i]);
+				}
+				_keys.swap(mergedKeys);
+				_values.swap(mergedValues);
+			}
+
+		/* attributes */
+
+			key_container_type		_keys;
+			mapped_container_type	_values;
+			key_compare				_comp;
+	};
+
+	/* non-member function: flat_map */
+
+		/** @brief relational operators for flat_map, see map */
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator==(const ft::flat_map<Key, T, Compare, Allocator>& lhs,
+				const ft::flat_map<Key, T, Compare, Allocator>& rhs) {
+					if (lhs.size() != rhs.size())
+						return false;
+					return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+		}
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator!=(const flat_map<Key, T, Compare, Allocator>& lhs,
+				const flat_map<Key, T, Compare, Allocator>& rhs) { return !(lhs == rhs); }
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator< (const flat_map<Key, T, Compare, Allocator>& lhs,
+				const flat_map<Key, T, Compare, Allocator>& rhs) {
+					return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+		}
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator<=(const flat_map<Key, T, Compare, Allocator>& lhs,
+				const flat_map<Key, T, Compare, Allocator>& rhs) { return !(rhs < lhs); }
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator> (const flat_map<Key, T, Compare, Allocator>& lhs,
+				const flat_map<Key, T, Compare, Allocator>& rhs) { return rhs < lhs; }
+
+		template <class Key, class T, class Compare, class Allocator>
+		bool operator>=(const flat_map<Key, T, Compare, Allocator>& lhs,
+				const flat_map<Key, T, Compare, Allocator>& rhs) { return !(lhs < rhs); }
+
+		template <class Key, class T, class Compare, class Allocator>
+		void swap(flat_map<Key, T, Compare, Allocator>& x,
+			flat_map<Key, T, Compare, Allocator>& y) { x.swap(y); }
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
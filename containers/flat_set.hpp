@@ -0,0 +1,334 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_set.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 16:31:56 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 16:31:56 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_SET_HPP
+# define FLAT_SET_HPP
+
+#include <memory>
+#include <cstddef>
+#include "vector.hpp"
+#include "./utils/flatSort.hpp"
+#include "./utils/iterator.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: flat_set
+ */
+
+	/**
+	 * @brief flat set
+	 * @note (extension) a set (same interface, same order, unique elements) kept in one sorted ft::vector,
+	 * see ft::flat_map: lookups bisect a contiguous array, insertions and erasures move the elements after them
+	 * and invalidate iterators and references. insert(first, last) sorts the range and merges it in one pass.
+	 *
+	 * @param T: type of the elements.
+	 * @param Compare: strict weak ordering on elements, see ft::set.
+	 * @param Alloc: type of the allocator object.
+	 */
+	template < class T,
+		class Compare = ft::less<T>,
+		class Alloc = std::allocator<T> >
+	class flat_set {
+		public:
+		/* member types */
+
+			typedef				T													key_type;
+			typedef				T													value_type;
+			typedef				Compare												key_compare;
+			typedef				Compare												value_compare;
+
+			typedef				Alloc															allocator_type;
+			typedef	typename	allocator_type::reference										reference;
+			typedef	typename	allocator_type::const_reference									const_reference;
+			typedef	typename	allocator_type::pointer											pointer;
+			typedef	typename	allocator_type::const_pointer									const_pointer;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type									difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type										size_type;
+
+			/** @note (extension) the array of the elements */
+			typedef				ft::vector<value_type, allocator_type>							container_type;
+
+			typedef typename	container_type::const_iterator									iterator;
+			typedef typename	container_type::const_iterator									const_iterator;
+			typedef				ft::reverse_iterator<iterator>									reverse_iterator;
+			typedef				ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			/** @brief constructor: default, an empty container */
+			explicit flat_set(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _values(alloc), _comp(comp) {}
+
+			/**
+			 * @brief constructor: range
+			 * @note the range is sorted then copied, O(n log n) (see insert). of equivalent elements, the first one is kept.
+			 */
+			template <class InputIterator>
+			flat_set(InputIterator first, InputIterator last,
+				const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _values(alloc), _comp(comp) {
+					insert(first, last);
+			}
+
+			flat_set(const flat_set& x) : _values(x._values), _comp(x._comp) {}
+
+			~flat_set(void) {}
+
+			flat_set& operator=(const flat_set& x) {
+				if (this == &x) return *this;
+
+				_values = x._values;
+				_comp = x._comp;
+				return *this;
+			}
+
+		/* member functions: iterators */
+
+			iterator begin() const { return _values.begin(); }
+
+			iterator end() const { return _values.end(); }
+
+			reverse_iterator rbegin() const { return reverse_iterator(end()); }
+
+			reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+		/* member functions: capacity */
+
+			bool		empty() const { return _values.empty(); }
+
+			size_type	size() const { return _values.size(); }
+
+			size_type	max_size(void) const { return _values.max_size(); }
+
+			/** @brief (extension) make room for n elements, see vector::reserve */
+			void		reserve(size_type n) { _values.reserve(n); }
+
+		/* member functions: modifiers */
+
+			/**
+			 * @brief insert elements
+			 * @note the hint is taken when the element goes right before it, so appending in order
+			 * with end() as the hint is amortized O(1). see set::insert.
+			 */
+			ft::pair<iterator, bool> insert(const value_type& val) {
+				size_type i = lowerIndex(val);
+
+				if (i != size() && _comp(val, _values[i]) == false)
+					return ft::make_pair(begin() + i, false);
+				_values.insert(_values.begin() + i, val);
+				return ft::make_pair(begin() + i, true);
+			}
+
+			iterator insert(iterator hint, const value_type& val) {
+				size_type i = hint - begin();
+
+				if ((i == 0 || _comp(_values[i - 1], val)) && (i == size() || _comp(val, _values[i]))) {
+					_values.insert(_values.begin() + i, val);
+					return begin() + i;
+				}
+				return insert(val).first;
+			}
+
+			/** @brief insert a range: sort and merge, see flat_map::insert */
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last) {
+				container_type values(_values.get_allocator());
+
+				for (; first != last; ++first)
+					values.push_back(*first);
+				mergeBatch(values);
+			}
+
+			/**
+			 * @brief erase elements
+			 * @note the elements after the erased ones move back, every iterator after them is invalidated:
+			 * the ones returned point to the element which followed the erased ones.
+			 */
+			iterator erase(iterator position) {
+				size_type i = position - begin();
+
+				_values.erase(_values.begin() + i);
+				return begin() + i;
+			}
+
+			size_type erase(const value_type& val) {
+				iterator it = find(val);
+
+				if (it == end())
+					return 0;
+				erase(it);
+				return 1;
+			}
+
+			iterator erase(iterator first, iterator last) {
+				size_type i = first - begin();
+
+				_values.erase(_values.begin() + i, _values.begin() + (last - begin()));
+				return begin() + i;
+			}
+
+			void swap (flat_set& x) {
+				key_compare tmp = _comp;
+
+				_values.swap(x._values);
+				_comp = x._comp;
+				x._comp = tmp;
+			}
+
+			void clear() { _values.clear(); }
+
+		/* member functions: observers */
+
+			key_compare	key_comp() const { return _comp; }
+
+			value_compare	value_comp() const { return _comp; }
+
+			/** @brief (extension) the sorted elements */
+			container_type const &	values() const { return _values; }
+
+		/* member functions: operations */
+
+			iterator find(const value_type& val) const {
+				size_type i = lowerIndex(val);
+
+				if (i == size() || _comp(val, _values[i]))
+					return end();
+				return begin() + i;
+			}
+
+			size_type count(const value_type& val) const {
+				if (find(val) == end())
+					return 0;
+				return 1;
+			}
+
+			iterator lower_bound(const value_type& val) const {
+				return begin() + lowerIndex(val);
+			}
+
+			iterator upper_bound(const value_type& val) const {
+				return begin() + ft::flat_upper_bound(data(), size(), val, _comp);
+			}
+
+			ft::pair<iterator, iterator> equal_range(const value_type& val) const {
+				return ft::make_pair<iterator, iterator>(lower_bound(val), upper_bound(val));
+			}
+
+		/* member functions: allocator */
+
+			allocator_type get_allocator() const { return _values.get_allocator(); }
+
+		private:
+		/* member types (private) */
+
+			typedef				ft::vector<size_t,
+									typename allocator_type::template rebind<size_t>::other>		order_type;
+
+		/* member functions (private) */
+
+			const value_type *	data() const { return _values.begin().base(); }
+
+			size_type	lowerIndex(const value_type& val) const { return ft::flat_lower_bound(data(), size(), val, _comp); }
+
+			/** @brief merge unsorted elements into the set, see flat_map::mergeBatch */
+			void	mergeBatch(container_type const & values) {
+				size_type	m = values.size();
+
+				if (m == 0)
+					return ;
+
+				order_type	order(m);
+				order_type	buffer(m);
+				size_t		*sorted = ft::flat_sort(values.begin().base(), m, _comp, order.begin().base(), buffer.begin().base());
+				size_type	n = size();
+
+				if (n == 0 || _comp(_values[n - 1], values[sorted[0]])) {
+					_values.reserve(n + m);
+					try {
+						for (size_type j = 0; j < m; ++j) {
+							if (j == 0 || _comp(values[sorted[j - 1]], values[sorted[j]]))
+								_values.push_back(values[sorted[j]]);
+						}
+					}
+					catch (...) {
+						_values.erase(_values.begin() + n, _values.end());
+						throw;
+					}
+					return ;
+				}
+
+				container_type	merged(_values.get_allocator());
+				size_type		i = 0;
+
+				merged.reserve(n + m);
+				for (size_type j = 0; j < m; ++j) {
+					const value_type & val = values[sorted[j]];
+
+					// the sort is stable: the first of equivalent elements in the range comes first
+					if (j != 0 && _comp(values[sorted[j - 1]], val) == false)
+						continue;
+					for (; i < n && _comp(_values[i], val); ++i)
+						merged.push_back(_values[i]);
+					if (i < n && _comp(val, _values[i]) == false)
+						continue;
+					merged.push_back(val);
+				}
+				for (; i < n; ++i)
+					merged.push_back(_values[i]);
+				_values.swap(merged);
+			}
+
+		/* attributes */
+
+			container_type	_values;
+			key_compare		_comp;
+	};
+
+	/* non-member function: flat_set */
+
+		/** @brief relational operators for flat_set, see set */
+		template <class T, class Compare, class Alloc>
+		bool operator==(const ft::flat_set<T, Compare, Alloc>& lhs,
+				const ft::flat_set<T, Compare, Alloc>& rhs) { return lhs.values() == rhs.values(); }
+
+		template <class T, class Compare, class Alloc>
+		bool operator!=(const flat_set<T, Compare, Alloc>& lhs,
+				const flat_set<T, Compare, Alloc>& rhs) { return !(lhs == rhs); }
+
+		template <class T, class Compare, class Alloc>
+		bool operator< (const flat_set<T, Compare, Alloc>& lhs,
+				const flat_set<T, Compare, Alloc>& rhs) { return lhs.values() < rhs.values(); }
+
+		template <class T, class Compare, class Alloc>
+		bool operator<=(const flat_set<T, Compare, Alloc>& lhs,
+				const flat_set<T, Compare, Alloc>& rhs) { return !(rhs < lhs); }
+
+		template <class T, class Compare, class Alloc>
+		bool operator> (const flat_set<T, Compare, Alloc>& lhs,
+				const flat_set<T, Compare, Alloc>& rhs) { return rhs < lhs; }
+
+		template <class T, class Compare, class Alloc>
+		bool operator>=(const flat_set<T, Compare, Alloc>& lhs,
+				const flat_set<T, Compare, Alloc>& rhs) { return !(lhs < rhs); }
+
+		template <class T, class Compare, class Alloc>
+		void swap(flat_set<T, Compare, Alloc>& x,
+			flat_set<T, Compare, Alloc>& y) { x.swap(y); }
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
@@ -0,0 +1,265 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   interval_map.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 16:21:09 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 16:21:09 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INTERVAL_MAP_HPP
+# define INTERVAL_MAP_HPP
+
+#include "map.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: interval_less / interval_max_end
+ */
+
+	/**
+	 * @brief order of the intervals of an interval_map: by start, then by end
+	 *
+	 * @param Bound: type of the bounds of the intervals.
+	 * @param Compare: strict weak ordering on Bound.
+	 */
+	template < class Bound, class Compare >
+	struct interval_less : binary_function<ft::pair<Bound, Bound>, ft::pair<Bound, Bound>, bool> {
+	/* attributes */
+
+		Compare	comp;
+
+	/* member functions */
+
+		interval_less(Compare const & c = Compare()) : comp(c) {}
+
+		bool operator() (ft::pair<Bound, Bound> const & x, ft::pair<Bound, Bound> const & y) const {
+			if (comp(x.first, y.first))
+				return true;
+			if (comp(y.first, x.first))
+				return false;
+			return comp(x.second, y.second);
+		}
+	};
+
+	/**
+	 * @brief summary of the intervals of a subtree: the greatest end
+	 * @note the monoid (see RBT_AugmentedNodeBase) of an interval_map, first is false for no interval at all.
+	 * Policy functions are static: the ends are compared with a default constructed Compare.
+	 */
+	template < class Bound, class T, class Compare >
+	struct interval_max_end {
+	/* member types */
+
+		typedef ft::pair<bool, Bound>	summary_type;
+
+	/* member functions */
+
+		static summary_type	identity(void) { return summary_type(false, Bound()); }
+
+		static summary_type	summarize(ft::pair<const ft::pair<Bound, Bound>, T> const & val) {
+			return summary_type(true, val.first.second);
+		}
+
+		static summary_type	combine(summary_type const & x, summary_type const & y) {
+			if (x.first == false)
+				return y;
+			if (y.first == false)
+				return x;
+			return Compare()(x.second, y.second) ? y : x;
+		}
+	};
+
+/**
+ * @class template: interval_map
+ */
+
+	/**
+	 * @brief interval map
+	 * @note a map whose keys are half-open intervals [first, second) of Bound, ordered by start then end,
+	 * which finds the intervals overlapping a range or containing a point.
+	 * it is a basic_map augmented with the greatest end of every subtree (ft::RBT_AugmentedNodeBase, interval_max_end):
+	 * a subtree ending before the range searched is skipped, so the first overlap is found in O(log n)
+	 * and the k overlaps in O(k log n) at most. the whole interface of map is available as is.
+	 * an interval is a key like another: inserting an interval already in the map does nothing.
+	 *
+	 * @param Bound: type of the bounds of the intervals (default constructible).
+	 * @param T: type of the mapped values.
+	 * @param Compare: strict weak ordering on Bound, stateless for the summaries (default constructed).
+	 * @param Alloc: type of the allocator object, as for map.
+	 */
+	template < class Bound,
+		class T,
+		class Compare = ft::less<Bound>,
+		class Alloc = std::allocator< ft::pair<const ft::pair<Bound, Bound>, T> > >
+	class interval_map : public ft::basic_map<ft::pair<Bound, Bound>, T, ft::interval_less<Bound, Compare>, Alloc,
+		ft::RBT_RedBlack, ft::RBT_AugmentedNodeBase<ft::interval_max_end<Bound, T, Compare> > > {
+		public:
+		/* member types */
+
+			typedef				ft::basic_map<ft::pair<Bound, Bound>, T, ft::interval_less<Bound, Compare>, Alloc,
+									ft::RBT_RedBlack, ft::RBT_AugmentedNodeBase<ft::interval_max_end<Bound, T, Compare> > >	map_type;
+
+			typedef				Bound														bound_type;
+			typedef				Compare														bound_compare;
+			typedef typename	map_type::key_type											key_type;
+			typedef typename	map_type::mapped_type										mapped_type;
+			typedef typename	map_type::value_type										value_type;
+			typedef typename	map_type::key_compare										key_compare;
+			typedef typename	map_type::allocator_type									allocator_type;
+			typedef typename	map_type::size_type											size_type;
+			typedef typename	map_type::iterator											iterator;
+			typedef typename	map_type::const_iterator									const_iterator;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			explicit interval_map(const bound_compare& comp = bound_compare(),
+				const allocator_type& alloc = allocator_type()) : map_type(key_compare(comp), alloc) {}
+
+			template <class InputIterator>
+			interval_map(InputIterator first, InputIterator last, const bound_compare& comp = bound_compare(),
+				const allocator_type& alloc = allocator_type()) : map_type(first, last, key_compare(comp), alloc) {}
+
+			interval_map(const interval_map& x) : map_type(x) {}
+
+			~interval_map() {}
+
+			interval_map& operator= (const interval_map& x) {
+				map_type::operator=(x);
+				return *this;
+			}
+
+		/* member functions: interval queries */
+
+			/**
+			 * @brief find the first interval overlapping a range
+			 * @note an interval [start, end) overlaps [lo, hi) if start goes before hi and lo before end.
+			 * O(log n): the descent leaves the subtrees whose greatest end does not go after lo.
+			 *
+			 * @param lo, hi: bounds of the range [lo, hi).
+			 * @return an iterator to the first overlapping interval in key order, or interval_map::end if none.
+			 */
+			iterator find_overlap(const bound_type& lo, const bound_type& hi) {
+				return toIterator(firstMatch(this->_rbt.getRoot(), lo, hi, false));
+			}
+
+			const_iterator find_overlap(const bound_type& lo, const bound_type& hi) const {
+				return toIterator(firstMatch(this->_rbt.getRoot(), lo, hi, false));
+			}
+
+			/**
+			 * @brief find every interval overlapping a range, or containing a point
+			 * @note the intervals are written in key order, as iterators.
+			 * an interval [start, end) contains point if start does not go after point and point goes before end.
+			 *
+			 * @param lo, hi: bounds of the range [lo, hi).
+			 * @param point: point to search for.
+			 * @param out: output iterator to write the iterators to.
+			 * @return out, past the last iterator written.
+			 */
+			template < class OutputIterator >
+			OutputIterator find_overlaps(const bound_type& lo, const bound_type& hi, OutputIterator out) {
+				collect<iterator>(this->_rbt.getRoot(), lo, hi, false, out);
+				return out;
+			}
+
+			template < class OutputIterator >
+			OutputIterator find_overlaps(const bound_type& lo, const bound_type& hi, OutputIterator out) const {
+				collect<const_iterator>(this->_rbt.getRoot(), lo, hi, false, out);
+				return out;
+			}
+
+			template < class OutputIterator >
+			OutputIterator find_containing(const bound_type& point, OutputIterator out) {
+				collect<iterator>(this->_rbt.getRoot(), point, point, true, out);
+				return out;
+			}
+
+			template < class OutputIterator >
+			OutputIterator find_containing(const bound_type& point, OutputIterator out) const {
+				collect<const_iterator>(this->_rbt.getRoot(), point, point, true, out);
+				return out;
+			}
+
+			/** @brief number of intervals overlapping [lo, hi) */
+			size_type count_overlaps(const bound_type& lo, const bound_type& hi) const {
+				size_type	n = 0;
+				counter		out(n);
+
+				collect<const_iterator>(this->_rbt.getRoot(), lo, hi, false, out);
+				return n;
+			}
+
+		private:
+		/* member types (private) */
+
+			typedef typename	map_type::tree_type											tree_type;
+			typedef typename	map_type::node_pointer										node_pointer;
+			typedef typename	tree_type::node_base										node_base;
+
+			/** @note output iterator counting what is written to it */
+			struct counter {
+				size_type	*n;
+
+				counter(size_type & count) : n(&count) {}
+				counter &	operator*(void) { return *this; }
+				counter &	operator++(void) { return *this; }
+				counter &	operator++(int) { return *this; }
+				counter &	operator=(const_iterator const &) { ++*n; return *this; }
+			};
+
+		/* member functions (private) */
+
+			iterator	toIterator(node_pointer node) const {
+				return iterator(node == ft_nullptr ? this->_rbt.getHeader() : node);
+			}
+
+			static key_type const &	keyOf(node_pointer node) { return tree_type::valueOf(node).first; }
+
+			/** @note the intervals of the subtree all end before lo (or with it): none can overlap */
+			bool	endsBefore(node_pointer node, const bound_type& lo) const {
+				return this->key_comp().comp(lo, node_base::summaryOf(node).second) == false;
+			}
+
+			/** @note start goes before hi, or does not go after it for a point (closed) */
+			bool	startsBefore(node_pointer node, const bound_type& hi, bool closed) const {
+				if (closed)
+					return this->key_comp().comp(hi, keyOf(node).first) == false;
+				return this->key_comp().comp(keyOf(node).first, hi);
+			}
+
+			node_pointer	firstMatch(node_pointer node, const bound_type& lo, const bound_type& hi, bool closed) const {
+				while (node != ft_nullptr && endsBefore(node, lo) == false) {
+					// a left subtree reaching after lo without an overlap only holds intervals starting after hi
+					if (node->left() != ft_nullptr && endsBefore(node->left(), lo) == false)
+						return firstMatch(node->left(), lo, hi, closed);
+					if (startsBefore(node, hi, closed) == false)
+						return ft_nullptr;
+					if (this->key_comp().comp(lo, keyOf(node).second))
+						return node;
+					node = node->right();
+				}
+				return ft_nullptr;
+			}
+
+			template < class Iterator, class OutputIterator >
+			void	collect(node_pointer node, const bound_type& lo, const bound_type& hi, bool closed, OutputIterator & out) const {
+				while (node != ft_nullptr && endsBefore(node, lo) == false) {
+					collect<Iterator>(node->left(), lo, hi, closed, out);
+					if (startsBefore(node, hi, closed) == false)
+						return ;
+					if (this->key_comp().comp(lo, keyOf(node).second))
+						*out++ = Iterator(node);
+					node = node->right();
+				}
+			}
+	};
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
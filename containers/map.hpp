@@ -18,15 +18,16 @@
 #include <exception>
 #include "./utils/RBT.hpp"
 #include "./utils/treeIte.hpp"
+#include "./utils/nodeHandle.hpp"
 
 _BEGIN_NS_FT
 
 /**
- * @class template: map
+ * @class template: basic_map
  */
 
 	/**
-	 * @brief map
+	 * @brief map with a choice of balancing
 	 * @note maps are associative containers that store elements formed by a combination of a key value and a mapped value,
 	 * following a specific order.
 	 * 
@@ -55,12 +56,29 @@ _BEGIN_NS_FT
 	 * This defaults to less<T>, which returns the same as applying the less-than operator (a<b).
 	 * @param Alloc: type of the allocator object used to define the storage allocation model.
 	 * by default, the allocator class template is used, which defines the simplest memory allocation model and is value-independent.
+	 * @param Balance: (extension) balancing policy of the tree: ft::RBT_RedBlack (the default, see ft::map),
+	 * ft::RBT_AVL (at most 1.44 log n deep, for more rotations on insertion / deletion),
+	 * ft::RBT_WeightBalanced (balanced on the sizes of the subtrees, kept in the nodes:
+	 * the order statistics come along) or ft::RBT_Splay (self-adjusting: the keys looked up often stay near the root).
+	 * @param Augment: (extension) what every node keeps about its subtree: ft::RBT_NodeBase (nothing, the default),
+	 * ft::RBT_SizedNodeBase (its size: nth(), rank(), count_range() and ft::distance in O(log n),
+	 * for one more word per node and O(log n) updates on the path to the root at each insertion / deletion)
+	 * or ft::RBT_AugmentedNodeBase<Policy> (its summary, folded with the monoid of Policy: see aggregate()).
+	 * @param Storage: (extension) where the nodes live: ft::RBT_NodeStorage (nodes linked by pointers, the default)
+	 * or ft::RBT_IndexStorage (one array linked by 32-bit indices, red black balancing without augmentation only):
+	 * the container holds at most 2^30 - 1 elements (INDEX_POOL_MAX_CAPACITY), and an insertion invalidates
+	 * every iterator and reference, like a vector that grows, unless reserve() made room first.
+	 * nodes cannot leave the array: merge() and set_union() copy the elements instead of relinking them,
+	 * and the node handles (extract(), insert(node_type)) need ft::RBT_NodeStorage (a compile error otherwise).
 	 */
 	template < class Key,
 		class T,
 		class Compare = ft::less<Key>,
-		class Alloc = std::allocator< ft::pair<const Key, T> > >
-	class map {
+		class Alloc = std::allocator< ft::pair<const Key, T> >,
+		class Balance = ft::RBT_RedBlack,
+		class Augment = ft::RBT_NodeBase,
+		class Storage = ft::RBT_NodeStorage >
+	class basic_map {
 		public:
 		/* member types */
 
@@ -77,7 +95,7 @@ _BEGIN_NS_FT
 			 * @return the comparison object for element values.
 			 */
 			class value_compare : public binary_function<value_type, value_type, bool> {
-				friend class map;
+				friend class basic_map;
 		
 				protected:
 					key_compare comp;
@@ -105,11 +123,27 @@ _BEGIN_NS_FT
 			/** @note usually the same as size_t */
 			typedef	typename	allocator_type::size_type										size_type;
 
-			typedef				ft::treeIterator<value_type, ft::RBT_Node<value_type> >			iterator;
-			typedef				ft::treeIterator<const value_type, ft::RBT_Node<value_type> >	const_iterator;
+			typedef				ft::treeIterator<value_type, typename ft::RBT_node_of<value_type, Balance, Augment, Storage>::type >		iterator;
+			typedef				ft::treeIterator<const value_type, typename ft::RBT_node_of<value_type, Balance, Augment, Storage>::type >	const_iterator;
 			typedef				ft::reverse_iterator<iterator>									reverse_iterator;
 			typedef				ft::reverse_iterator<const_iterator>							const_reverse_iterator;
 
+			/** @note (extension) summary of a range of elements, see aggregate() (void unless Augment is ft::RBT_AugmentedNodeBase) */
+			typedef typename	ft::RBT_node_of<value_type, Balance, Augment, Storage>::type::base_type::summary_type			summary_type;
+
+			/** @note (extension) node handle returned by extract(), see ft::nodeHandle */
+			typedef				ft::mapNodeHandle<key_type, mapped_type,
+									typename ft::RBT_node_of<value_type, Balance, Augment, Storage>::type, allocator_type>	node_type;
+
+			/** @brief result of insert(node_type): where the key is, whether the node went in, and the node if not */
+			struct insert_return_type {
+				iterator	position;
+				bool		inserted;
+				node_type	node;
+
+				insert_return_type(iterator p, bool i, node_type const & n) : position(p), inserted(i), node(n) {}
+			};
+
 		public:
 		/* member functions: constructor / destructor / operator= */
 
@@ -122,8 +156,8 @@ _BEGIN_NS_FT
 			 * and false otherwise.
 			 * @param alloc: allocator object.
 			 */
-			explicit map(const key_compare& comp = key_compare(),
-				const allocator_type& alloc = allocator_type()) : _rbt(value_compare(comp)) { (void)alloc; }
+			explicit basic_map(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _rbt(comp, node_allocator(alloc)) {}
 		
 			/**
 			 * @brief constructor: range
@@ -134,46 +168,40 @@ _BEGIN_NS_FT
 			 * @param alloc: allocator object.
 			 */
 			template <class InputIterator>
-			map(InputIterator first, InputIterator last,
+			basic_map(InputIterator first, InputIterator last,
 				const key_compare& comp = key_compare(),
-				const allocator_type& alloc = allocator_type()) : _rbt(value_compare(comp)) {
-					(void)alloc;
-					insert(first, last);
+				const allocator_type& alloc = allocator_type()) : _rbt(comp, node_allocator(alloc)) {
+					_rbt.build(first, last);
 			}
 
 			/**
 			 * @brief constructor: copy
 			 * @note constructs a container with a copy of each of the elements in x.
+			 * the tree of x (shape and colors) and its comparison object are cloned in O(n).
 			 * 
 			 * @param x: another map object of the same type, whose contents are either copied or acquired.
 			 */
-			map(const map& x) : _rbt(value_compare(key_compare())) {
-				insert(x.begin(), x.end());
-			}
+			basic_map(const basic_map& x) : _rbt(x._rbt) {}
 			
 			/**
 			 * @brief destructor
 			 * @note this destroys all container elements,
 			 * and deallocates all the storage capacity allocated by the map using its allocator.
 			 */
-   			~map(void) {
-				clear();
-				_rbt.destroyNull();
-			}
+   			~basic_map(void) {}
 
 			/**
 			 * @brief copy container content
 			 * @note copies all the elements from x into the container, changing its size accordingly.
+			 * the tree of x is cloned in O(n), reusing the nodes already owned by the container.
 			 * 
 			 * @param x: a map object of the same type.
 			 * @return *this.
 			 */
-			map& operator=(const map& x) {
+			basic_map& operator=(const basic_map& x) {
 				if (this == &x) return *this;
 
-				this->~map();
-				_rbt = ft::RBT<value_type, value_compare>(value_compare(key_compare()));
-				insert(x.begin(), x.end());
+				_rbt = x._rbt;
 				return *this;
 			}
 
@@ -185,8 +213,8 @@ _BEGIN_NS_FT
 			 * 
 			 * @return an iterator to the first element in the container.
 			 */
-			iterator begin() { return iterator(_rbt.getRoot(), _rbt.min(), _rbt.getNull()); }
-			const_iterator begin() const { return const_iterator(_rbt.getRoot(), _rbt.min(), _rbt.getNull()); }
+			iterator begin() { return iterator(_rbt.min()); }
+			const_iterator begin() const { return const_iterator(_rbt.min()); }
 			
 			/**
 			 * @brief return iterator to end
@@ -194,8 +222,8 @@ _BEGIN_NS_FT
 			 * 
 			 * @return an iterator to the past-the-end element in the container.
 			 */
-			iterator end() { return iterator(_rbt.getRoot(), _rbt.getNull(), _rbt.getNull()); }
-			const_iterator end() const { return const_iterator(_rbt.getRoot(), _rbt.getNull(), _rbt.getNull()); }
+			iterator end() { return iterator(_rbt.getHeader()); }
+			const_iterator end() const { return const_iterator(_rbt.getHeader()); }
 
 			/**
 			 * @brief return reverse iterator to reverse beginning
@@ -224,7 +252,7 @@ _BEGIN_NS_FT
 			 * 
 			 * @return true if the container size is 0, false otherwise.
 			 */
-			bool		empty() const { return begin() == end(); }
+			bool		empty() const { return _rbt.empty(); }
 
 			/**
 			 * @brief return container size
@@ -242,6 +270,17 @@ _BEGIN_NS_FT
 			 */
 			size_type	max_size(void) const { return _rbt.max_size(); }
 
+			/**
+			 * @brief request a change in capacity
+			 * @note (extension) preallocates storage so that the container can hold at least n elements
+			 * without asking the allocator again, e.g. before a load of known size.
+			 * the storage of erased elements is kept and reused until clear() or destruction.
+			 * with ft::RBT_IndexStorage, iterators and references stay valid over the next insertions up to n elements.
+			 * 
+			 * @param n: minimum capacity for the container.
+			 */
+			void		reserve(size_type n) { _rbt.reserve(n); }
+
 		/* member functions: element access */
 			
 			/**
@@ -252,7 +291,16 @@ _BEGIN_NS_FT
 			 * @param k: key value of the element whose mapped value is accessed.
 			 * @return a reference to the mapped value of the element with a key value equivalent to k.
 			 */
-			mapped_type& operator[](const key_type& k) { return insert(ft::make_pair(k, mapped_type())).first->second; }
+			mapped_type& operator[](const key_type& k) {
+				node_pointer node = _rbt.lower_bound(k);
+
+				// the mapped value is only built when k is absent, lower_bound is the exact hint
+				if (node == _rbt.getHeader() || key_comp()(k, tree_type::valueOf(node).first))
+					node = _rbt.insert(node, value_type(k, mapped_type())).first;
+				else
+					_rbt.access(node);
+				return tree_type::valueOf(node).second;
+			}
 
 		/* member functions: modifiers */
 		
@@ -274,20 +322,20 @@ _BEGIN_NS_FT
 			 * the newly inserted element or to the element that already had an equivalent key in the map.
 			 */
 			ft::pair<iterator, bool> insert(const value_type& val) {
-				if (_rbt.insert(val) == false)
-					return ft::make_pair(find(val.first), false);
-				return ft::make_pair(find(val.first), true);
+				ft::pair<node_pointer, bool> ret = _rbt.insert(val);
+
+				return ft::make_pair(iterator(ret.first), ret.second);
 			}
 
 			iterator insert(iterator position, const value_type& val) {
-				(void)position;
-				return insert(val).first;
+				return iterator(_rbt.insert(position.getNode(), val).first);
 			}
 
+			/** @note hinted with end(): amortized O(1) per element when the range is sorted */
 			template <class InputIterator>
 			void insert(InputIterator first, InputIterator last) {
 				for (; first != last; first++)
-					insert(*first);
+					_rbt.insert(_rbt.getHeader(), *first);
 			}
 
 			/**
@@ -302,21 +350,17 @@ _BEGIN_NS_FT
 			 * @return for the key-based version (2), the function returns the number of elements erased.
 			 */
 			void  erase(iterator position) {
-				erase(position->first);
+				_rbt.erase(position.getNode());
 			}
 			
 			size_type erase(const key_type& k) {
-				if (_rbt.deleteNode(ft::make_pair(k, mapped_type())) == false)
+				if (_rbt.deleteNode(k) == false)
 					return 0;
 				return 1;
 			}
 
 			void  erase(iterator first, iterator last) {
-				while (first != last) {
-					// refix current ptr
-					first = find(first->first);
-					erase(first++);
-				}
+				_rbt.erase(first.getNode(), last.getNode());
 			}
 	
 			/**
@@ -328,7 +372,7 @@ _BEGIN_NS_FT
 			 * (i.e., with the same template parameters, Key, T, Compare and Alloc)
 			 * whose content is swapped with that of this container.
 			 */
-			void swap (map& x) { _rbt.swap(x._rbt); }
+			void swap (basic_map& x) { _rbt.swap(x._rbt); }
 
 			/**
 			 * @brief clear content
@@ -337,6 +381,105 @@ _BEGIN_NS_FT
 			 */
 			void clear() { _rbt.destroyTree(); }
 
+		/* member functions: node handles */
+
+			/**
+			 * @brief extract a node
+			 * @note (extension) unlinks the element from the map and hands its node over, nothing is copied nor freed.
+			 * O(log n): the storage of the node is found by bisection on the slabs of the pool.
+			 * 
+			 * @param position: iterator pointing to the element to extract.
+			 * @param k: key of the element to extract.
+			 * @return a node handle owning the element, empty if k is not in the map.
+			 */
+			node_type	extract(const_iterator position) {
+				ft::RBT_node_handles_need_RBT_NodeStorage<tree_node>::check();
+
+				node_pointer node = _rbt.extract(position.getNode());
+
+				return node_type(node, _rbt.getPool().storeOf(node), get_allocator());
+			}
+
+			node_type	extract(const key_type& k) {
+				node_pointer node = _rbt.searchTree(k);
+
+				if (node == _rbt.getHeader())
+					return node_type();
+				return extract(const_iterator(node));
+			}
+
+			/**
+			 * @brief insert a node
+			 * @note (extension) links the node of nh if its key is not in the map yet, nothing is copied nor reallocated:
+			 * nh is then left empty. the first node coming from a given storage costs one small allocation
+			 * (a reference keeping that storage alive, see ft::nodePool::borrow). a node from a map with an allocator
+			 * not comparing equal cannot be relinked: its value is copied, and the node destroyed when it went in.
+			 * 
+			 * @param nh: node handle (an empty one inserts nothing).
+			 * @param hint: position next to which the node goes, as for insert(position, val).
+			 * @return the position of the key and whether the node was inserted, with the node if it was not.
+			 * the hinted version returns the position only, nh keeps the node if it was not inserted.
+			 */
+			insert_return_type	insert(node_type const & nh) {
+				ft::RBT_node_handles_need_RBT_NodeStorage<tree_node>::check();
+				if (nh.empty())
+					return insert_return_type(end(), false, nh);
+
+				ft::pair<node_pointer, bool> ret = canRelink(nh) ? _rbt.relink(nh.getNode()) : _rbt.insert(valueOf(nh));
+
+				if (ret.second == true)
+					adopt(nh);
+				return insert_return_type(iterator(ret.first), ret.second, nh);
+			}
+
+			iterator	insert(const_iterator hint, node_type const & nh) {
+				ft::RBT_node_handles_need_RBT_NodeStorage<tree_node>::check();
+				if (nh.empty())
+					return end();
+
+				ft::pair<node_pointer, bool> ret = canRelink(nh) ?
+					_rbt.relink(hint.getNode(), nh.getNode()) : _rbt.insert(hint.getNode(), valueOf(nh));
+
+				if (ret.second == true)
+					adopt(nh);
+				return iterator(ret.first);
+			}
+
+			/**
+			 * @brief merge another map
+			 * @note (extension) moves every element of source whose key is not in this map, by relinking its node:
+			 * no copy and no node allocation: the only allocation is one small reference to the storage of source,
+			 * the first time its nodes come to this map (see ft::nodePool::borrow). the elements already in this map stay in source.
+			 * with ft::RBT_IndexStorage, or when the allocators do not compare equal,
+			 * the elements are copied and erased from source instead (O(m log(n + m))).
+			 * O(m log(n / m + 1)) for maps of m <= n elements (see set_union).
+			 * 
+			 * @param source: map to take the elements from.
+			 */
+			void	merge(basic_map& source) { _rbt.merge(source._rbt); }
+
+		/* member functions: set operations */
+
+			/**
+			 * @brief union, intersection and difference in place
+			 * @note (extension) built on split / join of the trees: O(m log(n / m + 1)) for maps of m <= n elements
+			 * (plus the elements destroyed), instead of O(m log n) or O(n + m) element by element.
+			 * with ft::RBT_AVL, ft::RBT_WeightBalanced or ft::RBT_Splay balancing (no split / join),
+			 * they go element by element.
+			 * nodes are relinked, never copied (but by set_union() when merge() copies):
+			 *  - set_union(other): same as merge(other), other keeps the elements already in this map.
+			 *  - set_intersection(other): destroys the elements of this map whose key is not in other.
+			 *  - set_difference(other): destroys the elements of this map whose key is in other.
+			 * other must be ordered by the same comparison, it is left untouched by the last two.
+			 * 
+			 * @param other: map to combine this map with.
+			 */
+			void	set_union(basic_map& other) { _rbt.merge(other._rbt); }
+
+			void	set_intersection(basic_map const & other) { _rbt.intersect(other._rbt); }
+
+			void	set_difference(basic_map const & other) { _rbt.subtract(other._rbt); }
+
 		/* member functions: observers */
 
 			/**
@@ -345,7 +488,7 @@ _BEGIN_NS_FT
 			 * 
 			 * @return the comparison object.
 			 */
-			key_compare	key_comp() const { return key_compare(); }
+			key_compare	key_comp() const { return _rbt.getComp(); }
 			
 			/**
 			 * @brief return value comparison object
@@ -368,11 +511,11 @@ _BEGIN_NS_FT
 			 * if an element with specified key is found, or map::end otherwise.
 			 */
 			iterator find(const key_type& k) {
-				return iterator(_rbt.getRoot(), _rbt.searchTree(ft::make_pair(k, mapped_type())), _rbt.getNull());
+				return iterator(_rbt.find(k));
 			}
 
 			const_iterator find(const key_type& k) const {
-				return const_iterator(_rbt.getRoot(), _rbt.searchTree(ft::make_pair(k, mapped_type())), _rbt.getNull());
+				return const_iterator(_rbt.searchTree(k));
 			}
 
 			/**
@@ -400,11 +543,14 @@ _BEGIN_NS_FT
 			 * whose key is not considered to go before k, or map::end if all keys are considered to go before k.
 			 */
 			iterator lower_bound(const key_type& k) {
-				return iterator(_rbt.getRoot(), _rbt.lower_bound(ft::make_pair(k, mapped_type())), _rbt.getNull());
+				node_pointer node = _rbt.lower_bound(k);
+
+				_rbt.access(node);
+				return iterator(node);
 			}
 			
 			const_iterator lower_bound(const key_type& k) const {
-				return const_iterator(_rbt.getRoot(), _rbt.lower_bound(ft::make_pair(k, mapped_type())), _rbt.getNull());
+				return const_iterator(_rbt.lower_bound(k));
 			}
 
 			/**
@@ -419,11 +565,14 @@ _BEGIN_NS_FT
 			 * whose key is considered to go after k, or map::end if no keys are considered to go after k.
 			 */
 			iterator upper_bound(const key_type& k) {
-				return iterator(_rbt.getRoot(), _rbt.upper_bound(ft::make_pair(k, mapped_type())), _rbt.getNull());
+				node_pointer node = _rbt.upper_bound(k);
+
+				_rbt.access(node);
+				return iterator(node);
 			}
 			
 			const_iterator upper_bound(const key_type& k) const {
-				return const_iterator(_rbt.getRoot(), _rbt.upper_bound(ft::make_pair(k, mapped_type())), _rbt.getNull());
+				return const_iterator(_rbt.upper_bound(k));
 			}
 
 			/**
@@ -444,6 +593,158 @@ _BEGIN_NS_FT
 				return ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
 			}
 
+			/**
+			 * @brief return iterator to the floor / ceiling of a key
+			 * @note (extension) predecessor_key returns the last element whose key does not go after k (floor),
+			 * successor_key the first element whose key does not go before k (ceiling).
+			 * both run a single top-down descent, O(log n).
+			 * 
+			 * @param k: key to search for.
+			 * @return an iterator to the floor (resp. ceiling) of k, or map::end if there is none.
+			 */
+			iterator predecessor_key(const key_type& k) {
+				return iterator(_rbt.predecessor_key(k));
+			}
+
+			const_iterator predecessor_key(const key_type& k) const {
+				return const_iterator(_rbt.predecessor_key(k));
+			}
+
+			iterator successor_key(const key_type& k) {
+				return iterator(_rbt.successor_key(k));
+			}
+
+			const_iterator successor_key(const key_type& k) const {
+				return const_iterator(_rbt.successor_key(k));
+			}
+
+		/* member functions: order statistics */
+
+			/**
+			 * @brief k-th element, rank of a key, number of keys in a range
+			 * @note (extension) only available with ft::RBT_SizedNodeBase nodes or ft::RBT_WeightBalanced balancing,
+			 * which keep the size of every subtree:
+			 * all run a single descent, O(log n). ft::distance on the iterators is O(log n) as well.
+			 * 
+			 * @param n: position of the element, 0 is the first one.
+			 * @param k, lo, hi: keys to search for.
+			 * @return nth: an iterator to the element at position n, or map::end if n >= size().
+			 * rank: the number of elements going before k.
+			 * count_range: the number of elements in [lo, hi), 0 if hi does not go after lo.
+			 */
+			iterator nth(size_type n) {
+				return iterator(_rbt.nth(n));
+			}
+
+			const_iterator nth(size_type n) const {
+				return const_iterator(_rbt.nth(n));
+			}
+
+			size_type rank(const key_type& k) const {
+				return _rbt.rank(k);
+			}
+
+			size_type count_range(const key_type& lo, const key_type& hi) const {
+				if (key_comp()(lo, hi) == false)
+					return 0;
+				return _rbt.rank(hi) - _rbt.rank(lo);
+			}
+
+		/* member functions: aggregates */
+
+			/**
+			 * @brief summary of the elements in a range of keys
+			 * @note (extension) only available with ft::RBT_AugmentedNodeBase<Policy> nodes: every node keeps
+			 * the summary of its subtree, folded with the monoid of Policy (see ft::RBT_AugmentedNodeBase).
+			 * summary() is O(1), aggregate() runs in O(log n) whatever the size of the range.
+			 * the summaries see the mapped values as they were inserted: after changing one in place
+			 * (operator[], through an iterator), refresh() its element.
+			 * 
+			 * @param lo, hi: keys bounding the range [lo, hi).
+			 * @param position: iterator to the element whose mapped value changed.
+			 * @return the summary of the elements in key order, Policy::identity() if there is none.
+			 */
+			summary_type summary() const {
+				return _rbt.summary();
+			}
+
+			summary_type aggregate(const key_type& lo, const key_type& hi) const {
+				return _rbt.aggregate(lo, hi);
+			}
+
+			void refresh(const_iterator position) {
+				_rbt.refresh(position.getNode());
+			}
+
+		/* member functions: heterogeneous lookup */
+
+			/**
+			 * @brief find / count / bounds / erase with a key of another type
+			 * @note (extension) only available when key_compare defines is_transparent (e.g. ft::less<>):
+			 * k is compared to the keys of the elements as is, no key_type is built for the lookup.
+			 * 
+			 * @param k: value of any type key_compare can compare with key_type, in both orders.
+			 */
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, iterator>::type find(const K& k) {
+				return iterator(_rbt.find(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, const_iterator>::type find(const K& k) const {
+				return const_iterator(_rbt.searchTree(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, size_type>::type count(const K& k) const {
+				if (_rbt.searchTree(k) == _rbt.getHeader())
+					return 0;
+				return 1;
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, iterator>::type lower_bound(const K& k) {
+				node_pointer node = _rbt.lower_bound(k);
+
+				_rbt.access(node);
+				return iterator(node);
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, const_iterator>::type lower_bound(const K& k) const {
+				return const_iterator(_rbt.lower_bound(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, iterator>::type upper_bound(const K& k) {
+				node_pointer node = _rbt.upper_bound(k);
+
+				_rbt.access(node);
+				return iterator(node);
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, const_iterator>::type upper_bound(const K& k) const {
+				return const_iterator(_rbt.upper_bound(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, ft::pair<iterator, iterator> >::type equal_range(const K& k) {
+				return ft::make_pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, ft::pair<const_iterator, const_iterator> >::type equal_range(const K& k) const {
+				return ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, size_type>::type erase(const K& k) {
+				if (_rbt.deleteNode(k) == false)
+					return 0;
+				return 1;
+			}
+
 		/* member functions: allocator */
 		
 			/**
@@ -452,18 +753,91 @@ _BEGIN_NS_FT
 			 * 
 			 * @return the allocator.
 			 */
-			allocator_type get_allocator() const { return allocator_type(); }
+			allocator_type get_allocator() const { return allocator_type(_rbt.get_allocator()); }
+
+		protected:
+		/* member types (protected): extensions built on the map (e.g. ft::interval_map) reach the tree */
+
+			/**
+			 * @note the node type follows the balancing, the augmentation and the storage:
+			 * ft::RBT_IndexStorage selects 32-bit index links, Augment and Balance the links of the others (see ft::RBT_node_of)
+			 */
+			typedef typename	ft::RBT_node_of<value_type, Balance, Augment, Storage>::type				tree_node;
+			/** @note the user allocator, rebound to the node type */
+			typedef typename	allocator_type::template rebind<tree_node>::other								node_allocator;
+			typedef				ft::RBT<key_type, value_type, ft::select_first<value_type>, key_compare,
+									tree_node, node_allocator, Balance>											tree_type;
+			typedef typename	tree_type::pointer																node_pointer;
+
+		/* member functions (protected) */
+
+			/** @note a node can only go to a pool with an allocator comparing equal, its value is copied otherwise */
+			bool	canRelink(node_type const & nh) const { return nh.get_allocator() == get_allocator(); }
+
+			static value_type const &	valueOf(node_type const & nh) { return static_cast<tree_node *>(nh.getNode())->value(); }
+
+			/**
+			 * @note the container takes the node of nh and the reference to its storage,
+			 * or only a copy of its value (see canRelink): the node is then destroyed.
+			 */
+			void	adopt(node_type const & nh) {
+				if (canRelink(nh) == false)
+					return nh.clear();
+				_rbt.getPool().borrow(nh.getStore());
+				nh.release();
+			}
 
-		private:
 		/* attributes */
 
-			ft::RBT<value_type, value_compare>	_rbt;
+			tree_type	_rbt;
+	};
+
+/**
+ * @class template: map
+ */
+
+	/**
+	 * @brief map
+	 * @note a basic_map balanced as a red black tree: the map of the standard, with its four template parameters.
+	 * every member comes from basic_map, a map is passed as is where a basic_map of the same parameters is expected.
+	 */
+	template < class Key,
+		class T,
+		class Compare = ft::less<Key>,
+		class Alloc = std::allocator< ft::pair<const Key, T> > >
+	class map : public ft::basic_map<Key, T, Compare, Alloc> {
+		public:
+		/* member types */
+
+			typedef				ft::basic_map<Key, T, Compare, Alloc>		basic_map_type;
+			typedef typename	basic_map_type::key_compare					key_compare;
+			typedef typename	basic_map_type::allocator_type				allocator_type;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			explicit map(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : basic_map_type(comp, alloc) {}
+
+			template <class InputIterator>
+			map(InputIterator first, InputIterator last,
+				const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : basic_map_type(first, last, comp, alloc) {}
+
+			map(const map& x) : basic_map_type(x) {}
+
+			~map(void) {}
+
+			map& operator=(const map& x) {
+				basic_map_type::operator=(x);
+				return *this;
+			}
 	};
 	
-	/* non-member function: map */
+	/* non-member function: basic_map */
 
 		/**
-		 * @brief relational operators for map
+		 * @brief relational operators for map (and basic_map)
 		 * @note performs the appropriate comparison operation between the map containers lhs and rhs.
 		 * a != b : !(a == b)
 		 * a > b  : b < a
@@ -471,42 +845,42 @@ _BEGIN_NS_FT
 		 * a >= b : !(a < b)
 		 * 
 		 * @param lhs, rhs: map containers (to the left- and right-hand side of the operator, respectively),
-		 * having both the same template parameters (Key, T, Compare and Alloc).
+		 * having both the same template parameters (Key, T, Compare, Alloc, Balance, Augment and Storage).
 		 * @return true if the condition holds, and false otherwise.
 		 */
-		template <class Key, class T, class Compare, class Allocator>
-		bool operator==(const ft::map<Key, T, Compare, Allocator>& lhs,
-				const ft::map<Key, T, Compare, Allocator>& rhs) {
+		template <class Key, class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator==(const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& rhs) {
 					if (lhs.size() != rhs.size())
 						return false;
 					return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 		}
 
-		template <class Key, class T, class Compare, class Allocator>
-		bool operator!=(const map<Key, T, Compare, Allocator>& lhs,
-				const map<Key, T, Compare, Allocator>& rhs) { return !(lhs == rhs); }
+		template <class Key, class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator!=(const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& rhs) { return !(lhs == rhs); }
 
-		template <class Key, class T, class Compare, class Allocator>
-		bool operator< (const map<Key, T, Compare, Allocator>& lhs,
-				const map<Key, T, Compare, Allocator>& rhs) {
+		template <class Key, class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator< (const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& rhs) {
 					return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 		}
 
-		template <class Key, class T, class Compare, class Allocator>
-		bool operator<=(const map<Key, T, Compare, Allocator>& lhs,
-				const map<Key, T, Compare, Allocator>& rhs) { return !(rhs < lhs); }
+		template <class Key, class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator<=(const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& rhs) { return !(rhs < lhs); }
 
-		template <class Key, class T, class Compare, class Allocator>
-		bool operator> (const map<Key, T, Compare, Allocator>& lhs,
-				const map<Key, T, Compare, Allocator>& rhs) { return rhs < lhs; }
+		template <class Key, class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator> (const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& rhs) { return rhs < lhs; }
 
-		template <class Key, class T, class Compare, class Allocator>
-		bool operator>=(const map<Key, T, Compare, Allocator>& lhs,
-				const map<Key, T, Compare, Allocator>& rhs) { return !(lhs < rhs); }
+		template <class Key, class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator>=(const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& rhs) { return !(lhs < rhs); }
 
-		template <class Key, class T, class Compare, class Allocator>
-		void swap(map<Key, T, Compare, Allocator>& x,
-			map<Key, T, Compare, Allocator>& y) { x.swap(y); }
+		template <class Key, class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		void swap(ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& x,
+			ft::basic_map<Key, T, Compare, Allocator, Balance, Augment, Storage>& y) { x.swap(y); }
 
 _END_NS_FT
 
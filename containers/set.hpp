@@ -17,15 +17,16 @@
 #include <cstddef>
 #include <exception>
 #include "./utils/treeIte.hpp"
+#include "./utils/nodeHandle.hpp"
 
 _BEGIN_NS_FT
 
 /**
- * @class template: set
+ * @class template: basic_set
  */
 
 	/**
-	 * @brief set
+	 * @brief set with a choice of balancing
 	 * @note sets are containers that store unique elements following a specific order.
 	 * 
 	 * container properties:
@@ -51,11 +52,28 @@ _BEGIN_NS_FT
 	 * This defaults to less<T>, which returns the same as applying the less-than operator (a < b).
 	 * @param Alloc: type of the allocator object used to define the storage allocation model.
 	 * by default, the allocator class template is used, which defines the simplest memory allocation model and is value-independent.
+	 * @param Balance: (extension) balancing policy of the tree: ft::RBT_RedBlack (the default, see ft::set),
+	 * ft::RBT_AVL (at most 1.44 log n deep, for more rotations on insertion / deletion),
+	 * ft::RBT_WeightBalanced (balanced on the sizes of the subtrees, kept in the nodes:
+	 * the order statistics come along) or ft::RBT_Splay (self-adjusting: the keys looked up often stay near the root).
+	 * @param Augment: (extension) what every node keeps about its subtree: ft::RBT_NodeBase (nothing, the default),
+	 * ft::RBT_SizedNodeBase (its size: nth(), rank(), count_range() and ft::distance in O(log n),
+	 * for one more word per node and O(log n) updates on the path to the root at each insertion / deletion)
+	 * or ft::RBT_AugmentedNodeBase<Policy> (its summary, folded with the monoid of Policy: see aggregate()).
+	 * @param Storage: (extension) where the nodes live: ft::RBT_NodeStorage (nodes linked by pointers, the default)
+	 * or ft::RBT_IndexStorage (one array linked by 32-bit indices, red black balancing without augmentation only):
+	 * the container holds at most 2^30 - 1 elements (INDEX_POOL_MAX_CAPACITY), and an insertion invalidates
+	 * every iterator and reference, like a vector that grows, unless reserve() made room first.
+	 * nodes cannot leave the array: merge() and set_union() copy the elements instead of relinking them,
+	 * and the node handles (extract(), insert(node_type)) need ft::RBT_NodeStorage (a compile error otherwise).
 	 */
 	template < class T,
 		class Compare = ft::less<T>,
-		class Alloc = std::allocator<T> >
-	class set {
+		class Alloc = std::allocator<T>,
+		class Balance = ft::RBT_RedBlack,
+		class Augment = ft::RBT_NodeBase,
+		class Storage = ft::RBT_NodeStorage >
+	class basic_set {
 		public:
 		/* member types */
 
@@ -75,11 +93,27 @@ _BEGIN_NS_FT
 			/** @note usually the same as size_t */
 			typedef	typename	allocator_type::size_type										size_type;
 
-			typedef				ft::treeIterator<const value_type, ft::RBT_Node<value_type> >	iterator;
-			typedef				ft::treeIterator<const value_type, ft::RBT_Node<value_type> >	const_iterator;
+			typedef				ft::treeIterator<const value_type, typename ft::RBT_node_of<value_type, Balance, Augment, Storage>::type >	iterator;
+			typedef				ft::treeIterator<const value_type, typename ft::RBT_node_of<value_type, Balance, Augment, Storage>::type >	const_iterator;
 			typedef				ft::reverse_iterator<iterator>									reverse_iterator;
 			typedef				ft::reverse_iterator<const_iterator>							const_reverse_iterator;
 
+			/** @note (extension) summary of a range of elements, see aggregate() (void unless Augment is ft::RBT_AugmentedNodeBase) */
+			typedef typename	ft::RBT_node_of<value_type, Balance, Augment, Storage>::type::base_type::summary_type			summary_type;
+
+			/** @note (extension) node handle returned by extract(), see ft::nodeHandle */
+			typedef				ft::setNodeHandle<value_type,
+									typename ft::RBT_node_of<value_type, Balance, Augment, Storage>::type, allocator_type>	node_type;
+
+			/** @brief result of insert(node_type): where the key is, whether the node went in, and the node if not */
+			struct insert_return_type {
+				iterator	position;
+				bool		inserted;
+				node_type	node;
+
+				insert_return_type(iterator p, bool i, node_type const & n) : position(p), inserted(i), node(n) {}
+			};
+
 		public:
 		/* member functions: constructor / destructor / operator= */
 
@@ -92,8 +126,8 @@ _BEGIN_NS_FT
 			 * and false otherwise.
 			 * @param alloc: allocator object.
 			 */
-			explicit set(const key_compare& comp = key_compare(),
-				const allocator_type& alloc = allocator_type()) : _rbt(comp) { (void)alloc; }
+			explicit basic_set(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : _rbt(comp, node_allocator(alloc)) {}
 		
 			/**
 			 * @brief constructor: range
@@ -104,46 +138,40 @@ _BEGIN_NS_FT
 			 * @param alloc: allocator object.
 			 */
 			template <class InputIterator>
-			set(InputIterator first, InputIterator last,
+			basic_set(InputIterator first, InputIterator last,
 				const key_compare& comp = key_compare(),
-				const allocator_type& alloc = allocator_type()) : _rbt(comp) {
-					(void)alloc;
-					insert(first, last);
+				const allocator_type& alloc = allocator_type()) : _rbt(comp, node_allocator(alloc)) {
+					_rbt.build(first, last);
 			}
 
 			/**
 			 * @brief constructor: copy
 			 * @note constructs a container with a copy of each of the elements in x.
+			 * the tree of x (shape and colors) and its comparison object are cloned in O(n).
 			 * 
 			 * @param x: another set object of the same type, whose contents are either copied or acquired.
 			 */
-			set(const set& x) : _rbt(value_compare()) {
-				insert(x.begin(), x.end());
-			}
+			basic_set(const basic_set& x) : _rbt(x._rbt) {}
 			
 			/**
 			 * @brief destructor
 			 * @note destroys the container object.
 			 * and deallocates all the storage capacity allocated by the set using its allocator.
 			 */
-   			~set(void) {
-				clear();
-				_rbt.destroyNull();
-			}
+   			~basic_set(void) {}
 
 			/**
 			 * @brief copy container content
 			 * @note copies all the elements from x into the container, changing its size accordingly.
+			 * the tree of x is cloned in O(n), reusing the nodes already owned by the container.
 			 * 
 			 * @param x: a set object of the same type.
 			 * @return *this.
 			 */
-			set& operator=(const set& x) {
+			basic_set& operator=(const basic_set& x) {
 				if (this == &x) return *this;
 
-				this->~set();
-				_rbt = ft::RBT<value_type, value_compare>(value_compare());
-				insert(x.begin(), x.end());
+				_rbt = x._rbt;
 				return *this;
 			}
 
@@ -155,8 +183,8 @@ _BEGIN_NS_FT
 			 * 
 			 * @return an iterator to the first element in the container.
 			 */
-			iterator begin() { return iterator(_rbt.getRoot(), _rbt.min(), _rbt.getNull()); }
-			const_iterator begin() const { return const_iterator(_rbt.getRoot(), _rbt.min(), _rbt.getNull()); }
+			iterator begin() { return iterator(_rbt.min()); }
+			const_iterator begin() const { return const_iterator(_rbt.min()); }
 			
 			/**
 			 * @brief return iterator to end
@@ -164,8 +192,8 @@ _BEGIN_NS_FT
 			 * 
 			 * @return an iterator to the past-the-end element in the container.
 			 */
-			iterator end() { return iterator(_rbt.getRoot(), _rbt.getNull(), _rbt.getNull()); }
-			const_iterator end() const { return const_iterator(_rbt.getRoot(), _rbt.getNull(), _rbt.getNull()); }
+			iterator end() { return iterator(_rbt.getHeader()); }
+			const_iterator end() const { return const_iterator(_rbt.getHeader()); }
 
 			/**
 			 * @brief return reverse iterator to reverse beginning
@@ -194,7 +222,7 @@ _BEGIN_NS_FT
 			 * 
 			 * @return true if the container size is 0, false otherwise.
 			 */
-			bool		empty() const { return begin() == end(); }
+			bool		empty() const { return _rbt.empty(); }
 
 			/**
 			 * @brief return container size
@@ -212,6 +240,17 @@ _BEGIN_NS_FT
 			 */
 			size_type	max_size(void) const { return _rbt.max_size(); }
 
+			/**
+			 * @brief request a change in capacity
+			 * @note (extension) preallocates storage so that the container can hold at least n elements
+			 * without asking the allocator again, e.g. before a load of known size.
+			 * the storage of erased elements is kept and reused until clear() or destruction.
+			 * with ft::RBT_IndexStorage, iterators and references stay valid over the next insertions up to n elements.
+			 * 
+			 * @param n: minimum capacity for the container.
+			 */
+			void		reserve(size_type n) { _rbt.reserve(n); }
+
 		/* member functions: modifiers */
 		
 			/**
@@ -232,20 +271,20 @@ _BEGIN_NS_FT
 			 * the newly inserted element or to the element that already had an equivalent element in the set.
 			 */
 			ft::pair<iterator, bool> insert(const value_type& val) {
-				if (_rbt.insert(val) == false)
-					return ft::make_pair(find(val), false);
-				return ft::make_pair(find(val), true);
+				ft::pair<node_pointer, bool> ret = _rbt.insert(val);
+
+				return ft::make_pair(iterator(ret.first), ret.second);
 			}
 
 			iterator insert(iterator position, const value_type& val) {
-				(void)position;
-				return insert(val).first;
+				return iterator(_rbt.insert(position.getNode(), val).first);
 			}
 
+			/** @note hinted with end(): amortized O(1) per element when the range is sorted */
 			template <class InputIterator>
 			void insert(InputIterator first, InputIterator last) {
 				for (; first != last; first++)
-					insert(*first);
+					_rbt.insert(_rbt.getHeader(), *first);
 			}
 
 			/**
@@ -260,7 +299,7 @@ _BEGIN_NS_FT
 			 * @return for the value-based version (2), the function returns the number of elements erased.
 			 */
 			void  erase(iterator position) {
-				erase(*position);
+				_rbt.erase(position.getNode());
 			}
 			
 			size_type erase(const value_type& val) {
@@ -270,11 +309,7 @@ _BEGIN_NS_FT
 			}
 
 			void  erase(iterator first, iterator last) {
-				while (first != last) {
-					// refix current ptr
-					first = find(*first);
-					erase(first++);
-				}
+				_rbt.erase(first.getNode(), last.getNode());
 			}
 	
 			/**
@@ -286,7 +321,7 @@ _BEGIN_NS_FT
 			 * (i.e., with the same template parameters, Key, T, Compare and Alloc)
 			 * whose content is swapped with that of this container.
 			 */
-			void swap (set& x) { _rbt.swap(x._rbt); }
+			void swap (basic_set& x) { _rbt.swap(x._rbt); }
 
 			/**
 			 * @brief clear content
@@ -295,6 +330,105 @@ _BEGIN_NS_FT
 			 */
 			void clear() { _rbt.destroyTree(); }
 
+		/* member functions: node handles */
+
+			/**
+			 * @brief extract a node
+			 * @note (extension) unlinks the element from the set and hands its node over, nothing is copied nor freed.
+			 * O(log n): the storage of the node is found by bisection on the slabs of the pool.
+			 * 
+			 * @param position: iterator pointing to the element to extract.
+			 * @param val: value of the element to extract.
+			 * @return a node handle owning the element, empty if val is not in the set.
+			 */
+			node_type	extract(const_iterator position) {
+				ft::RBT_node_handles_need_RBT_NodeStorage<tree_node>::check();
+
+				node_pointer node = _rbt.extract(position.getNode());
+
+				return node_type(node, _rbt.getPool().storeOf(node), get_allocator());
+			}
+
+			node_type	extract(const value_type& val) {
+				node_pointer node = _rbt.searchTree(val);
+
+				if (node == _rbt.getHeader())
+					return node_type();
+				return extract(const_iterator(node));
+			}
+
+			/**
+			 * @brief insert a node
+			 * @note (extension) links the node of nh if its key is not in the set yet, nothing is copied nor reallocated:
+			 * nh is then left empty. the first node coming from a given storage costs one small allocation
+			 * (a reference keeping that storage alive, see ft::nodePool::borrow). a node from a set with an allocator
+			 * not comparing equal cannot be relinked: its value is copied, and the node destroyed when it went in.
+			 * 
+			 * @param nh: node handle (an empty one inserts nothing).
+			 * @param hint: position next to which the node goes, as for insert(position, val).
+			 * @return the position of the key and whether the node was inserted, with the node if it was not.
+			 * the hinted version returns the position only, nh keeps the node if it was not inserted.
+			 */
+			insert_return_type	insert(node_type const & nh) {
+				ft::RBT_node_handles_need_RBT_NodeStorage<tree_node>::check();
+				if (nh.empty())
+					return insert_return_type(end(), false, nh);
+
+				ft::pair<node_pointer, bool> ret = canRelink(nh) ? _rbt.relink(nh.getNode()) : _rbt.insert(valueOf(nh));
+
+				if (ret.second == true)
+					adopt(nh);
+				return insert_return_type(iterator(ret.first), ret.second, nh);
+			}
+
+			iterator	insert(const_iterator hint, node_type const & nh) {
+				ft::RBT_node_handles_need_RBT_NodeStorage<tree_node>::check();
+				if (nh.empty())
+					return end();
+
+				ft::pair<node_pointer, bool> ret = canRelink(nh) ?
+					_rbt.relink(hint.getNode(), nh.getNode()) : _rbt.insert(hint.getNode(), valueOf(nh));
+
+				if (ret.second == true)
+					adopt(nh);
+				return iterator(ret.first);
+			}
+
+			/**
+			 * @brief merge another set
+			 * @note (extension) moves every element of source whose key is not in this set, by relinking its node:
+			 * no copy and no node allocation: the only allocation is one small reference to the storage of source,
+			 * the first time its nodes come to this set (see ft::nodePool::borrow). the elements already in this set stay in source.
+			 * with ft::RBT_IndexStorage, or when the allocators do not compare equal,
+			 * the elements are copied and erased from source instead (O(m log(n + m))).
+			 * O(m log(n / m + 1)) for sets of m <= n elements (see set_union).
+			 * 
+			 * @param source: set to take the elements from.
+			 */
+			void	merge(basic_set& source) { _rbt.merge(source._rbt); }
+
+		/* member functions: set operations */
+
+			/**
+			 * @brief union, intersection and difference in place
+			 * @note (extension) built on split / join of the trees: O(m log(n / m + 1)) for sets of m <= n elements
+			 * (plus the elements destroyed), instead of O(m log n) or O(n + m) element by element.
+			 * with ft::RBT_AVL, ft::RBT_WeightBalanced or ft::RBT_Splay balancing (no split / join),
+			 * they go element by element.
+			 * nodes are relinked, never copied (but by set_union() when merge() copies):
+			 *  - set_union(other): same as merge(other), other keeps the elements already in this set.
+			 *  - set_intersection(other): destroys the elements of this set whose key is not in other.
+			 *  - set_difference(other): destroys the elements of this set whose key is in other.
+			 * other must be ordered by the same comparison, it is left untouched by the last two.
+			 * 
+			 * @param other: set to combine this set with.
+			 */
+			void	set_union(basic_set& other) { _rbt.merge(other._rbt); }
+
+			void	set_intersection(basic_set const & other) { _rbt.intersect(other._rbt); }
+
+			void	set_difference(basic_set const & other) { _rbt.subtract(other._rbt); }
+
 		/* member functions: observers */
 
 			/**
@@ -303,7 +437,7 @@ _BEGIN_NS_FT
 			 * 
 			 * @return the comparison object.
 			 */
-			key_compare	key_comp() const { return key_compare(); }
+			key_compare	key_comp() const { return _rbt.getComp(); }
 			
 			/**
 			 * @brief rreturn comparison object
@@ -311,7 +445,7 @@ _BEGIN_NS_FT
 			 * 
 			 * @return the comparison object.
 			 */
-			value_compare  value_comp() const { return value_compare(); }
+			value_compare  value_comp() const { return _rbt.getComp(); }
 
 		/* member functions: operations */
 		
@@ -325,11 +459,11 @@ _BEGIN_NS_FT
 			 * if val is found, or set::end otherwise.
 			 */
 			iterator find(const value_type& val) {
-				return iterator(_rbt.getRoot(), _rbt.searchTree(val), _rbt.getNull());
+				return iterator(_rbt.find(val));
 			}
 
 			const_iterator find(const value_type& val) const {
-				return const_iterator(_rbt.getRoot(), _rbt.searchTree(val), _rbt.getNull());
+				return const_iterator(_rbt.searchTree(val));
 			}
 
 			/**
@@ -357,11 +491,14 @@ _BEGIN_NS_FT
 			 * which is not considered to go before val, or set::end if all elements are considered to go before val.
 			 */
 			iterator lower_bound(const value_type& val) {
-				return iterator(_rbt.getRoot(), _rbt.lower_bound(val), _rbt.getNull());
+				node_pointer node = _rbt.lower_bound(val);
+
+				_rbt.access(node);
+				return iterator(node);
 			}
 			
 			const_iterator lower_bound(const value_type& val) const {
-				return const_iterator(_rbt.getRoot(), _rbt.lower_bound(val), _rbt.getNull());
+				return const_iterator(_rbt.lower_bound(val));
 			}
 
 			/**
@@ -375,11 +512,14 @@ _BEGIN_NS_FT
 			 * which is considered to go after val, or set::end if no elements are considered to go after val.
 			 */
 			iterator upper_bound(const value_type& val) {
-				return iterator(_rbt.getRoot(), _rbt.upper_bound(val), _rbt.getNull());
+				node_pointer node = _rbt.upper_bound(val);
+
+				_rbt.access(node);
+				return iterator(node);
 			}
 			
 			const_iterator upper_bound(const value_type& val) const {
-				return const_iterator(_rbt.getRoot(), _rbt.upper_bound(val), _rbt.getNull());
+				return const_iterator(_rbt.upper_bound(val));
 			}
 
 			/**
@@ -399,6 +539,151 @@ _BEGIN_NS_FT
 				return ft::make_pair<const_iterator, const_iterator>(lower_bound(val), upper_bound(val));
 			}
 
+			/**
+			 * @brief return iterator to the floor / ceiling of a value
+			 * @note (extension) predecessor_key returns the last element which does not go after val (floor),
+			 * successor_key the first element which does not go before val (ceiling).
+			 * both run a single top-down descent, O(log n).
+			 * 
+			 * @param val: value to search for.
+			 * @return an iterator to the floor (resp. ceiling) of val, or set::end if there is none.
+			 */
+			iterator predecessor_key(const value_type& val) {
+				return iterator(_rbt.predecessor_key(val));
+			}
+
+			const_iterator predecessor_key(const value_type& val) const {
+				return const_iterator(_rbt.predecessor_key(val));
+			}
+
+			iterator successor_key(const value_type& val) {
+				return iterator(_rbt.successor_key(val));
+			}
+
+			const_iterator successor_key(const value_type& val) const {
+				return const_iterator(_rbt.successor_key(val));
+			}
+
+		/* member functions: order statistics */
+
+			/**
+			 * @brief k-th element, rank of a key, number of keys in a range
+			 * @note (extension) only available with ft::RBT_SizedNodeBase nodes or ft::RBT_WeightBalanced balancing,
+			 * which keep the size of every subtree:
+			 * all run a single descent, O(log n). ft::distance on the iterators is O(log n) as well.
+			 * 
+			 * @param n: position of the element, 0 is the first one.
+			 * @param val, lo, hi: values to search for.
+			 * @return nth: an iterator to the element at position n, or set::end if n >= size().
+			 * rank: the number of elements going before val.
+			 * count_range: the number of elements in [lo, hi), 0 if hi does not go after lo.
+			 */
+			iterator nth(size_type n) {
+				return iterator(_rbt.nth(n));
+			}
+
+			const_iterator nth(size_type n) const {
+				return const_iterator(_rbt.nth(n));
+			}
+
+			size_type rank(const value_type& val) const {
+				return _rbt.rank(val);
+			}
+
+			size_type count_range(const value_type& lo, const value_type& hi) const {
+				if (key_comp()(lo, hi) == false)
+					return 0;
+				return _rbt.rank(hi) - _rbt.rank(lo);
+			}
+
+		/* member functions: aggregates */
+
+			/**
+			 * @brief summary of the elements in a range of keys
+			 * @note (extension) only available with ft::RBT_AugmentedNodeBase<Policy> nodes: every node keeps
+			 * the summary of its subtree, folded with the monoid of Policy (see ft::RBT_AugmentedNodeBase).
+			 * summary() is O(1), aggregate() runs in O(log n) whatever the size of the range.
+			 * 
+			 * @param lo, hi: values bounding the range [lo, hi).
+			 * @return the summary of the elements in key order, Policy::identity() if there is none.
+			 */
+			summary_type summary() const {
+				return _rbt.summary();
+			}
+
+			summary_type aggregate(const value_type& lo, const value_type& hi) const {
+				return _rbt.aggregate(lo, hi);
+			}
+
+		/* member functions: heterogeneous lookup */
+
+			/**
+			 * @brief find / count / bounds / erase with a key of another type
+			 * @note (extension) only available when key_compare defines is_transparent (e.g. ft::less<>):
+			 * k is compared to the keys of the elements as is, no key_type is built for the lookup.
+			 * 
+			 * @param k: value of any type key_compare can compare with key_type, in both orders.
+			 */
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, iterator>::type find(const K& k) {
+				return iterator(_rbt.find(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, const_iterator>::type find(const K& k) const {
+				return const_iterator(_rbt.searchTree(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, size_type>::type count(const K& k) const {
+				if (_rbt.searchTree(k) == _rbt.getHeader())
+					return 0;
+				return 1;
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, iterator>::type lower_bound(const K& k) {
+				node_pointer node = _rbt.lower_bound(k);
+
+				_rbt.access(node);
+				return iterator(node);
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, const_iterator>::type lower_bound(const K& k) const {
+				return const_iterator(_rbt.lower_bound(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, iterator>::type upper_bound(const K& k) {
+				node_pointer node = _rbt.upper_bound(k);
+
+				_rbt.access(node);
+				return iterator(node);
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, const_iterator>::type upper_bound(const K& k) const {
+				return const_iterator(_rbt.upper_bound(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, ft::pair<iterator, iterator> >::type equal_range(const K& k) {
+				return ft::make_pair<iterator, iterator>(lower_bound(k), upper_bound(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, ft::pair<const_iterator, const_iterator> >::type equal_range(const K& k) const {
+				return ft::make_pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k));
+			}
+
+			template < class K >
+			typename ft::enable_if<ft::is_transparent_compare<key_compare, K>::value, size_type>::type erase(const K& k) {
+				if (_rbt.deleteNode(k) == false)
+					return 0;
+				return 1;
+			}
+
 		/* member functions: allocator */
 		
 			/**
@@ -407,18 +692,90 @@ _BEGIN_NS_FT
 			 * 
 			 * @return the allocator.
 			 */
-			allocator_type get_allocator() const { return allocator_type(); }
+			allocator_type get_allocator() const { return allocator_type(_rbt.get_allocator()); }
 
 		private:
+		/* member types (private) */
+
+			/**
+			 * @note the node type follows the balancing, the augmentation and the storage:
+			 * ft::RBT_IndexStorage selects 32-bit index links, Augment and Balance the links of the others (see ft::RBT_node_of)
+			 */
+			typedef typename	ft::RBT_node_of<value_type, Balance, Augment, Storage>::type				tree_node;
+			/** @note the user allocator, rebound to the node type */
+			typedef typename	allocator_type::template rebind<tree_node>::other								node_allocator;
+			typedef				ft::RBT<key_type, value_type, ft::identity<value_type>, key_compare,
+									tree_node, node_allocator, Balance>											tree_type;
+			typedef typename	tree_type::pointer																node_pointer;
+
+		/* member functions (private) */
+
+			/** @note a node can only go to a pool with an allocator comparing equal, its value is copied otherwise */
+			bool	canRelink(node_type const & nh) const { return nh.get_allocator() == get_allocator(); }
+
+			static value_type const &	valueOf(node_type const & nh) { return static_cast<tree_node *>(nh.getNode())->value(); }
+
+			/**
+			 * @note the container takes the node of nh and the reference to its storage,
+			 * or only a copy of its value (see canRelink): the node is then destroyed.
+			 */
+			void	adopt(node_type const & nh) {
+				if (canRelink(nh) == false)
+					return nh.clear();
+				_rbt.getPool().borrow(nh.getStore());
+				nh.release();
+			}
+
 		/* attributes */
 
-			ft::RBT<value_type, value_compare>	_rbt;
+			tree_type	_rbt;
+	};
+
+/**
+ * @class template: set
+ */
+
+	/**
+	 * @brief set
+	 * @note a basic_set balanced as a red black tree: the set of the standard, with its three template parameters.
+	 * every member comes from basic_set, a set is passed as is where a basic_set of the same parameters is expected.
+	 */
+	template < class T,
+		class Compare = ft::less<T>,
+		class Alloc = std::allocator<T> >
+	class set : public ft::basic_set<T, Compare, Alloc> {
+		public:
+		/* member types */
+
+			typedef				ft::basic_set<T, Compare, Alloc>		basic_set_type;
+			typedef typename	basic_set_type::key_compare				key_compare;
+			typedef typename	basic_set_type::allocator_type			allocator_type;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			explicit set(const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : basic_set_type(comp, alloc) {}
+
+			template <class InputIterator>
+			set(InputIterator first, InputIterator last,
+				const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type()) : basic_set_type(first, last, comp, alloc) {}
+
+			set(const set& x) : basic_set_type(x) {}
+
+			~set(void) {}
+
+			set& operator=(const set& x) {
+				basic_set_type::operator=(x);
+				return *this;
+			}
 	};
 	
-	/* non-member function: set */
+	/* non-member function: basic_set */
 
 		/**
-		 * @brief relational operators for set
+		 * @brief relational operators for set (and basic_set)
 		 * @note performs the appropriate comparison operation between the set containers lhs and rhs.
 		 * a != b : !(a == b)
 		 * a > b  : b < a
@@ -426,42 +783,42 @@ _BEGIN_NS_FT
 		 * a >= b : !(a < b)
 		 * 
 		 * @param lhs, rhs: set containers (to the left- and right-hand side of the operator, respectively),
-		 * having both the same template parameters (Key, T, Compare and Alloc).
+		 * having both the same template parameters (T, Compare, Alloc, Balance, Augment and Storage).
 		 * @return true if the condition holds, and false otherwise.
 		 */
-		template <class T, class Compare, class Allocator>
-		bool operator==(const ft::set<T, Compare, Allocator>& lhs,
-				const ft::set<T, Compare, Allocator>& rhs) {
+		template <class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator==(const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& rhs) {
 					if (lhs.size() != rhs.size())
 						return false;
 					return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 		}
 
-		template <class T, class Compare, class Allocator>
-		bool operator!=(const set<T, Compare, Allocator>& lhs,
-				const set<T, Compare, Allocator>& rhs) { return !(lhs == rhs); }
+		template <class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator!=(const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& rhs) { return !(lhs == rhs); }
 
-		template <class T, class Compare, class Allocator>
-		bool operator< (const set<T, Compare, Allocator>& lhs,
-				const set<T, Compare, Allocator>& rhs) {
+		template <class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator< (const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& rhs) {
 					return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 		}
 
-		template <class T, class Compare, class Allocator>
-		bool operator<=(const set<T, Compare, Allocator>& lhs,
-				const set<T, Compare, Allocator>& rhs) { return !(rhs < lhs); }
+		template <class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator<=(const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& rhs) { return !(rhs < lhs); }
 
-		template <class T, class Compare, class Allocator>
-		bool operator> (const set<T, Compare, Allocator>& lhs,
-				const set<T, Compare, Allocator>& rhs) { return rhs < lhs; }
+		template <class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator> (const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& rhs) { return rhs < lhs; }
 
-		template <class T, class Compare, class Allocator>
-		bool operator>=(const set<T, Compare, Allocator>& lhs,
-				const set<T, Compare, Allocator>& rhs) { return !(lhs < rhs); }
+		template <class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		bool operator>=(const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& lhs,
+				const ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& rhs) { return !(lhs < rhs); }
 
-		template <class T, class Compare, class Allocator>
-		void swap(set<T, Compare, Allocator>& x,
-			set<T, Compare, Allocator>& y) { x.swap(y); }
+		template <class T, class Compare, class Allocator, class Balance, class Augment, class Storage>
+		void swap(ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& x,
+			ft::basic_set<T, Compare, Allocator, Balance, Augment, Storage>& y) { x.swap(y); }
 
 _END_NS_FT
 
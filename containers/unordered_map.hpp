@@ -0,0 +1,286 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/19 14:02:51 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/19 14:02:51 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+#include <memory>
+#include <cstddef>
+#include "./utils/hash.hpp"
+#include "./utils/hashTable.hpp"
+#include "./utils/hashIte.hpp"
+#include "./utils/iterator.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: unordered_map
+ */
+
+	/**
+	 * @brief unordered map
+	 * @note (extension) associative container of unique keys, in no particular order, found by their hash
+	 * in an open addressing table (see ft::hashTable): the elements are stored in one array of slots,
+	 * with a control byte per slot holding 7 bits of the hash. a lookup checks the control bytes
+	 * HASH_GROUP_WIDTH at a time (one SSE2 compare) and mostly reads a single slot: O(1) on average,
+	 * without the node per element (nor the bucket lists) of a chained table.
+	 *
+	 * the price: the elements are copied to a new array when the table grows, so insert (and rehash, reserve,
+	 * max_load_factor) may invalidate every iterator, pointer and reference to the elements; erase only
+	 * invalidates the erased ones. there are no buckets to visit: bucket_count() is the number of slots.
+	 * reserve() ahead of the insertions avoids the growth.
+	 *
+	 * @param Key: type of the keys.
+	 * @param T: type of the mapped values.
+	 * @param Hash: hash function object on keys, ft::hash by default.
+	 * @param Pred: equality on keys: equal keys must have equal hashes.
+	 * @param Alloc: type of the allocator object, rebound to the control bytes.
+	 */
+	template < class Key,
+		class T,
+		class Hash = ft::hash<Key>,
+		class Pred = ft::equal_to<Key>,
+		class Alloc = std::allocator< ft::pair<const Key, T> > >
+	class unordered_map {
+		public:
+		/* member types */
+
+			typedef				Key													key_type;
+			typedef				T													mapped_type;
+			typedef				ft::pair<const key_type, mapped_type>				value_type;
+			typedef				Hash												hasher;
+			typedef				Pred												key_equal;
+
+			typedef				Alloc															allocator_type;
+			typedef	typename	allocator_type::reference										reference;
+			typedef	typename	allocator_type::const_reference									const_reference;
+			typedef	typename	allocator_type::pointer											pointer;
+			typedef	typename	allocator_type::const_pointer									const_pointer;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type									difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type										size_type;
+
+			typedef				ft::hashTable<key_type, value_type, ft::select_first<value_type>,
+									hasher, key_equal, allocator_type>							table_type;
+
+			typedef typename	table_type::iterator											iterator;
+			typedef typename	table_type::const_iterator										const_iterator;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			/** @brief constructor: default, an empty container, with n slots at least (none by default) */
+			explicit unordered_map(size_type n = 0,
+				const hasher& hf = hasher(),
+				const key_equal& eql = key_equal(),
+				const allocator_type& alloc = allocator_type()) : _table(n, hf, eql, alloc) {}
+
+			/** @brief constructor: range, the first of equivalent keys is kept */
+			template <class InputIterator>
+			unordered_map(InputIterator first, InputIterator last,
+				size_type n = 0,
+				const hasher& hf = hasher(),
+				const key_equal& eql = key_equal(),
+				const allocator_type& alloc = allocator_type()) : _table(n, hf, eql, alloc) {
+					insert(first, last);
+			}
+
+			/** @brief constructor: copy, the table of x is cloned as it is in O(bucket_count()) */
+			unordered_map(const unordered_map& x) : _table(x._table) {}
+
+			~unordered_map(void) {}
+
+			unordered_map& operator=(const unordered_map& x) {
+				if (this == &x) return *this;
+
+				_table = x._table;
+				return *this;
+			}
+
+		/* member functions: iterators */
+
+			iterator begin() { return _table.begin(); }
+			const_iterator begin() const { return _table.begin(); }
+
+			iterator end() { return _table.end(); }
+			const_iterator end() const { return _table.end(); }
+
+		/* member functions: capacity */
+
+			bool		empty() const { return _table.empty(); }
+
+			size_type	size() const { return _table.size(); }
+
+			size_type	max_size(void) const { return _table.max_size(); }
+
+		/* member functions: element access */
+
+			/**
+			 * @brief access element
+			 * @note inserts a default constructed mapped value if k is absent: the reference is invalidated
+			 * by the next insertion.
+			 */
+			mapped_type& operator[](const key_type& k) {
+				size_t		hash = _table.hashOf(k);
+				size_type	i = _table.lookup(k, hash);
+
+				// the mapped value is only built when k is absent
+				if (i == _table.bucket_count())
+					return _table.insertAt(_table.prepareInsert(hash), hash, value_type(k, mapped_type()))->second;
+				return _table.position(i)->second;
+			}
+
+		/* member functions: modifiers */
+
+			/**
+			 * @brief insert elements
+			 * @note the hint is ignored: the hash tells the position. see map::insert.
+			 */
+			ft::pair<iterator, bool> insert(const value_type& val) {
+				return _table.insert(val);
+			}
+
+			iterator insert(const_iterator position, const value_type& val) {
+				(void)position;
+				return _table.insert(val).first;
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last) {
+				for (; first != last; ++first)
+					_table.insert(*first);
+			}
+
+			/**
+			 * @brief erase elements
+			 * @note the other iterators stay valid, the ones returned point to the element which followed the erased ones.
+			 * the key-based version returns the number of elements erased.
+			 */
+			iterator erase(const_iterator position) {
+				return _table.erase(position);
+			}
+
+			size_type erase(const key_type& k) {
+				return _table.erase(k);
+			}
+
+			iterator erase(const_iterator first, const_iterator last) {
+				return _table.erase(first, last);
+			}
+
+			void swap (unordered_map& x) { _table.swap(x._table); }
+
+			/** @note the slots are kept: refilling to the same size does not grow again */
+			void clear() { _table.clear(); }
+
+		/* member functions: observers */
+
+			hasher		hash_function() const { return _table.hash_function(); }
+
+			key_equal	key_eq() const { return _table.key_eq(); }
+
+		/* member functions: operations */
+
+			iterator find(const key_type& k) {
+				return _table.find(k);
+			}
+
+			const_iterator find(const key_type& k) const {
+				return _table.find(k);
+			}
+
+			size_type count(const key_type& k) const {
+				if (find(k) == end())
+					return 0;
+				return 1;
+			}
+
+			ft::pair<iterator, iterator> equal_range(const key_type& k) {
+				iterator it = find(k);
+
+				iterator last = it;
+
+				if (last != end())
+					++last;
+				return ft::make_pair<iterator, iterator>(it, last);
+			}
+
+			ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const {
+				const_iterator it = find(k);
+
+				const_iterator last = it;
+
+				if (last != end())
+					++last;
+				return ft::make_pair<const_iterator, const_iterator>(it, last);
+			}
+
+		/* member functions: hash policy */
+
+			/** @note the number of slots, 2^k - 1 */
+			size_type	bucket_count() const { return _table.bucket_count(); }
+
+			float		load_factor() const { return _table.load_factor(); }
+
+			float		max_load_factor() const { return _table.max_load_factor(); }
+
+			/** @note clamped to [0.125, HASH_MAX_LOAD_FACTOR], the table is rehashed to it */
+			void		max_load_factor(float z) { _table.max_load_factor(z); }
+
+			/** @note rehash(0) shrinks the table to fit and drops the tombstones left by erase */
+			void		rehash(size_type n) { _table.rehash(n); }
+
+			/** @brief make room for n elements: no growth (and no invalidation) until size() exceeds n */
+			void		reserve(size_type n) { _table.reserve(n); }
+
+		/* member functions: allocator */
+
+			allocator_type get_allocator() const { return _table.get_allocator(); }
+
+		private:
+		/* attributes */
+
+			table_type	_table;
+	};
+
+	/* non-member function: unordered_map */
+
+		/** @brief same elements, in whatever order: each key of lhs is found in rhs, with an equal mapped value */
+		template <class Key, class T, class Hash, class Pred, class Allocator>
+		bool operator==(const ft::unordered_map<Key, T, Hash, Pred, Allocator>& lhs,
+				const ft::unordered_map<Key, T, Hash, Pred, Allocator>& rhs) {
+					typedef typename ft::unordered_map<Key, T, Hash, Pred, Allocator>::const_iterator	const_iterator;
+
+					if (lhs.size() != rhs.size())
+						return false;
+					for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+						const_iterator found = rhs.find(it->first);
+
+						if (found == rhs.end() || !(found->second == it->second))
+							return false;
+					}
+					return true;
+		}
+
+		template <class Key, class T, class Hash, class Pred, class Allocator>
+		bool operator!=(const unordered_map<Key, T, Hash, Pred, Allocator>& lhs,
+				const unordered_map<Key, T, Hash, Pred, Allocator>& rhs) { return !(lhs == rhs); }
+
+		template <class Key, class T, class Hash, class Pred, class Allocator>
+		void swap(unordered_map<Key, T, Hash, Pred, Allocator>& x,
+			unordered_map<Key, T, Hash, Pred, Allocator>& y) { x.swap(y); }
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
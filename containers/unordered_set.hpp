@@ -0,0 +1,240 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_set.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/19 14:48:10 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/19 14:48:10 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_SET_HPP
+# define UNORDERED_SET_HPP
+
+#include <memory>
+#include <cstddef>
+#include "./utils/hash.hpp"
+#include "./utils/hashTable.hpp"
+#include "./utils/hashIte.hpp"
+#include "./utils/iterator.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: unordered_set
+ */
+
+	/**
+	 * @brief unordered set
+	 * @note (extension) a set of unique elements found by their hash, see ft::unordered_map: the same
+	 * open addressing table probed HASH_GROUP_WIDTH control bytes at a time, and the same price:
+	 * insert may invalidate every iterator and reference to the elements, erase only the erased ones.
+	 *
+	 * @param T: type of the elements.
+	 * @param Hash: hash function object on elements, ft::hash by default.
+	 * @param Pred: equality on elements: equal elements must have equal hashes.
+	 * @param Alloc: type of the allocator object, rebound to the control bytes.
+	 */
+	template < class T,
+		class Hash = ft::hash<T>,
+		class Pred = ft::equal_to<T>,
+		class Alloc = std::allocator<T> >
+	class unordered_set {
+		public:
+		/* member types */
+
+			typedef				T													key_type;
+			typedef				T													value_type;
+			typedef				Hash												hasher;
+			typedef				Pred												key_equal;
+
+			typedef				Alloc															allocator_type;
+			typedef	typename	allocator_type::reference										reference;
+			typedef	typename	allocator_type::const_reference									const_reference;
+			typedef	typename	allocator_type::pointer											pointer;
+			typedef	typename	allocator_type::const_pointer									const_pointer;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type									difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type										size_type;
+
+			typedef				ft::hashTable<key_type, value_type, ft::identity<value_type>,
+									hasher, key_equal, allocator_type>							table_type;
+
+			typedef typename	table_type::const_iterator										iterator;
+			typedef typename	table_type::const_iterator										const_iterator;
+
+		public:
+		/* member functions: constructor / destructor / operator= */
+
+			/** @brief constructor: default, an empty container, with n slots at least (none by default) */
+			explicit unordered_set(size_type n = 0,
+				const hasher& hf = hasher(),
+				const key_equal& eql = key_equal(),
+				const allocator_type& alloc = allocator_type()) : _table(n, hf, eql, alloc) {}
+
+			/** @brief constructor: range, the first of equivalent elements is kept */
+			template <class InputIterator>
+			unordered_set(InputIterator first, InputIterator last,
+				size_type n = 0,
+				const hasher& hf = hasher(),
+				const key_equal& eql = key_equal(),
+				const allocator_type& alloc = allocator_type()) : _table(n, hf, eql, alloc) {
+					insert(first, last);
+			}
+
+			/** @brief constructor: copy, the table of x is cloned as it is in O(bucket_count()) */
+			unordered_set(const unordered_set& x) : _table(x._table) {}
+
+			~unordered_set(void) {}
+
+			unordered_set& operator=(const unordered_set& x) {
+				if (this == &x) return *this;
+
+				_table = x._table;
+				return *this;
+			}
+
+		/* member functions: iterators */
+
+			iterator begin() const { return _table.begin(); }
+
+			iterator end() const { return _table.end(); }
+
+		/* member functions: capacity */
+
+			bool		empty() const { return _table.empty(); }
+
+			size_type	size() const { return _table.size(); }
+
+			size_type	max_size(void) const { return _table.max_size(); }
+
+		/* member functions: modifiers */
+
+			/**
+			 * @brief insert elements
+			 * @note the hint is ignored: the hash tells the position. see set::insert.
+			 */
+			ft::pair<iterator, bool> insert(const value_type& val) {
+				return _table.insert(val);
+			}
+
+			iterator insert(iterator position, const value_type& val) {
+				(void)position;
+				return _table.insert(val).first;
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last) {
+				for (; first != last; ++first)
+					_table.insert(*first);
+			}
+
+			/**
+			 * @brief erase elements
+			 * @note the other iterators stay valid, the ones returned point to the element which followed the erased ones.
+			 * the value-based version returns the number of elements erased.
+			 */
+			iterator erase(iterator position) {
+				return _table.erase(position);
+			}
+
+			size_type erase(const value_type& val) {
+				return _table.erase(val);
+			}
+
+			iterator erase(iterator first, iterator last) {
+				return _table.erase(first, last);
+			}
+
+			void swap (unordered_set& x) { _table.swap(x._table); }
+
+			/** @note the slots are kept: refilling to the same size does not grow again */
+			void clear() { _table.clear(); }
+
+		/* member functions: observers */
+
+			hasher		hash_function() const { return _table.hash_function(); }
+
+			key_equal	key_eq() const { return _table.key_eq(); }
+
+		/* member functions: operations */
+
+			iterator find(const value_type& val) const {
+				return _table.find(val);
+			}
+
+			size_type count(const value_type& val) const {
+				if (find(val) == end())
+					return 0;
+				return 1;
+			}
+
+			ft::pair<iterator, iterator> equal_range(const value_type& val) const {
+				iterator it = find(val);
+				iterator last = it;
+
+				if (last != end())
+					++last;
+				return ft::make_pair<iterator, iterator>(it, last);
+			}
+
+		/* member functions: hash policy */
+
+			/** @note the number of slots, 2^k - 1 */
+			size_type	bucket_count() const { return _table.bucket_count(); }
+
+			float		load_factor() const { return _table.load_factor(); }
+
+			float		max_load_factor() const { return _table.max_load_factor(); }
+
+			/** @note clamped to [0.125, HASH_MAX_LOAD_FACTOR], the table is rehashed to it */
+			void		max_load_factor(float z) { _table.max_load_factor(z); }
+
+			/** @note rehash(0) shrinks the table to fit and drops the tombstones left by erase */
+			void		rehash(size_type n) { _table.rehash(n); }
+
+			/** @brief make room for n elements: no growth (and no invalidation) until size() exceeds n */
+			void		reserve(size_type n) { _table.reserve(n); }
+
+		/* member functions: allocator */
+
+			allocator_type get_allocator() const { return _table.get_allocator(); }
+
+		private:
+		/* attributes */
+
+			table_type	_table;
+	};
+
+	/* non-member function: unordered_set */
+
+		/** @brief same elements, in whatever order: each element of lhs is found in rhs */
+		template <class T, class Hash, class Pred, class Alloc>
+		bool operator==(const ft::unordered_set<T, Hash, Pred, Alloc>& lhs,
+				const ft::unordered_set<T, Hash, Pred, Alloc>& rhs) {
+					typedef typename ft::unordered_set<T, Hash, Pred, Alloc>::const_iterator	const_iterator;
+
+					if (lhs.size() != rhs.size())
+						return false;
+					for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+						if (rhs.find(*it) == rhs.end())
+							return false;
+					}
+					return true;
+		}
+
+		template <class T, class Hash, class Pred, class Alloc>
+		bool operator!=(const unordered_set<T, Hash, Pred, Alloc>& lhs,
+				const unordered_set<T, Hash, Pred, Alloc>& rhs) { return !(lhs == rhs); }
+
+		template <class T, class Hash, class Pred, class Alloc>
+		void swap(unordered_set<T, Hash, Pred, Alloc>& x,
+			unordered_set<T, Hash, Pred, Alloc>& y) { x.swap(y); }
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
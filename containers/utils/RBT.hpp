@@ -14,83 +14,350 @@
 # define RBT_HPP
 
 #include <memory>
+#include <new>
+#include <climits>
 #include "utils.hpp"
+#include "nodePool.hpp"
+#include "indexPool.hpp"
 
 _BEGIN_NS_FT
 
 #define RED_NODE 1
 #define BLACK_NODE 0
 
+/**
+ * @class: RBT_NodeBase
+ */
+
+	/**
+	 * @brief links of a Red Black Tree Node
+	 * @note compact layout: the color is kept in the low bits of the parent pointer
+	 * (nodes are at least pointer aligned, so the two low bits are always 0 in an address).
+	 * the two bits are the state of the node, which goes with its place in the tree: 0 black, 1 red,
+	 * or the balance factor of an AVL tree (RBT_AVL) as 0, 2 or 3, which all read as black.
+	 * links and color are only reached through left() / right() / parent() / color() and their setters,
+	 * the interface every node type of the tree provides, along with update(), augmented and summary_type
+	 * (see RBT_SizedNodeBase and RBT_AugmentedNodeBase).
+	 * the header of a tree is a bare RBT_NodeBase: it has no value to build.
+	 */
+	struct RBT_NodeBase {
+		/* member types */
+
+			typedef size_t			size_type;
+			typedef RBT_NodeBase	base_type;
+
+			/** @note no data is kept about the subtree of a node: the tree skips the updates */
+			static const bool		augmented = false;
+			/** @note no summary to query */
+			typedef void			summary_type;
+
+		/* attributes */
+
+		private:
+			RBT_NodeBase	*_left;
+			RBT_NodeBase	*_right;
+			size_type		_parentColor;
+
+		public:
+		/* member function: constructor / destructor / operator=  */
+
+			RBT_NodeBase(bool color = BLACK_NODE,
+				RBT_NodeBase *parent = ft_nullptr,
+				RBT_NodeBase *left = ft_nullptr,
+				RBT_NodeBase *right = ft_nullptr) :
+					_left(left),
+					_right(right),
+					_parentColor(reinterpret_cast<size_type>(parent) | color) {}
+
+			RBT_NodeBase(RBT_NodeBase const & src) :
+				_left(src._left),
+				_right(src._right),
+				_parentColor(src._parentColor) {}
+
+			~RBT_NodeBase(void) {}
+
+			RBT_NodeBase & operator=(RBT_NodeBase const & rhs) {
+				if (this == &rhs) return *this;
+
+				_left = rhs._left;
+				_right = rhs._right;
+				_parentColor = rhs._parentColor;
+				return *this;
+			}
+
+		/* member function: links / color */
+
+			RBT_NodeBase *	left(void) const { return _left; }
+
+			RBT_NodeBase *	right(void) const { return _right; }
+
+			RBT_NodeBase *	parent(void) const { return reinterpret_cast<RBT_NodeBase *>(_parentColor & ~STATE_MASK); }
+
+			size_type		color(void) const { return (_parentColor & STATE_MASK) == RED_NODE ? RED_NODE : BLACK_NODE; }
+
+			void			setLeft(RBT_NodeBase * left) { _left = left; }
+
+			void			setRight(RBT_NodeBase * right) { _right = right; }
+
+			void			setParent(RBT_NodeBase * parent) {
+				_parentColor = reinterpret_cast<size_type>(parent) | (_parentColor & STATE_MASK);
+			}
+
+			void			setColor(size_type color) { setState(color); }
+
+		/* member function: balance state */
+
+			/** @note -1, 0 or 1: height of the right subtree minus the one of the left subtree (RBT_AVL) */
+			int				balance(void) const {
+				size_type state = _parentColor & STATE_MASK;
+
+				return state == 0 ? 0 : static_cast<int>(state & 1) * 2 - 1;
+			}
+
+			void			setBalance(int balance) { setState(balance == 0 ? 0 : (balance < 0 ? 2 : 3)); }
+
+			size_type		state(void) const { return _parentColor & STATE_MASK; }
+
+			void			setState(size_type state) { _parentColor = (_parentColor & ~STATE_MASK) | state; }
+
+		private:
+		/* member function (private) */
+
+			static const size_type	STATE_MASK = 3;
+
+		public:
+		/* member function: augmentation */
+
+			/** @note called by the node holding val (RBT_Node::update) */
+			template < class V >
+			void			update(V const &) {}
+	};
+
+/**
+ * @class: RBT_SizedNodeBase
+ */
+
+	/**
+	 * @brief links of a Red Black Tree Node, with the size of its subtree
+	 * @note the order statistic node: count() is the number of nodes of the subtree rooted here (this one included).
+	 * the tree calls update() on a node whose children changed, bottom-up: after a rotation,
+	 * and on the path from a linked / unlinked node to the root, so every update costs O(log n).
+	 * the links are RBT_NodeBase ones, cast back: every node of such a tree is a RBT_SizedNodeBase.
+	 */
+	struct RBT_SizedNodeBase : public RBT_NodeBase {
+		/* member types */
+
+			typedef RBT_SizedNodeBase	base_type;
+
+			static const bool			augmented = true;
+
+		/* attributes */
+
+		private:
+			size_type	_count;
+
+		public:
+		/* member function: constructor / destructor / operator=  */
+
+			RBT_SizedNodeBase(bool color = BLACK_NODE,
+				RBT_SizedNodeBase *parent = ft_nullptr,
+				RBT_SizedNodeBase *left = ft_nullptr,
+				RBT_SizedNodeBase *right = ft_nullptr) :
+					RBT_NodeBase(color, parent, left, right),
+					_count(1) {}
+
+			RBT_SizedNodeBase(RBT_SizedNodeBase const & src) :
+				RBT_NodeBase(src),
+				_count(src._count) {}
+
+			~RBT_SizedNodeBase(void) {}
+
+			RBT_SizedNodeBase & operator=(RBT_SizedNodeBase const & rhs) {
+				if (this == &rhs) return *this;
+
+				RBT_NodeBase::operator=(rhs);
+				_count = rhs._count;
+				return *this;
+			}
+
+		/* member function: links / color */
+
+			RBT_SizedNodeBase *	left(void) const { return static_cast<RBT_SizedNodeBase *>(RBT_NodeBase::left()); }
+
+			RBT_SizedNodeBase *	right(void) const { return static_cast<RBT_SizedNodeBase *>(RBT_NodeBase::right()); }
+
+			RBT_SizedNodeBase *	parent(void) const { return static_cast<RBT_SizedNodeBase *>(RBT_NodeBase::parent()); }
+
+		/* member function: augmentation */
+
+			size_type			count(void) const { return _count; }
+
+			template < class V >
+			void				update(V const &) { _count = 1 + countOf(left()) + countOf(right()); }
+
+			static size_type	countOf(RBT_SizedNodeBase const * node) { return node == ft_nullptr ? 0 : node->_count; }
+
+			/**
+			 * @brief position of a node in its tree, O(log n) without the tree
+			 * @note the header (end()) is recognized as in RBT_decrement, its rank is the size of the tree.
+			 */
+			static size_type	rankOf(RBT_SizedNodeBase const * node) {
+				if (node->color() == RED_NODE && (node->parent() == ft_nullptr || node->parent()->parent() == node))
+					return countOf(node->parent());
+
+				size_type			rank = countOf(node->left());
+				RBT_SizedNodeBase	*parent = node->parent();
+
+				// the root is the node whose parent (the header) has it as parent
+				for (; parent->parent() != node; node = parent, parent = node->parent()) {
+					if (node == parent->right())
+						rank += countOf(parent->left()) + 1;
+				}
+				return rank;
+			}
+	};
+
+/**
+ * @class template: RBT_AugmentedNodeBase
+ */
+
+	/**
+	 * @brief links of a Red Black Tree Node, with a summary of its subtree
+	 * @note the summary is the values of the subtree, in order, folded with the monoid of Policy:
+	 * summary = combine(combine(summary(left), summarize(val)), summary(right)), ft_nullptr holding identity().
+	 * it is kept up to date like the count of RBT_SizedNodeBase, so a range of keys is summarized in O(log n)
+	 * (RBT::aggregate). Policy is stateless and provides:
+	 *  - summary_type: the type of a summary (copyable).
+	 *  - static summary_type identity(): the summary of no value.
+	 *  - static summary_type summarize(value_type const & val): the summary of one value.
+	 *  - static summary_type combine(summary_type const & a, summary_type const & b): associative,
+	 *    a summarizes values going before the ones of b (it needs not be commutative).
+	 * 
+	 * @param Policy: the monoid of the summaries.
+	 */
+	template < class Policy >
+	struct RBT_AugmentedNodeBase : public RBT_NodeBase {
+		/* member types */
+
+			typedef RBT_AugmentedNodeBase				base_type;
+			typedef Policy								policy_type;
+			typedef typename Policy::summary_type		summary_type;
+
+			static const bool							augmented = true;
+
+		/* attributes */
+
+		private:
+			summary_type	_summary;
+
+		public:
+		/* member function: constructor / destructor / operator=  */
+
+			RBT_AugmentedNodeBase(bool color = BLACK_NODE,
+				RBT_AugmentedNodeBase *parent = ft_nullptr,
+				RBT_AugmentedNodeBase *left = ft_nullptr,
+				RBT_AugmentedNodeBase *right = ft_nullptr) :
+					RBT_NodeBase(color, parent, left, right),
+					_summary(Policy::identity()) {}
+
+			RBT_AugmentedNodeBase(RBT_AugmentedNodeBase const & src) :
+				RBT_NodeBase(src),
+				_summary(src._summary) {}
+
+			~RBT_AugmentedNodeBase(void) {}
+
+			RBT_AugmentedNodeBase & operator=(RBT_AugmentedNodeBase const & rhs) {
+				if (this == &rhs) return *this;
+
+				RBT_NodeBase::operator=(rhs);
+				_summary = rhs._summary;
+				return *this;
+			}
+
+		/* member function: links / color */
+
+			RBT_AugmentedNodeBase *	left(void) const { return static_cast<RBT_AugmentedNodeBase *>(RBT_NodeBase::left()); }
+
+			RBT_AugmentedNodeBase *	right(void) const { return static_cast<RBT_AugmentedNodeBase *>(RBT_NodeBase::right()); }
+
+			RBT_AugmentedNodeBase *	parent(void) const { return static_cast<RBT_AugmentedNodeBase *>(RBT_NodeBase::parent()); }
+
+		/* member function: augmentation */
+
+			summary_type const &	summary(void) const { return _summary; }
+
+			template < class V >
+			void					update(V const & val) {
+				_summary = Policy::combine(Policy::combine(summaryOf(left()), Policy::summarize(val)), summaryOf(right()));
+			}
+
+			static summary_type		summaryOf(RBT_AugmentedNodeBase const * node) {
+				return node == ft_nullptr ? Policy::identity() : node->_summary;
+			}
+	};
+
 /**
  * @class template: RBT_Node
  */
 
 	/**
 	 * @brief Red Black Tree Node
+	 * @note the links come first so no padding sits between them and the value.
+	 * the links are typed as Base: a node is reached from a link with a static_cast.
+	 * the value is reached through value(), as with every node type of the tree.
+	 * 
+	 * @param T: type of the value.
+	 * @param Base: links of the node, RBT_NodeBase or RBT_SizedNodeBase (order statistics).
 	 */
-	template < class T >
-	struct RBT_Node {
+	template < class T, class Base = RBT_NodeBase >
+	struct RBT_Node : public Base {
 		/* member types */
 		
 			typedef T		value_type;
-		#if defined(__APPLE__) && defined(__MACH__)
-			typedef bool	size_type;
-
-		#else
-			typedef size_t	size_type;	
-
-		#endif
-			
 
 		/* attributes */
 
 			value_type	val;
-			size_type	color;
-			RBT_Node	*parent;
-			RBT_Node	*left;
-			RBT_Node	*right;
-			
 
 		/* member function: constructor / destructor / operator=  */
 
 			RBT_Node(void) :
-				val(),
-				color(BLACK_NODE),
-				parent(ft_nullptr),
-				left(ft_nullptr),
-				right(ft_nullptr) {}
+				Base(),
+				val() {}
 			
 			RBT_Node(value_type const & val,
 				bool color = BLACK_NODE,
-				RBT_Node *parent = ft_nullptr,
-				RBT_Node *left = ft_nullptr,
-				RBT_Node *right = ft_nullptr) :
-					val(val),
-					color(color),
-					parent(parent),
-					left(left),
-					right(right) {}
+				Base *parent = ft_nullptr,
+				Base *left = ft_nullptr,
+				Base *right = ft_nullptr) :
+					Base(color, parent, left, right),
+					val(val) {}
 
 			RBT_Node(RBT_Node const & src) :
-				val(src.val),
-				color(src.color),
-				parent(src.parent),
-				left(src.left),
-				right(src.right) {}
+				Base(src),
+				val(src.val) {}
 
 			~RBT_Node(void) {}
 
 			RBT_Node & operator=(RBT_Node const & rhs) {
 				if (this == &rhs) return *this;
 
+				Base::operator=(rhs);
 				val = rhs.val;
-				color = rhs.color;
-				parent = rhs.parent;
-				left = rhs.left;
-				right = rhs.right;
 				return *this;
 			}
 
+		/* member function: value */
+
+			value_type &		value(void) { return val; }
+
+			value_type const &	value(void) const { return val; }
+
+		/* member function: augmentation */
+
+			/** @brief refresh what the links keep about the subtree, from the children and the value */
+			void	update(void) { Base::update(val); }
+
 		/* member function: operator==  */
 
 			bool operator==(RBT_Node const & rhs) {
@@ -101,458 +368,2101 @@ _BEGIN_NS_FT
 	};
 
 /**
- * @class template: RBT
+ * @class template: RBT_IndexNode
  */
 
 	/**
-	 * @brief Red Black Tree
+	 * @brief Red Black Tree Node linked by 32-bit indices
+	 * @note same interface as RBT_Node, but each link is the (signed) distance in nodes
+	 * from this node to the linked one: all the nodes of a tree must live in one array (see indexPool),
+	 * which can then be moved or written out as a whole without fixing any link.
+	 * the color is the low bit of the parent link (distance * 2 + color), a node is never its own parent
+	 * so 0 means no parent. a child link can be the node itself (the header of an empty tree), NO_LINK means none.
+	 * a copy takes the value and the color, not the links (they are only meaningful at their own place).
+	 * it is its own base: the header of the tree is a node of the same array, built by the default constructor
+	 * which leaves the value raw, so value_type needs no default constructor. the header is never destroyed,
+	 * its slot is just given back with the array (see indexPool).
 	 */
-	template < class T,
-		class Compare,
-		class Node = ft::RBT_Node<T>,
-		class AllocNode = std::allocator<Node> >
-	class RBT {
-		public:
+	template < class T >
+	struct RBT_IndexNode {
 		/* member types */
 
-			typedef				T										value_type;
-			typedef				Node									node_type;
+			typedef T				value_type;
+			typedef size_t			size_type;
+			typedef RBT_IndexNode	base_type;
 
-			typedef				Compare									value_compare;
+			static const bool		augmented = false;
+			typedef void			summary_type;
 
-			typedef				AllocNode								allocator_type;
-			typedef	typename	allocator_type::reference				reference;
-			typedef	typename	allocator_type::const_reference			const_reference;
-			typedef	typename	allocator_type::pointer					pointer;
-			typedef	typename	allocator_type::const_pointer			const_pointer;
+		/* attributes */
 
-			/** @note usually the same as ptrdiff_t */
-			typedef	typename	allocator_type::difference_type			difference_type;
-			/** @note usually the same as size_t */
-			typedef	typename	allocator_type::size_type				size_type;
+		private:
+			int			_left;
+			int			_right;
+			int			_parentColor;
+
+			ft::raw_storage<value_type>	_val;
 
 		public:
-		/* member function: constructor / destructor  */
+		/* member function: constructor / destructor / operator=  */
 
-			RBT(value_compare const & comp = value_compare()) : _comp(comp) {
-				_null = allocator_type().allocate(1);
-				allocator_type().construct(_null, node_type());
-				_root = _null;
+			/** @brief a header: links only, the value is not constructed */
+			RBT_IndexNode(void) :
+				_left(NO_LINK),
+				_right(NO_LINK),
+				_parentColor(BLACK_NODE) {}
+
+			RBT_IndexNode(value_type const & val, bool color = BLACK_NODE) :
+				_left(NO_LINK),
+				_right(NO_LINK),
+				_parentColor(color) {
+				new (static_cast<void *>(_val.bytes)) value_type(val);
 			}
 
-			~RBT() {}
-
-		/* member function: getters  */
+			/** @note src holds a value (it is not a header) */
+			RBT_IndexNode(RBT_IndexNode const & src) :
+				_left(NO_LINK),
+				_right(NO_LINK),
+				_parentColor(src.color()) {
+				new (static_cast<void *>(_val.bytes)) value_type(src.value());
+			}
 
-			pointer	getRoot() const { return _root; }
+			/** @note never called on a header */
+			~RBT_IndexNode(void) { value().~value_type(); }
 
-			pointer	getNull() const { return _null; }
+			RBT_IndexNode & operator=(RBT_IndexNode const & rhs) {
+				if (this == &rhs) return *this;
 
-		/* member function: capacity  */
+				setColor(rhs.color());
+				value() = rhs.value();
+				return *this;
+			}
 
-			size_type	size() const { return size(_root); }
+		/* member function: value */
 
-			size_type	max_size() const { return allocator_type().max_size(); }
+			value_type &		value(void) { return *_val.get(); }
 
-		/* member function: operation  */
+			value_type const &	value(void) const { return *_val.get(); }
 
-			pointer	searchTree(value_type val) const { return searchTreeHelper(_root, val); }
+		/* member function: links / color */
 
-			pointer	min() const { return min(_root); }
+			RBT_IndexNode *	left(void) const { return at(_left); }
 
-			pointer	max() const { return max(_root); }
+			RBT_IndexNode *	right(void) const { return at(_right); }
 
-			pointer lower_bound(value_type const & val) const {
-				pointer begin = min();
+			RBT_IndexNode *	parent(void) const {
+				int distance = (_parentColor - static_cast<int>(color())) / 2;
 
-				while (begin != _null) {
-					if (_comp(begin->val, val) == false)
-						break ;
-					begin = successor(begin);
-				}
-				return begin;
+				return distance == 0 ? ft_nullptr : at(distance);
 			}
 
-			pointer upper_bound(value_type const & val) const {
-				pointer begin = min();
-
-				while (begin != _null) {
-					if (_comp(val, begin->val) == true)
-						break ;
-					begin = successor(begin);
-				}
-				return begin;
-			}
+			size_type		color(void) const { return _parentColor & 1; }
 
-		/* member function: modifiers  */
+			void			setLeft(RBT_IndexNode * left) { _left = linkTo(left); }
 
-			void	swap(RBT & toSwap) {
-				pointer root_ = _root;
-				pointer null_ = _null;
+			void			setRight(RBT_IndexNode * right) { _right = linkTo(right); }
 
-				_root = toSwap.getRoot();
-				_null = toSwap.getNull();
+			void			setParent(RBT_IndexNode * parent) {
+				int distance = parent == ft_nullptr ? 0 : static_cast<int>(parent - this);
 
-				toSwap._root = root_;
-				toSwap._null = null_;
+				_parentColor = distance * 2 + static_cast<int>(color());
 			}
 
-			bool	insert(value_type const & val) {
-				pointer toInsert = allocator_type().allocate(1);
-				allocator_type().construct(toInsert, node_type(val, RED_NODE, ft_nullptr, _null, _null)); // new node must be red
+			void			setColor(size_type color) { _parentColor += static_cast<int>(color) - static_cast<int>(this->color()); }
 
-				pointer current = ft_nullptr;
-				pointer root = _root;
+			/** @note only the color: an index node is balanced as a red black tree */
+			size_type		state(void) const { return color(); }
 
-				while (root != _null) {
-					current = root;
-					if (_comp(toInsert->val, root->val))
-						root = root->left;
-					else if (_comp(root->val, toInsert->val))
-						root = root->right;
-					else {
-						allocator_type().destroy(toInsert);
-						allocator_type().deallocate(toInsert, 1);
-						return false;
-					}
-				}
+			void			setState(size_type state) { setColor(state); }
 
-				toInsert->parent = current;
-				if (current == ft_nullptr)
-					_root = toInsert;
-				else if (_comp(toInsert->val, current->val))
-					current->left = toInsert;
-				else
-					current->right = toInsert;
+			/** @brief take the links of src as they are: src was at the same place in another array */
+			void			copyLinks(RBT_IndexNode const & src) {
+				_left = src._left;
+				_right = src._right;
+				_parentColor = src._parentColor;
+			}
 
-				if (toInsert->parent == ft_nullptr) {
-					toInsert->color = BLACK_NODE;
-					return true;
-				}
+		/* member function: augmentation */
 
-				if (toInsert->parent->parent == ft_nullptr)
-					return true;
+			void			update(void) {}
 
-				fixInsert(toInsert);
-				return true;
+		/* member function: operator==  */
+
+			bool operator==(RBT_IndexNode const & rhs) {
+				if (value() == rhs.value())
+					return true;
+				return false;
 			}
 
-			bool	deleteNode(value_type const & val) { return deleteNodeHelper(_root, val); }
+		private:
+		/* member function (private) */
+
+			static const int NO_LINK = INT_MIN;
 
-			void	destroyTree() {
-				destroyTree(_root);
-				_root = _null;
+			RBT_IndexNode *	at(int distance) const {
+				if (distance == NO_LINK)
+					return ft_nullptr;
+				return const_cast<RBT_IndexNode *>(this) + distance;
 			}
 
-			void	destroyNull() {
-				allocator_type().destroy(_null);
-				allocator_type().deallocate(_null, 1);
+			int				linkTo(RBT_IndexNode * node) const {
+				return node == ft_nullptr ? NO_LINK : static_cast<int>(node - this);
 			}
+	};
 
-		/* member function: iteration  */
+/**
+ * @class template: RBT_links_of / RBT_node_of / RBT_pool_of / RBT_node_handles_need_RBT_NodeStorage
+ */
 
-			pointer	successor(pointer node) const {
-				if (node->right != _null)
-					return min(node->right);
+	struct RBT_RedBlack;
+	struct RBT_AVL;
+	struct RBT_WeightBalanced;
+	struct RBT_Splay;
 
-				if (node->parent == ft_nullptr || node == max())
-					return _null;
-				pointer tmp = node->parent;
-				while (tmp != _null && node == tmp->right) {
-					node = tmp;
-					tmp = tmp->parent;
-				}
-				return tmp;
-			}
+	/**
+	 * @brief links of the nodes of a tree, from the balancing and the augmentation given to the container
+	 * @note Augment as is: RBT_NodeBase (nothing about the subtree), RBT_SizedNodeBase (its size, order statistics)
+	 * or RBT_AugmentedNodeBase<Policy> (its summary). RBT_WeightBalanced balances on the sizes of the subtrees:
+	 * it takes RBT_SizedNodeBase for RBT_NodeBase, and has no links (a compile error) along with summaries.
+	 */
+	template < class Balance, class Augment >
+	struct RBT_links_of { typedef Augment type; };
 
-			pointer	predecessor(pointer node) const {
-				if (node->left != _null)
-					return max(node->left);
+	template < >
+	struct RBT_links_of< ft::RBT_WeightBalanced, ft::RBT_NodeBase > { typedef ft::RBT_SizedNodeBase type; };
 
-				if (node->parent == ft_nullptr || node == min())
-					return _null;
-				pointer	tmp = node->parent;
-				while (tmp != _null && node == tmp->left) {
-					node = tmp;
-					tmp = tmp->parent;
-				}
-				return tmp;
-			}
+	template < class Policy >
+	struct RBT_links_of< ft::RBT_WeightBalanced, ft::RBT_AugmentedNodeBase<Policy> > {};
 
-		private:
-		/* member function (private): capacity  */
-	
-			size_type size(pointer root) const {
-				if (root == _null)
-					return 0;
-				return size(root->left) + 1 + size(root->right);
-			}
+	/** @brief node storage: RBT_Node with pointer links, kept in a nodePool (the default) */
+	struct RBT_NodeStorage {};
 
-		/* member function (private): operation  */
+	/**
+	 * @brief index storage: RBT_IndexNode with 32-bit relative links, kept in one array (an indexPool)
+	 * @note the price is the one of a vector: growing the array moves the nodes,
+	 * so an insertion invalidates iterators and references unless reserve() made room first.
+	 * the parent link holds the distance and the color in one int (distance * 2 + color):
+	 * the array is capped at INDEX_POOL_MAX_CAPACITY (2^30) slots, so such a tree holds at most 2^30 - 1 elements.
+	 */
+	struct RBT_IndexStorage {};
 
-			pointer	searchTreeHelper(pointer node, value_type const & val) const {
-				if (node == _null)
-					return node;
-				else if (_comp(val, node->val))
-					return searchTreeHelper(node->left, val);
-				else if (_comp(node->val, val))
-					return searchTreeHelper(node->right, val);
-				else
-					return node;
-			}
+	/**
+	 * @brief node of a tree, chosen from the balancing, the augmentation and the storage given to the container
+	 * @note RBT_NodeStorage selects RBT_Node with the links of RBT_links_of.
+	 * RBT_IndexStorage selects RBT_IndexNode for a red black tree without augmentation
+	 * (no room for another state), and no node type otherwise.
+	 */
+	template < class T, class Balance = ft::RBT_RedBlack, class Augment = ft::RBT_NodeBase, class Storage = ft::RBT_NodeStorage >
+	struct RBT_node_of { typedef ft::RBT_Node<T, typename ft::RBT_links_of<Balance, Augment>::type> type; };
 
-			pointer	min(pointer node) const {
-				if (node == ft_nullptr || node == _null)
-					return _null;
-				while (node->left != _null)
-					node = node->left;
-				return node;
-			}
+	template < class T, class Balance, class Augment >
+	struct RBT_node_of< T, Balance, Augment, ft::RBT_IndexStorage > {};
 
-			pointer	max(pointer node) const {
-				if (node == ft_nullptr || node == _null)
-					return _null;
-				while (node->right != _null)
-					node = node->right;
-				return node;
-			}
+	template < class T >
+	struct RBT_node_of< T, ft::RBT_RedBlack, ft::RBT_NodeBase, ft::RBT_IndexStorage > { typedef ft::RBT_IndexNode<T> type; };
 
-		/* member function (private): modifiers  */
+	/** @brief pool of the nodes of a tree: an indexPool for RBT_IndexNode, a nodePool otherwise */
+	template < class Node, class Alloc >
+	struct RBT_pool_of { typedef ft::nodePool<Node, Alloc> type; };
 
-			void	leftRotate(pointer node) {
-				pointer	tmp = node->right;
-				
-				node->right = tmp->left;
-				if (tmp->left != _null)
-					tmp->left->parent = node;
-	
-				tmp->parent = node->parent;
-				if (node->parent == ft_nullptr)
-					_root = tmp;
-				else if (node == node->parent->left)
-					node->parent->left = tmp;
-				else
-					node->parent->right = tmp;
+	template < class T, class Alloc >
+	struct RBT_pool_of< ft::RBT_IndexNode<T>, Alloc > { typedef ft::indexPool<ft::RBT_IndexNode<T>, Alloc> type; };
+
+	/**
+	 * @brief compile-time check of the node handles (extract(), insert(node_type)): they need RBT_NodeStorage
+	 * @note an RBT_IndexNode cannot leave its array (relative links): the check is left undefined for it,
+	 * so the error names the requirement instead of failing in the pool or the handle.
+	 */
+	template < class Node >
+	struct RBT_node_handles_need_RBT_NodeStorage { static void check(void) {} };
+
+	template < class T >
+	struct RBT_node_handles_need_RBT_NodeStorage< ft::RBT_IndexNode<T> >;
+
+/**
+ * @function template: RBT_increment / RBT_decrement
+ */
+
+	/**
+	 * @brief in-order successor of a node
+	 * @note the tree is built around a header node: header->parent() is the root,
+	 * header->left() the leftmost node and header->right() the rightmost node,
+	 * and the root's parent is the header. leaves are ft_nullptr.
+	 * the successor of the rightmost node is the header (i.e. end()).
+	 * amortized O(1) over a full traversal, never goes back to the root.
+	 * 
+	 * @param node: a node of the tree (not the header).
+	 * @return the next node in order, or the header.
+	 */
+	template < class Node >
+	Node *	RBT_increment(Node * node) {
+		if (node->right() != ft_nullptr) {
+			node = node->right();
+			while (node->left() != ft_nullptr)
+				node = node->left();
+			return node;
+		}
+
+		Node * tmp = node->parent();
+		while (node == tmp->right()) {
+			node = tmp;
+			tmp = tmp->parent();
+		}
+		// when the root is the rightmost node, node ends on the header
+		if (node->right() != tmp)
+			node = tmp;
+		return node;
+	}
+
+	/**
+	 * @brief in-order predecessor of a node
+	 * @note the predecessor of the header (i.e. end()) is the rightmost node.
+	 * the header is recognized without knowing the tree: it is red, and the parent of its parent
+	 * (the root) is itself, which cannot happen to a red node of the tree.
+	 * 
+	 * @param node: a node of the tree or the header of a non empty tree.
+	 * @return the previous node in order.
+	 */
+	template < class Node >
+	Node *	RBT_decrement(Node * node) {
+		if (node->color() == RED_NODE && node->parent() != ft_nullptr && node->parent()->parent() == node)
+			return node->right();
+
+		if (node->left() != ft_nullptr) {
+			node = node->left();
+			while (node->right() != ft_nullptr)
+				node = node->right();
+			return node;
+		}
+
+		Node * tmp = node->parent();
+		while (node == tmp->left()) {
+			node = tmp;
+			tmp = tmp->parent();
+		}
+		return tmp;
+	}
+
+	/**
+	 * @brief number of increments from first to last
+	 * @note O(n) walk, or O(log n) with the sizes of the subtrees (RBT_SizedNodeBase).
+	 */
+	template < class Node >
+	ptrdiff_t	RBT_distance(Node * first, Node * last) {
+		ptrdiff_t n = 0;
+
+		for (; first != last; first = RBT_increment(first))
+			++n;
+		return n;
+	}
+
+	inline ptrdiff_t	RBT_distance(RBT_SizedNodeBase * first, RBT_SizedNodeBase * last) {
+		return static_cast<ptrdiff_t>(RBT_SizedNodeBase::rankOf(last)) - static_cast<ptrdiff_t>(RBT_SizedNodeBase::rankOf(first));
+	}
+
+/**
+ * @class: RBT_RedBlack / RBT_AVL / RBT_WeightBalanced / RBT_Splay
+ */
+
+	/*
+	 * a balancing policy keeps a tree balanced through the state of its nodes (see RBT_NodeBase),
+	 * with the rotations of the tree (RBT::leftRotate / RBT::rightRotate), and provides:
+	 *  - joinable: whether split / join are available, for the set operations in O(m log(n / m + 1))
+	 *  - linked(tree, node): node was just linked as a leaf (its state is to be set), rebalance
+	 *  - unlinked(tree, parent, fromLeft, state): a node of the given state left the tree,
+	 *    the subtree of parent on the left / right side (fromLeft) got one node less, rebalance
+	 *  - built(node, depth, redDepth, nLeft, nRight): set the state of a node of a tree built at once,
+	 *    where depth is the one of the node, levels [0, redDepth) are full,
+	 *    and the two balanced subtrees of the node hold nLeft and nRight nodes
+	 *  - accessed(tree, node): a lookup found node (see RBT::access), nothing to do unless self-adjusting
+	 */
+
+	/**
+	 * @brief red black balancing, the default
+	 * @note at most 2 log n deep, O(1) rotations per insertion / deletion (amortized O(1) recoloring).
+	 */
+	struct RBT_RedBlack {
+		/* member types */
+
+			static const bool	joinable = true;
 
-				tmp->left = node;
-				node->parent = tmp;
+		/* member function: balancing */
+
+			template < class Tree >
+			static void	linked(Tree & tree, typename Tree::pointer node) {
+				node->setColor(RED_NODE); // new node must be red
+				fixInsert(tree, node);
 			}
 
-			void	rightRotate(pointer node) {
-				pointer	tmp = node->left;
-				
-				node->left = tmp->right;
-				if (tmp->right != _null)
-					tmp->right->parent = node;
-
-				tmp->parent = node->parent;
-				if (node->parent == ft_nullptr)
-					_root = tmp;
-				else if (node == node->parent->right)
-					node->parent->right = tmp;
+			template < class Tree >
+			static void	unlinked(Tree & tree, typename Tree::pointer parent, bool fromLeft, size_t state) {
+				if (state != BLACK_NODE || tree.getRoot() == ft_nullptr)
+					return ;
+				if (parent == tree.getHeader())
+					fixDelete(tree, tree.getRoot(), parent);
 				else
-					node->parent->left = tmp;
+					fixDelete(tree, fromLeft ? parent->left() : parent->right(), parent);
+			}
 
-				tmp->right = node;
-				node->parent = tmp;
+			template < class Node >
+			static void	built(Node * node, size_t depth, size_t redDepth, size_t, size_t) {
+				node->setColor(depth == redDepth ? RED_NODE : BLACK_NODE);
 			}
 
-			void	fixInsert(pointer toFix) {
-				pointer	tmp;
-				
-				while (toFix->parent->color == RED_NODE) {
-					if (toFix->parent == toFix->parent->parent->right) {
-						tmp = toFix->parent->parent->left;
-						if (tmp->color == RED_NODE) {
-							tmp->color = BLACK_NODE;
-							toFix->parent->color = BLACK_NODE;
-							toFix->parent->parent->color = RED_NODE;
-							toFix = toFix->parent->parent;
+			template < class Tree >
+			static void	accessed(Tree &, typename Tree::pointer) {}
+
+			/** @return whether the black height of the tree grew (the recoloring reached the root) */
+			template < class Tree >
+			static bool	fixInsert(Tree & tree, typename Tree::pointer toFix) {
+				typename Tree::pointer	tmp;
+
+				while (toFix != tree.getRoot() && toFix->parent()->color() == RED_NODE) {
+					if (toFix->parent() == toFix->parent()->parent()->right()) {
+						tmp = toFix->parent()->parent()->left();
+						if (isBlack(tmp) == false) {
+							tmp->setColor(BLACK_NODE);
+							toFix->parent()->setColor(BLACK_NODE);
+							toFix->parent()->parent()->setColor(RED_NODE);
+							toFix = toFix->parent()->parent();
 						}
 						else {
-							if (toFix == toFix->parent->left) {
-								toFix = toFix->parent;
-								rightRotate(toFix);
+							if (toFix == toFix->parent()->left()) {
+								toFix = toFix->parent();
+								tree.rightRotate(toFix);
 							}
-							toFix->parent->color = BLACK_NODE;
-							toFix->parent->parent->color = RED_NODE;
-							leftRotate(toFix->parent->parent);
+							toFix->parent()->setColor(BLACK_NODE);
+							toFix->parent()->parent()->setColor(RED_NODE);
+							tree.leftRotate(toFix->parent()->parent());
 						}
 					}
 					else {
-						tmp = toFix->parent->parent->right;
+						tmp = toFix->parent()->parent()->right();
 
-						if (tmp->color == RED_NODE) {
-							tmp->color = BLACK_NODE;
-							toFix->parent->color = BLACK_NODE;
-							toFix->parent->parent->color = RED_NODE;
-							toFix = toFix->parent->parent;	
+						if (isBlack(tmp) == false) {
+							tmp->setColor(BLACK_NODE);
+							toFix->parent()->setColor(BLACK_NODE);
+							toFix->parent()->parent()->setColor(RED_NODE);
+							toFix = toFix->parent()->parent();
 						}
 						else {
-							if (toFix == toFix->parent->right) {
-								toFix = toFix->parent;
-								leftRotate(toFix);
+							if (toFix == toFix->parent()->right()) {
+								toFix = toFix->parent();
+								tree.leftRotate(toFix);
 							}
-							toFix->parent->color = BLACK_NODE;
-							toFix->parent->parent->color = RED_NODE;
-							rightRotate(toFix->parent->parent);
+							toFix->parent()->setColor(BLACK_NODE);
+							toFix->parent()->parent()->setColor(RED_NODE);
+							tree.rightRotate(toFix->parent()->parent());
 						}
 					}
-					if (toFix == _root)
-						break ;
 				}
-				_root->color = BLACK_NODE;
+				tree.getRoot()->setColor(BLACK_NODE);
+				return toFix == tree.getRoot();
 			}
 
-			void	fixDelete(pointer toFix) {
-				pointer	tmp;
-
-				while (toFix != _root && toFix->color == BLACK_NODE) {
-					if (toFix == toFix->parent->left) {
-						tmp = toFix->parent->right;
-						if (tmp->color == RED_NODE) {
-							tmp->color = BLACK_NODE;
-							toFix->parent->color = RED_NODE;
-							leftRotate(toFix->parent);
-							tmp = toFix->parent->right;
+			/** @note toFix may be ft_nullptr (a leaf), so its parent is given aside */
+			template < class Tree >
+			static void	fixDelete(Tree & tree, typename Tree::pointer toFix, typename Tree::pointer parent) {
+				typename Tree::pointer	tmp;
+
+				while (toFix != tree.getRoot() && isBlack(toFix)) {
+					if (toFix == parent->left()) {
+						tmp = parent->right();
+						if (tmp->color() == RED_NODE) {
+							tmp->setColor(BLACK_NODE);
+							parent->setColor(RED_NODE);
+							tree.leftRotate(parent);
+							tmp = parent->right();
 						}
 
-						if (tmp->left->color == BLACK_NODE && tmp->right->color == BLACK_NODE) {
-							tmp->color = RED_NODE;
-							toFix = toFix->parent;
+						if (isBlack(tmp->left()) && isBlack(tmp->right())) {
+							tmp->setColor(RED_NODE);
+							toFix = parent;
+							parent = parent->parent();
 						}
 						else {
-							if (tmp->right->color == BLACK_NODE) {
-								tmp->left->color = BLACK_NODE;
-								tmp->color = RED_NODE;
-								rightRotate(tmp);
-								tmp = toFix->parent->right;
+							if (isBlack(tmp->right())) {
+								tmp->left()->setColor(BLACK_NODE);
+								tmp->setColor(RED_NODE);
+								tree.rightRotate(tmp);
+								tmp = parent->right();
 							}
-							tmp->color = toFix->parent->color;
-							toFix->parent->color = BLACK_NODE;
-							tmp->right->color = BLACK_NODE;
-							leftRotate(toFix->parent);
-							toFix = _root;
+							tmp->setColor(parent->color());
+							parent->setColor(BLACK_NODE);
+							tmp->right()->setColor(BLACK_NODE);
+							tree.leftRotate(parent);
+							toFix = tree.getRoot();
 						}
 					}
 					else {
-						tmp = toFix->parent->left;
-						if (tmp->color == RED_NODE) {
-							tmp->color = BLACK_NODE;
-							toFix->parent->color = RED_NODE;
-							rightRotate(toFix->parent);
-							tmp = toFix->parent->left;
+						tmp = parent->left();
+						if (tmp->color() == RED_NODE) {
+							tmp->setColor(BLACK_NODE);
+							parent->setColor(RED_NODE);
+							tree.rightRotate(parent);
+							tmp = parent->left();
 						}
 
-						if (tmp->left->color == BLACK_NODE && tmp->right->color == BLACK_NODE) {
-							tmp->color = RED_NODE;
-							toFix = toFix->parent;
+						if (isBlack(tmp->left()) && isBlack(tmp->right())) {
+							tmp->setColor(RED_NODE);
+							toFix = parent;
+							parent = parent->parent();
 						}
 						else {
-							if (tmp->left->color == BLACK_NODE) {
-								tmp->right->color = BLACK_NODE;
-								tmp->color = RED_NODE;
-								leftRotate(tmp);
-								tmp = toFix->parent->left;
-							} 
-
-							tmp->color = toFix->parent->color;
-							toFix->parent->color = BLACK_NODE;
-							tmp->left->color = BLACK_NODE;
-							rightRotate(toFix->parent);
-							toFix = _root;
+							if (isBlack(tmp->left())) {
+								tmp->right()->setColor(BLACK_NODE);
+								tmp->setColor(RED_NODE);
+								tree.leftRotate(tmp);
+								tmp = parent->left();
+							}
+
+							tmp->setColor(parent->color());
+							parent->setColor(BLACK_NODE);
+							tmp->left()->setColor(BLACK_NODE);
+							tree.rightRotate(parent);
+							toFix = tree.getRoot();
 						}
-					} 
+					}
+				}
+				if (toFix != ft_nullptr)
+					toFix->setColor(BLACK_NODE);
+			}
+
+		private:
+		/* member function (private) */
+
+			template < class Node >
+			static bool	isBlack(Node * node) { return node == ft_nullptr || node->color() == BLACK_NODE; }
+	};
+
+	/**
+	 * @brief AVL balancing: the heights of the two subtrees of a node differ by 1 at most
+	 * @note at most 1.44 log n deep. the balance factor of every node is kept in its state (see RBT_NodeBase),
+	 * an insertion retraces the heights up to the first node which does not grow (one rotation at most),
+	 * a deletion up to the first node which does not shrink (O(log n) rotations at worst).
+	 * no black height to join on: the set operations go node by node.
+	 */
+	struct RBT_AVL {
+		/* member types */
+
+			static const bool	joinable = false;
+
+		/* member function: balancing */
+
+			template < class Tree >
+			static void	linked(Tree & tree, typename Tree::pointer node) {
+				typename Tree::pointer	parent = node->parent();
+				bool					shrank;
+
+				node->setBalance(0);
+				for (; parent != tree.getHeader(); node = parent, parent = parent->parent()) {
+					int balance = parent->balance() + (node == parent->left() ? -1 : 1);
+
+					if (balance == 0) {
+						parent->setBalance(0);
+						return ;
+					}
+					if (balance == 2 || balance == -2) {
+						rebalance(tree, parent, balance, shrank);
+						return ;
+					}
+					parent->setBalance(balance); // the subtree of parent grew, so does the one above
+				}
+			}
+
+			template < class Tree >
+			static void	unlinked(Tree & tree, typename Tree::pointer parent, bool fromLeft, size_t) {
+				bool	shrank;
+
+				while (parent != tree.getHeader()) {
+					int balance = parent->balance() + (fromLeft ? 1 : -1);
+
+					if (balance == 1 || balance == -1) {
+						parent->setBalance(balance); // the subtree of parent kept its height
+						return ;
+					}
+					if (balance == 0)
+						parent->setBalance(0);
+					else {
+						parent = rebalance(tree, parent, balance, shrank);
+						if (shrank == false)
+							return ;
+					}
+					fromLeft = parent == parent->parent()->left();
+					parent = parent->parent();
+				}
+			}
+
+			template < class Node >
+			static void	built(Node * node, size_t, size_t, size_t nLeft, size_t nRight) {
+				// a subtree of n nodes built at once is bitLength(n) high
+				node->setBalance(static_cast<int>(bitLength(nRight)) - static_cast<int>(bitLength(nLeft)));
+			}
+
+			template < class Tree >
+			static void	accessed(Tree &, typename Tree::pointer) {}
+
+		private:
+		/* member function (private) */
+
+			/**
+			 * @brief rotate a node whose balance reached -2 / 2
+			 * @return the new root of the subtree, shrank tells whether the subtree lost height.
+			 */
+			template < class Tree >
+			static typename Tree::pointer	rebalance(Tree & tree, typename Tree::pointer node, int balance, bool & shrank) {
+				typename Tree::pointer	child = balance > 0 ? node->right() : node->left();
+				int						side = balance > 0 ? 1 : -1;
+
+				if (child->balance() != -side) {
+					rotate(tree, node, side);
+					shrank = child->balance() != 0;
+					node->setBalance(shrank ? 0 : side);
+					child->setBalance(shrank ? 0 : -side);
+					return child;
+				}
+
+				typename Tree::pointer	mid = side > 0 ? child->left() : child->right();
+				int						midBalance = mid->balance();
+
+				rotate(tree, child, -side);
+				rotate(tree, node, side);
+				node->setBalance(midBalance == side ? -side : 0);
+				child->setBalance(midBalance == -side ? side : 0);
+				mid->setBalance(0);
+				shrank = true;
+				return mid;
+			}
+
+			/** @note left rotation for a right heavy node (side 1), right rotation for a left heavy one */
+			template < class Tree >
+			static void	rotate(Tree & tree, typename Tree::pointer node, int side) {
+				if (side > 0)
+					tree.leftRotate(node);
+				else
+					tree.rightRotate(node);
+			}
+
+			static size_t	bitLength(size_t n) {
+				size_t length = 0;
+
+				for (; n != 0; n >>= 1)
+					++length;
+				return length;
+			}
+	};
+
+	/**
+	 * @brief weight balanced (BB[alpha]) balancing, on the sizes of the subtrees
+	 * @note the weight of a subtree is its size + 1, neither side of a node may weigh more than DELTA times the other.
+	 * the sizes are the ones of RBT_SizedNodeBase, so the tree has order statistics for free.
+	 * every node on the path from a linked / unlinked node is checked, with one single or double rotation at most,
+	 * for the parameters <DELTA, RATIO> = <3, 2> (Hirai and Yamamoto, "Balancing weight-balanced trees", 2011).
+	 * at most log n / log(4 / 3), about 2.4 log n, deep. no black height to join on: the set operations go node by node.
+	 */
+	struct RBT_WeightBalanced {
+		/* member types */
+
+			static const bool	joinable = false;
+
+		/* member function: balancing */
+
+			template < class Tree >
+			static void	linked(Tree & tree, typename Tree::pointer node) {
+				node->setColor(BLACK_NODE);
+				fix(tree, node->parent());
+			}
+
+			template < class Tree >
+			static void	unlinked(Tree & tree, typename Tree::pointer parent, bool, size_t) { fix(tree, parent); }
+
+			/** @note the two sides of a tree built at once differ by one node at most */
+			template < class Node >
+			static void	built(Node * node, size_t, size_t, size_t, size_t) { node->setColor(BLACK_NODE); }
+
+			template < class Tree >
+			static void	accessed(Tree &, typename Tree::pointer) {}
+
+		private:
+		/* member function (private) */
+
+			static const size_t	DELTA = 3;
+			static const size_t	RATIO = 2;
+
+			template < class Node >
+			static size_t	weight(Node * node) { return Node::countOf(node) + 1; }
+
+			template < class Tree >
+			static void	fix(Tree & tree, typename Tree::pointer node) {
+				for (; node != tree.getHeader(); node = node->parent()) {
+					if (DELTA * weight(node->left()) < weight(node->right())) {
+						typename Tree::pointer right = node->right();
+
+						if (weight(right->left()) >= RATIO * weight(right->right()))
+							tree.rightRotate(right);
+						tree.leftRotate(node);
+						node = node->parent();
+					}
+					else if (DELTA * weight(node->right()) < weight(node->left())) {
+						typename Tree::pointer left = node->left();
+
+						if (weight(left->right()) >= RATIO * weight(left->left()))
+							tree.leftRotate(left);
+						tree.rightRotate(node);
+						node = node->parent();
+					}
+				}
+			}
+	};
+
+	/**
+	 * @brief splay balancing: self-adjusting, no balance kept at all
+	 * @note a node linked or found by a lookup of a non-const map / set (find, operator[], lower_bound, upper_bound
+	 * and equal_range) is splayed to the root (rotations by pairs, bottom-up),
+	 * after a deletion the parent of the node taken out is. O(log n) amortized per operation, any single one
+	 * may be O(n): the tree can be a path for a while (e.g. after sorted insertions), which it walks without recursion.
+	 * a sequence of lookups is as fast as with the best static tree for their frequencies, within a constant factor:
+	 * hot keys are found close to the root. every node is black.
+	 * a lookup changes the shape of the tree: concurrent lookups on a same container need a lock.
+	 */
+	struct RBT_Splay {
+		/* member types */
+
+			static const bool	joinable = false;
+
+		/* member function: balancing */
+
+			template < class Tree >
+			static void	linked(Tree & tree, typename Tree::pointer node) {
+				node->setColor(BLACK_NODE);
+				splay(tree, node);
+			}
+
+			template < class Tree >
+			static void	unlinked(Tree & tree, typename Tree::pointer parent, bool, size_t) {
+				if (parent != tree.getHeader())
+					splay(tree, parent);
+			}
+
+			template < class Node >
+			static void	built(Node * node, size_t, size_t, size_t, size_t) { node->setColor(BLACK_NODE); }
+
+			template < class Tree >
+			static void	accessed(Tree & tree, typename Tree::pointer node) { splay(tree, node); }
+
+		private:
+		/* member function (private) */
+
+			/** @note zig when the parent is the root, zig-zig when node and its parent are on the same side, else zig-zag */
+			template < class Tree >
+			static void	splay(Tree & tree, typename Tree::pointer node) {
+				while (node->parent() != tree.getHeader()) {
+					typename Tree::pointer	parent = node->parent();
+					typename Tree::pointer	grandParent = parent->parent();
+
+					if (grandParent == tree.getHeader())
+						rotateUp(tree, node);
+					else if ((node == parent->left()) == (parent == grandParent->left())) {
+						rotateUp(tree, parent);
+						rotateUp(tree, node);
+					}
+					else {
+						rotateUp(tree, node);
+						rotateUp(tree, node);
+					}
+				}
+			}
+
+			/** @brief rotate node above its parent */
+			template < class Tree >
+			static void	rotateUp(Tree & tree, typename Tree::pointer node) {
+				if (node == node->parent()->left())
+					tree.rightRotate(node->parent());
+				else
+					tree.leftRotate(node->parent());
+			}
+	};
+
+/**
+ * @class template: RBT
+ */
+
+	/**
+	 * @brief Red Black Tree
+	 * @note the tree owns a header node which is the past-the-end position:
+	 *  - header->parent(): root (ft_nullptr if the tree is empty)
+	 *  - header->left(): leftmost node (header if the tree is empty)
+	 *  - header->right(): rightmost node (header if the tree is empty)
+	 * the header is red so it can never be mistaken for the (black) root.
+	 * it is given by the pool: with the default nodePool it is embedded, an empty tree allocates nothing.
+	 * red black by default, the tree is kept balanced by the Balance policy, which sets the state of the nodes:
+	 * whatever the policy, the root is never red.
+	 * 
+	 * @param Key: type of the keys the tree is ordered by.
+	 * @param T: type of the values stored in the nodes.
+	 * @param KeyOfValue: function object returning a (const reference to the) key of a value,
+	 * searches compare keys directly and never build a value_type.
+	 * @param Compare: strict weak ordering on keys.
+	 * @param Balance: balancing policy (RBT_RedBlack, RBT_AVL, RBT_WeightBalanced, RBT_Splay).
+	 */
+	template < class Key,
+		class T,
+		class KeyOfValue,
+		class Compare,
+		class Node = ft::RBT_Node<T>,
+		class AllocNode = std::allocator<Node>,
+		class Balance = ft::RBT_RedBlack >
+	class RBT {
+		public:
+		/* member types */
+
+			typedef				Key										key_type;
+			typedef				T										value_type;
+			typedef				Node									node_type;
+			/** @note the type of the links, the header is one of them (and no more) */
+			typedef typename	node_type::base_type					node_base;
+			/** @note what aggregate() returns, void without RBT_AugmentedNodeBase */
+			typedef typename	node_base::summary_type					summary_type;
+
+			typedef				Compare									key_compare;
+
+			typedef				AllocNode								allocator_type;
+			typedef	typename	allocator_type::reference				reference;
+			typedef	typename	allocator_type::const_reference			const_reference;
+			typedef				node_base*								pointer;
+			typedef	typename	allocator_type::pointer					node_pointer;
+			typedef typename	RBT_pool_of<node_type, allocator_type>::type	pool_type;
+			typedef				Balance									balance_type;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type			difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type				size_type;
+
+		public:
+		/* member function: constructor / destructor  */
+
+			RBT(key_compare const & comp = key_compare(), allocator_type const & alloc = allocator_type()) :
+				_size(0),
+				_comp(comp),
+				_alloc(alloc),
+				_pool(alloc) {
+				_header = _pool.header();
+				resetHeader();
+			}
+
+			/**
+			 * @brief copy: clone the shape and colors of src in O(n), no comparison nor rebalancing
+			 */
+			RBT(RBT const & src) :
+				_size(0),
+				_comp(src._comp),
+				_alloc(src._alloc),
+				_pool(src._alloc) {
+				_header = _pool.header();
+				resetHeader();
+				reserve(src._size);
+				cloneTree(src, ft_nullptr);
+			}
+
+			~RBT() { destroyTree(getRoot()); }
+
+			/**
+			 * @brief copy: clone rhs in O(n), the nodes already owned by the tree are reused before allocating
+			 */
+			RBT &	operator=(RBT const & rhs) {
+				if (this == &rhs) return *this;
+
+				reserve(rhs._size); // no node moves while cloning
+				pointer reuse = flattenTree(getRoot());
+
+				resetHeader();
+				_size = 0;
+				_comp = rhs._comp;
+				cloneTree(rhs, reuse);
+				return *this;
+			}
+
+		/* member function: getters  */
+
+			pointer	getRoot() const { return _header->parent(); }
+
+			pointer	getHeader() const { return _header; }
+
+			/** @brief value held by a node (not the header) */
+			static value_type &	valueOf(pointer node) { return static_cast<node_pointer>(node)->value(); }
+
+			key_compare const &	getComp() const { return _comp; }
+
+			/** @note nodes leaving the tree (extract) take a reference to their storage from the pool */
+			pool_type &			getPool() { return _pool; }
+
+			allocator_type			get_allocator() const { return _alloc; }
+
+		/* member function: capacity  */
+
+			/** @note O(1): the count is kept up to date by insert / delete / destroyTree / swap */
+			size_type	size() const { return _size; }
+
+			bool		empty() const { return _size == 0; }
+
+			/** @note the bound of the node storage: the allocator of the actual (compact) node, capped by the pool */
+			size_type	max_size() const { return _pool.max_size(); }
+
+			/**
+			 * @brief preallocate storage so the tree can hold n elements without asking the allocator
+			 * @note with an indexPool the nodes may move (once), then they stay in place up to n elements.
+			 */
+			void		reserve(size_type n) {
+				if (n > _size) {
+					_pool.reserve(n - _size);
+					_header = _pool.rebase(_header);
 				}
-				toFix->color = BLACK_NODE;
+			}
+
+		/* member function: operation  */
+
+			/** @note the search functions are templates: K is key_type, or any type if the comparator is transparent */
+			template < class K >
+			pointer	searchTree(K const & key) const { return searchTreeHelper(getRoot(), key); }
+
+			/** @note O(1): leftmost node, header if empty */
+			pointer	min() const { return _header->left(); }
+
+			/** @note O(1): rightmost node, header if empty */
+			pointer	max() const { return _header->right(); }
+
+			/** @note O(log n): first node not going before key, header if none */
+			template < class K >
+			pointer lower_bound(K const & key) const {
+				pointer node = getRoot();
+				pointer bound = _header;
+
+				while (node != ft_nullptr) {
+					if (_comp(keyOf(node), key) == false) {
+						bound = node;
+						node = node->left();
+					}
+					else
+						node = node->right();
+				}
+				return bound;
+			}
+
+			/** @note O(log n): first node going after key, header if none */
+			template < class K >
+			pointer upper_bound(K const & key) const {
+				pointer node = getRoot();
+				pointer bound = _header;
+
+				while (node != ft_nullptr) {
+					if (_comp(key, keyOf(node)) == true) {
+						bound = node;
+						node = node->left();
+					}
+					else
+						node = node->right();
+				}
+				return bound;
+			}
+
+			/** @note O(log n) floor: last node not going after key, header if none */
+			template < class K >
+			pointer predecessor_key(K const & key) const {
+				pointer node = getRoot();
+				pointer bound = _header;
+
+				while (node != ft_nullptr) {
+					if (_comp(key, keyOf(node)) == false) {
+						bound = node;
+						node = node->right();
+					}
+					else
+						node = node->left();
+				}
+				return bound;
+			}
+
+			/** @note O(log n) ceiling: first node not going before key, header if none */
+			template < class K >
+			pointer successor_key(K const & key) const { return lower_bound(key); }
+
+		/* member function: order statistics (RBT_SizedNodeBase only)  */
+
+			/** @note O(log n): the node of rank k (0 is the smallest), header if k >= size() */
+			pointer	nth(size_type k) const {
+				if (k >= _size)
+					return _header;
+
+				pointer node = getRoot();
+
+				while (true) {
+					size_type leftCount = node_base::countOf(node->left());
+
+					if (k < leftCount)
+						node = node->left();
+					else if (k == leftCount)
+						return node;
+					else {
+						k -= leftCount + 1;
+						node = node->right();
+					}
+				}
+			}
+
+			/** @note O(log n): number of nodes going before key */
+			template < class K >
+			size_type	rank(K const & key) const {
+				pointer		node = getRoot();
+				size_type	rank = 0;
+
+				while (node != ft_nullptr) {
+					if (_comp(keyOf(node), key)) {
+						rank += node_base::countOf(node->left()) + 1;
+						node = node->right();
+					}
+					else
+						node = node->left();
+				}
+				return rank;
+			}
+
+			/** @note O(log n): position of a node, size() for the header */
+			static size_type	rankOf(pointer node) { return node_base::rankOf(node); }
+
+		/* member function: aggregates (RBT_AugmentedNodeBase only)  */
+
+			/** @brief update the summaries after the value of node was changed in place, O(log n) */
+			void			refresh(pointer node) { updatePath(node); }
+
+			/** @note O(1): summary of the whole tree */
+			summary_type	summary() const { return node_base::summaryOf(getRoot()); }
+
+			/**
+			 * @brief summary of the values whose key is in [lo, hi), in order
+			 * @note O(log n): down to the first node in the range, then along both boundaries of the range,
+			 * taking the summaries of the subtrees hanging inside it.
+			 */
+			template < class K >
+			summary_type	aggregate(K const & lo, K const & hi) const {
+				typedef typename node_base::policy_type policy;
+
+				pointer node = getRoot();
+
+				while (node != ft_nullptr) {
+					if (_comp(keyOf(node), lo))
+						node = node->right();
+					else if (_comp(keyOf(node), hi) == false)
+						node = node->left();
+					else
+						break ;
+				}
+				if (node == ft_nullptr)
+					return policy::identity();
+
+				summary_type	before = policy::identity();
+				summary_type	after = policy::identity();
+
+				// nodes of the left subtree not going before lo, from the last one to the first one
+				for (pointer left = node->left(); left != ft_nullptr; ) {
+					if (_comp(keyOf(left), lo))
+						left = left->right();
+					else {
+						before = policy::combine(policy::combine(policy::summarize(valueOf(left)), node_base::summaryOf(left->right())), before);
+						left = left->left();
+					}
+				}
+				// nodes of the right subtree going before hi, from the first one to the last one
+				for (pointer right = node->right(); right != ft_nullptr; ) {
+					if (_comp(keyOf(right), hi)) {
+						after = policy::combine(after, policy::combine(node_base::summaryOf(right->left()), policy::summarize(valueOf(right))));
+						right = right->right();
+					}
+					else
+						right = right->left();
+				}
+				return policy::combine(policy::combine(before, policy::summarize(valueOf(node))), after);
+			}
+
+		/* member function: modifiers  */
+
+			/**
+			 * @note O(1). a header embedded in the pool (nodePool) stays with its tree and takes the other tree's nodes,
+			 * a header living with the nodes (indexPool) goes along with them.
+			 */
+			void	swap(RBT & toSwap) {
+				pointer root = getRoot(), leftmost = min(), rightmost = max();
+				pointer rootSwap = toSwap.getRoot(), leftmostSwap = toSwap.min(), rightmostSwap = toSwap.max();
+				size_type size_ = _size;
+				key_compare comp_ = _comp;
+
+				_size = toSwap._size;
+				_comp = toSwap._comp;
+
+				toSwap._size = size_;
+				toSwap._comp = comp_;
+
+				// the allocators follow the nodes they allocated
+				allocator_type alloc_ = _alloc;
+				_alloc = toSwap._alloc;
+				toSwap._alloc = alloc_;
+				_pool.swap(toSwap._pool);
+
+				if (_pool.header() == _header) {
+					linkHeader(rootSwap, leftmostSwap, rightmostSwap);
+					toSwap.linkHeader(root, leftmost, rightmost);
+				}
+				else {
+					_header = _pool.header();
+					toSwap._header = toSwap._pool.header();
+				}
+			}
+
+			/**
+			 * @brief insert a value if no equivalent one is in the tree
+			 * @note a single descent from the root, the node is only allocated when val is absent.
+			 * 
+			 * @return a pair with the node holding val (new or existing) and whether it was inserted.
+			 */
+			ft::pair<pointer, bool>	insert(value_type const & val) {
+				pointer	parent;
+				bool	toLeft;
+				pointer	found = insertPosition(keyOf(val), parent, toLeft);
+
+				if (found != ft_nullptr)
+					return ft::make_pair(found, false);
+				return ft::make_pair(insertAt(parent, toLeft, val), true);
+			}
+
+			/**
+			 * @brief insert a value next to a hint
+			 * @note if val goes right before hint (or right after it), the new node is linked
+			 * next to hint without descending from the root: amortized O(1) for sorted input
+			 * (e.g. always hinting with the header / end()). otherwise falls back to insert(val).
+			 * 
+			 * @return a pair with the node holding val (new or existing) and whether it was inserted.
+			 */
+			ft::pair<pointer, bool>	insert(pointer hint, value_type const & val) {
+				pointer	parent;
+				bool	toLeft;
+				pointer	found = hintPosition(hint, keyOf(val), parent, toLeft);
+
+				if (found != ft_nullptr)
+					return ft::make_pair(found, false);
+				return ft::make_pair(insertAt(parent, toLeft, val), true);
+			}
+
+			/**
+			 * @brief fill an empty tree from a range
+			 * @note the leading strictly increasing part of the range is read once into a list of nodes
+			 * which is then turned into a balanced, correctly colored tree in O(n).
+			 * from the first element out of order, the rest of the range falls back to hinted insertion.
+			 * 
+			 * @param first, last: input iterators to the initial and final positions in a range.
+			 */
+			template < class InputIterator >
+			void	build(InputIterator first, InputIterator last) {
+				pointer		head = ft_nullptr;
+				pointer		tail = ft_nullptr;
+				size_type	n = 0;
+
+				for (; first != last; ++first) {
+					value_type const & val = *first;
+
+					if (tail != ft_nullptr && _comp(keyOf(tail), keyOf(val)) == false)
+						break ;
+
+					node_pointer node = allocateNode();
+					head = _pool.rebase(head);
+					tail = _pool.rebase(tail);
+					_alloc.construct(node, node_type(val));
+					if (tail == ft_nullptr)
+						head = node;
+					else
+						tail->setRight(node);
+					tail = node;
+					++n;
+				}
+
+				if (n != 0) {
+					linkHeader(buildTree(head, n), head, tail);
+					_size = n;
+				}
+
+				for (; first != last; ++first)
+					insert(_header, *first);
+			}
+
+			template < class K >
+			bool	deleteNode(K const & key) { return deleteNodeHelper(getRoot(), key); }
+
+			/** @brief unlink and destroy a node already found, no search from the root */
+			void	erase(pointer node) { eraseNode(node); }
+
+			/**
+			 * @brief unlink and destroy the nodes of [first, last)
+			 * @note O(k + log n) for k nodes: the walk goes on from node to node, which stay in place
+			 * when another one is erased. the whole tree is torn down in O(n) without any rebalancing.
+			 */
+			void	erase(pointer first, pointer last) {
+				if (first == min() && last == _header)
+					return destroyTree();
+
+				while (first != last) {
+					pointer next = RBT_increment(first);
+
+					eraseNode(first);
+					first = next;
+				}
+			}
+
+			/**
+			 * @brief unlink a node without destroying it (node handle)
+			 * @note the node can be linked again by relink(), here or in another tree sharing its storage.
+			 */
+			pointer	extract(pointer node) {
+				unlinkNode(node);
+				return node;
+			}
+
+			/**
+			 * @brief link an unlinked node if no equivalent key is in the tree
+			 * @return a pair with the node holding the key (node or the existing one) and whether node was linked.
+			 */
+			ft::pair<pointer, bool>	relink(pointer node) {
+				pointer	parent;
+				bool	toLeft;
+				pointer	found = insertPosition(keyOf(node), parent, toLeft);
+
+				if (found != ft_nullptr)
+					return ft::make_pair(found, false);
+				linkNode(parent, toLeft, node);
+				return ft::make_pair(node, true);
+			}
+
+			/** @note same as relink(node), next to hint as insert(hint, val) */
+			ft::pair<pointer, bool>	relink(pointer hint, pointer node) {
+				pointer	parent;
+				bool	toLeft;
+				pointer	found = hintPosition(hint, keyOf(node), parent, toLeft);
+
+				if (found != ft_nullptr)
+					return ft::make_pair(found, false);
+				linkNode(parent, toLeft, node);
+				return ft::make_pair(node, true);
+			}
+
+			/**
+			 * @brief union: move every node of src whose key is not in the tree, no node allocation nor copy
+			 * @note O(m log(n / m + 1)) for trees of m <= n nodes: src is split by the root of the tree,
+			 * the halves are merged recursively and joined back around that root.
+			 * src keeps the nodes whose key was already in the tree (rebuilt in O(k) for k of them).
+			 * the pools then share their storage (one storeRef per store new to this pool).
+			 * without split / join (Balance not joinable), the nodes of src are moved one by one in O(m log(n + m)).
+			 * when the pools cannot share (indexPool, or allocators not comparing equal),
+			 * the values are copied and erased from src instead (see copyNodes).
+			 */
+			void	merge(RBT & src) {
+				if (&src == this || src._size == 0)
+					return ;
+
+				if (_pool.share(src._pool) == false)
+					return copyNodes(src);
+				if (Balance::joinable == false)
+					return mergeNodes(src);
+
+				size_type	height = blackHeight(getRoot());
+				size_type	heightSrc = blackHeight(src.getRoot());
+				pointer		root = detach(getRoot(), height);
+				pointer		rootSrc = detach(src.getRoot(), heightSrc);
+				pointer		kept = ft_nullptr;
+				pointer		keptTail = ft_nullptr;
+				size_type	nKept = 0;
+
+				src.resetHeader();
+				root = unionHelper(root, height, rootSrc, heightSrc, height, kept, keptTail, nKept);
+				linkTree(root);
+				_size += src._size - nKept;
+
+				src.linkTree(src.buildTree(kept, nKept));
+				src._size = nKept;
+			}
+
+			/**
+			 * @brief intersection: destroy every node whose key is not in other
+			 * @note O(m log(n / m + 1)) plus the destroyed nodes: the tree is split by the root of other,
+			 * the halves are intersected with its subtrees and joined back. other is only read.
+			 * without split / join (Balance not joinable), both trees are walked in order in O(n + m).
+			 */
+			void	intersect(RBT const & other) {
+				if (&other == this)
+					return ;
+				if (Balance::joinable == false)
+					return eraseMatches(other, false);
+
+				size_type	height = blackHeight(getRoot());
+				pointer		root = detach(getRoot(), height);
+
+				_size = 0;
+				root = intersectHelper(root, height, other.getRoot(), height);
+				linkTree(root);
+			}
+
+			/**
+			 * @brief difference: destroy every node whose key is in other
+			 * @note O(m log(n / m + 1)), same scheme as intersect(). other is only read.
+			 */
+			void	subtract(RBT const & other) {
+				if (&other == this)
+					return destroyTree();
+				if (Balance::joinable == false)
+					return eraseMatches(other, true);
+
+				size_type	height = blackHeight(getRoot());
+				pointer		root = detach(getRoot(), height);
+
+				root = subtractHelper(root, height, other.getRoot(), height);
+				linkTree(root);
+			}
+
+			/** @note the values are destroyed node by node, the storage is given back one whole slab at a time */
+			void	destroyTree() {
+				destroyTree(getRoot());
+				_pool.release();
+				resetHeader();
+				_size = 0;
+			}
+
+		/* member function: iteration  */
+
+			pointer	successor(pointer node) const { return RBT_increment(node); }
+
+			pointer	predecessor(pointer node) const {
+				if (node == _header)
+					return _header->right();
+				if (node == _header->left())
+					return _header;
+				return RBT_decrement(node);
+			}
+
+		/* member function: balancing (used by the policies)  */
+
+			/** @brief tell Balance a lookup found node (the header: nothing found), RBT_Splay moves it to the root */
+			void	access(pointer node) {
+				if (node != _header)
+					Balance::accessed(*this, node);
+			}
+
+			/** @brief searchTree(), then access() to the node found: the lookup of a non-const container */
+			template < class K >
+			pointer	find(K const & key) {
+				pointer node = searchTree(key);
+
+				access(node);
+				return node;
+			}
+
+			/** @note the header follows a new root, the augmented data of the two nodes moved is updated */
+			void	leftRotate(pointer node) {
+				pointer	tmp = node->right();
+				
+				node->setRight(tmp->left());
+				if (tmp->left() != ft_nullptr)
+					tmp->left()->setParent(node);
+	
+				tmp->setParent(node->parent());
+				if (node == getRoot())
+					_header->setParent(tmp);
+				else if (node == node->parent()->left())
+					node->parent()->setLeft(tmp);
+				else
+					node->parent()->setRight(tmp);
+
+				tmp->setLeft(node);
+				node->setParent(tmp);
+				toNode(node)->update();
+				toNode(tmp)->update();
+			}
+
+			void	rightRotate(pointer node) {
+				pointer	tmp = node->left();
+				
+				node->setLeft(tmp->right());
+				if (tmp->right() != ft_nullptr)
+					tmp->right()->setParent(node);
+
+				tmp->setParent(node->parent());
+				if (node == getRoot())
+					_header->setParent(tmp);
+				else if (node == node->parent()->right())
+					node->parent()->setRight(tmp);
+				else
+					node->parent()->setLeft(tmp);
+
+				tmp->setRight(node);
+				node->setParent(tmp);
+				toNode(node)->update();
+				toNode(tmp)->update();
+			}
+
+		private:
+		/* member function (private): operation  */
+
+			template < class K >
+			pointer	searchTreeHelper(pointer node, K const & key) const {
+				while (node != ft_nullptr) {
+					if (_comp(key, keyOf(node)))
+						node = node->left();
+					else if (_comp(keyOf(node), key))
+						node = node->right();
+					else
+						return node;
+				}
+				return _header;
+			}
+
+			pointer	min(pointer node) const {
+				while (node->left() != ft_nullptr)
+					node = node->left();
+				return node;
+			}
+
+			pointer	max(pointer node) const {
+				while (node->right() != ft_nullptr)
+					node = node->right();
+				return node;
+			}
+
+			static key_type const &	keyOf(value_type const & val) { return KeyOfValue()(val); }
+
+			static key_type const &	keyOf(pointer node) { return KeyOfValue()(toNode(node)->value()); }
+
+			static bool	isBlack(pointer node) { return node == ft_nullptr || node->color() == BLACK_NODE; }
+
+			static node_pointer	toNode(pointer node) { return static_cast<node_pointer>(node); }
+
+			/** @note the nodes of an indexPool may move: the header is followed, other pointers must be rebased by the caller */
+			node_pointer	allocateNode() {
+				node_pointer node = _pool.allocate();
+
+				_header = _pool.rebase(_header);
+				return node;
+			}
+
+			void	resetHeader() {
+				_header->setColor(RED_NODE);
+				_header->setParent(ft_nullptr);
+				_header->setLeft(_header);
+				_header->setRight(_header);
+			}
+
+			/** @brief make the header the end of the tree rooted at root (ft_nullptr: empty tree) */
+			void	linkHeader(pointer root, pointer leftmost, pointer rightmost) {
+				if (root == ft_nullptr)
+					return resetHeader();
+				_header->setParent(root);
+				root->setParent(_header);
+				_header->setLeft(leftmost);
+				_header->setRight(rightmost);
+			}
+
+			/** @brief make a detached subtree the whole tree, the size is left to the caller */
+			void	linkTree(pointer root) {
+				if (root == ft_nullptr)
+					return resetHeader();
+				linkHeader(root, min(root), max(root));
+			}
+
+			/** @brief update the nodes from node up to the root, after the children of node changed */
+			void	updatePath(pointer node) {
+				if (node_base::augmented == false)
+					return ;
+				for (; node != _header; node = node->parent())
+					toNode(node)->update();
+			}
+
+			/** @brief update every node of a subtree, bottom-up (copy) */
+			void	updateSubtree(pointer root) {
+				if (root == ft_nullptr)
+					return ;
+				updateSubtree(root->left());
+				updateSubtree(root->right());
+				toNode(root)->update();
+			}
+
+		/* member function (private): modifiers  */
+
+			/**
+			 * @brief find where a node with key goes: a single descent from the root
+			 * @return the node with an equivalent key, or ft_nullptr and the place to link a new one
+			 * (the left / right child of parent, parent is the header when the tree is empty).
+			 */
+			pointer	insertPosition(key_type const & key, pointer & parent, bool & toLeft) const {
+				pointer node = getRoot();
+
+				parent = _header;
+				toLeft = true;
+				while (node != ft_nullptr) {
+					parent = node;
+					if (_comp(key, keyOf(node))) {
+						toLeft = true;
+						node = node->left();
+					}
+					else if (_comp(keyOf(node), key)) {
+						toLeft = false;
+						node = node->right();
+					}
+					else
+						return node;
+				}
+				return ft_nullptr;
+			}
+
+			/** @note same as insertPosition, in amortized O(1) when key goes right next to hint */
+			pointer	hintPosition(pointer hint, key_type const & key, pointer & parent, bool & toLeft) const {
+				if (hint == _header) {
+					if (_size != 0 && _comp(keyOf(_header->right()), key)) {
+						parent = _header->right();
+						toLeft = false;
+						return ft_nullptr;
+					}
+					return insertPosition(key, parent, toLeft);
+				}
+
+				if (_comp(key, keyOf(hint))) {
+					if (hint == _header->left()) {
+						parent = hint;
+						toLeft = true;
+						return ft_nullptr;
+					}
+
+					pointer before = RBT_decrement(hint);
+					if (_comp(keyOf(before), key)) {
+						if (before->right() == ft_nullptr) {
+							parent = before;
+							toLeft = false;
+						}
+						else {
+							parent = hint;
+							toLeft = true;
+						}
+						return ft_nullptr;
+					}
+					return insertPosition(key, parent, toLeft);
+				}
+
+				if (_comp(keyOf(hint), key)) {
+					if (hint == _header->right()) {
+						parent = hint;
+						toLeft = false;
+						return ft_nullptr;
+					}
+
+					pointer after = RBT_increment(hint);
+					if (_comp(key, keyOf(after))) {
+						if (hint->right() == ft_nullptr) {
+							parent = hint;
+							toLeft = false;
+						}
+						else {
+							parent = after;
+							toLeft = true;
+						}
+						return ft_nullptr;
+					}
+					return insertPosition(key, parent, toLeft);
+				}
+
+				return hint;
+			}
+
+			/**
+			 * @brief link a new red node holding val as the left / right child of parent
+			 * @note parent is the header when the tree is empty. rebalance the tree and return the new node.
+			 */
+			pointer	insertAt(pointer parent, bool toLeft, value_type const & val) {
+				node_pointer toInsert = allocateNode();
+
+				parent = _pool.rebase(parent);
+				_alloc.construct(toInsert, node_type(val));
+				linkNode(parent, toLeft, toInsert);
+				return toInsert;
+			}
+
+			/** @brief link a constructed node as the left / right child of parent, as a new leaf, and rebalance */
+			void	linkNode(pointer parent, bool toLeft, pointer toLink) {
+				toLink->setLeft(ft_nullptr);
+				toLink->setRight(ft_nullptr);
+				toLink->setParent(parent);
+
+				if (parent == _header) {
+					_header->setParent(toLink);
+					_header->setLeft(toLink);
+					_header->setRight(toLink);
+				}
+				else if (toLeft) {
+					parent->setLeft(toLink);
+					if (parent == _header->left())
+						_header->setLeft(toLink);
+				}
+				else {
+					parent->setRight(toLink);
+					if (parent == _header->right())
+						_header->setRight(toLink);
+				}
+
+				++_size;
+				updatePath(toLink);
+				Balance::linked(*this, toLink);
 			}
 
 			void	rbTransplant(pointer node, pointer toTransplant) {
-				if (node->parent == ft_nullptr)
-					_root = toTransplant;
-				else if (node == node->parent->left)
-					node->parent->left = toTransplant;
+				if (node == getRoot())
+					_header->setParent(toTransplant);
+				else if (node == node->parent()->left())
+					node->parent()->setLeft(toTransplant);
 				else
-					node->parent->right = toTransplant;
+					node->parent()->setRight(toTransplant);
 
-				toTransplant->parent = node->parent;
+				if (toTransplant != ft_nullptr)
+					toTransplant->setParent(node->parent());
 			}
 
-			bool	deleteNodeHelper(pointer node, value_type const & key) {
-				pointer toDelete = _null;
-				pointer tmp;
-				pointer current;
+			template < class K >
+			bool	deleteNodeHelper(pointer node, K const & key) {
+				pointer toDelete = ft_nullptr;
 
-				while (node != _null) {
-					if (_comp(node->val, key))
-						node = node->right;
-					else if (_comp(key, node->val))
-						node = node->left;
+				while (node != ft_nullptr) {
+					if (_comp(keyOf(node), key))
+						node = node->right();
+					else if (_comp(key, keyOf(node)))
+						node = node->left();
 					else {
 						toDelete = node;
-						node = node->right;
+						break ;
 					}
 				}
 
-				if (toDelete == _null) {
+				if (toDelete == ft_nullptr) {
 					return false;
-				} 
-
-				current = toDelete;
-				int y_original_color = current->color;
-				if (toDelete->left == _null) {
-					tmp = toDelete->right;
-					rbTransplant(toDelete, toDelete->right);
 				}
-				else if (toDelete->right == _null) {
-					tmp = toDelete->left;
-					rbTransplant(toDelete, toDelete->left);
+				eraseNode(toDelete);
+				return true;
+			}
+
+			void	eraseNode(pointer toDelete) {
+				unlinkNode(toDelete);
+				_alloc.destroy(toNode(toDelete));
+				_pool.deallocate(toNode(toDelete));
+			}
+
+			/**
+			 * @brief take a node out of the tree and rebalance, the node itself is left as is
+			 * @note a node with two children is replaced by its successor, which takes its state:
+			 * the node taken out of its place is then the successor.
+			 */
+			void	unlinkNode(pointer toDelete) {
+				pointer		current = toDelete;
+				pointer		parent;
+				bool		fromLeft;
+
+				// keep the cached leftmost / rightmost up to date
+				if (toDelete == _header->left())
+					_header->setLeft(toDelete->right() != ft_nullptr ? min(toDelete->right()) : toDelete->parent());
+				if (toDelete == _header->right())
+					_header->setRight(toDelete->left() != ft_nullptr ? max(toDelete->left()) : toDelete->parent());
+
+				size_type removedState = current->state();
+				if (toDelete->left() == ft_nullptr || toDelete->right() == ft_nullptr) {
+					parent = toDelete->parent();
+					fromLeft = toDelete == parent->left();
+					rbTransplant(toDelete, toDelete->left() == ft_nullptr ? toDelete->right() : toDelete->left());
 				}
 				else {
-					current = min(toDelete->right);
-					y_original_color = current->color;
-					tmp = current->right;
-					if (current->parent == toDelete) {
-						tmp->parent = current;
+					current = min(toDelete->right());
+					removedState = current->state();
+					if (current->parent() == toDelete) {
+						parent = current;
+						fromLeft = false;
 					}
 					else {
-						rbTransplant(current, current->right);
-						current->right = toDelete->right;
-						current->right->parent = current;
+						parent = current->parent();
+						fromLeft = true;
+						rbTransplant(current, current->right());
+						current->setRight(toDelete->right());
+						current->right()->setParent(current);
 					}
 
 					rbTransplant(toDelete, current);
-					current->left = toDelete->left;
-					current->left->parent = current;
-					current->color = toDelete->color;
+					current->setLeft(toDelete->left());
+					current->left()->setParent(current);
+					current->setState(toDelete->state());
 				}
 
-				allocator_type().destroy(toDelete);
-				allocator_type().deallocate(toDelete, 1);
+				--_size;
+				updatePath(parent);
+				Balance::unlinked(*this, parent, fromLeft, removedState);
+			}
+
+			/** @note turn a sorted list of n nodes (linked by right) into a balanced subtree in O(n), states set by Balance */
+			pointer	buildTree(pointer list, size_type n) {
+				// levels [0, redDepth) of the built tree are full, the last partial one is red
+				size_type redDepth = 0;
+				while (((size_type)2 << redDepth) - 1 <= n)
+					++redDepth;
 
-				if (y_original_color == BLACK_NODE)
-					fixDelete(tmp);
-				return true;
+				return buildHelper(list, n, 0, redDepth);
 			}
 
-			void destroyTree(pointer root) {
-				if (root == _null) {
-					return ;
+			/** @note consume n nodes of a sorted list (linked by right) and return them as a balanced subtree */
+			pointer	buildHelper(pointer & list, size_type n, size_type depth, size_type redDepth) {
+				if (n == 0)
+					return ft_nullptr;
+
+				size_type	leftSize = (n - 1) / 2;
+				pointer		left = buildHelper(list, leftSize, depth + 1, redDepth);
+				pointer		root = list;
+
+				list = list->right();
+				root->setLeft(left);
+				if (left != ft_nullptr)
+					left->setParent(root);
+
+				root->setRight(buildHelper(list, n - 1 - leftSize, depth + 1, redDepth));
+				if (root->right() != ft_nullptr)
+					root->right()->setParent(root);
+
+				Balance::built(root, depth, redDepth, leftSize, n - 1 - leftSize);
+				toNode(root)->update();
+				return root;
+			}
+
+			/**
+			 * @brief unlink every node of a subtree into a list chained by right, O(n) without recursion
+			 * @note the values are left constructed.
+			 */
+			pointer	flattenTree(pointer root) {
+				pointer list = ft_nullptr;
+
+				while (root != ft_nullptr) {
+					if (root->left() != ft_nullptr) {
+						pointer tmp = root->left();
+						root->setLeft(tmp->right());
+						tmp->setRight(root);
+						root = tmp;
+					}
+					else {
+						pointer next = root->right();
+						root->setRight(list);
+						list = root;
+						root = next;
+					}
+				}
+				return list;
+			}
+
+			/** @note take a node from reuse (destroying its old value) or allocate one, then construct a copy of src in it */
+			pointer	cloneNode(pointer src, pointer & reuse) {
+				node_pointer node = toNode(reuse);
+
+				if (node != ft_nullptr) {
+					reuse = reuse->right();
+					_alloc.destroy(node);
+				}
+				else
+					node = _pool.allocate(); // room was reserved beforehand, nothing moves
+				_alloc.construct(node, node_type(toNode(src)->value(), src->color()));
+				node->setState(src->state());
+				return node;
+			}
+
+			/**
+			 * @note preorder walk of src following the parent links, without recursion:
+			 * the shape is copied as is, however deep (see RBT_Splay). a child not copied yet is still ft_nullptr.
+			 */
+			pointer	cloneHelper(pointer src, pointer parent, pointer & reuse) {
+				pointer top = cloneNode(src, reuse);
+				pointer node = top;
+
+				top->setParent(parent);
+				for (pointer from = src; ; ) {
+					pointer child;
+
+					if (from->left() != ft_nullptr && node->left() == ft_nullptr) {
+						from = from->left();
+						child = cloneNode(from, reuse);
+						node->setLeft(child);
+					}
+					else if (from->right() != ft_nullptr && node->right() == ft_nullptr) {
+						from = from->right();
+						child = cloneNode(from, reuse);
+						node->setRight(child);
+					}
+					else {
+						if (from == src)
+							break ;
+						from = from->parent();
+						node = node->parent();
+						continue ;
+					}
+					child->setParent(node);
+					node = child;
+				}
+				return top;
+			}
+
+			/** @note the tree must be empty, the nodes left in reuse are released */
+			void	cloneTree(RBT const & src, pointer reuse) {
+				if (src.getRoot() != ft_nullptr) {
+					_header->setParent(cloneHelper(src.getRoot(), _header, reuse));
+					_header->setLeft(min(getRoot()));
+					_header->setRight(max(getRoot()));
+					_size = src._size;
+					if (node_base::augmented)
+						updateSubtree(getRoot());
+				}
+
+				while (reuse != ft_nullptr) {
+					pointer next = reuse->right();
+
+					_alloc.destroy(toNode(reuse));
+					_pool.deallocate(toNode(reuse));
+					reuse = next;
+				}
+			}
+
+		/* member function (private): split / join  */
+
+			/*
+			 * the set operations work on detached subtrees: the parent of the root is ft_nullptr, the root is black,
+			 * and the black height of the subtree (black nodes from the root to a leaf, ft_nullptr counting 0)
+			 * goes along with it, so a join costs O(difference of the heights) instead of a walk down the tree.
+			 * the header is only borrowed by join / join2, to reuse fixInsert / unlinkNode on the subtree at hand.
+			 * only for a joinable Balance (RBT_RedBlack).
+			 */
+
+			/** @note O(log n): black nodes on the left spine */
+			static size_type	blackHeight(pointer root) {
+				size_type height = 0;
+
+				for (; root != ft_nullptr; root = root->left()) {
+					if (root->color() == BLACK_NODE)
+						++height;
+				}
+				return height;
+			}
+
+			/** @brief cut a subtree from its parent and blacken its root (height follows) */
+			static pointer	detach(pointer root, size_type & height) {
+				if (root == ft_nullptr)
+					return ft_nullptr;
+				root->setParent(ft_nullptr);
+				if (root->color() == RED_NODE) {
+					root->setColor(BLACK_NODE);
+					++height;
+				}
+				return root;
+			}
+
+			/** @note the subtrees of a node of the given black height, detached */
+			static void	detachChildren(pointer node, size_type height, pointer & left, size_type & hLeft,
+				pointer & right, size_type & hRight) {
+				hLeft = height - (node->color() == BLACK_NODE ? 1 : 0);
+				hRight = hLeft;
+				left = detach(node->left(), hLeft);
+				right = detach(node->right(), hRight);
+			}
+
+			/** @brief hand the subtree back from the header it was hooked on */
+			pointer	unhook() {
+				pointer root = getRoot();
+
+				_header->setParent(ft_nullptr);
+				root->setParent(ft_nullptr);
+				return root;
+			}
+
+			/**
+			 * @brief join two subtrees around mid: every key of left goes before the key of mid, which goes before right
+			 * @note O(|hLeft - hRight| + 1): mid is linked, red, on the spine of the higher subtree
+			 * where the black height is the one of the other subtree, then fixInsert restores the colors.
+			 * 
+			 * @return the detached subtree, its black height in height.
+			 */
+			pointer	join(pointer left, size_type hLeft, pointer mid, pointer right, size_type hRight, size_type & height) {
+				left = detach(left, hLeft);
+				right = detach(right, hRight);
+
+				if (hLeft == hRight) {
+					mid->setLeft(left);
+					mid->setRight(right);
+					if (left != ft_nullptr)
+						left->setParent(mid);
+					if (right != ft_nullptr)
+						right->setParent(mid);
+					mid->setParent(ft_nullptr);
+					mid->setColor(BLACK_NODE);
+					toNode(mid)->update();
+					height = hLeft + 1;
+					return mid;
+				}
+
+				bool		toRight = hLeft > hRight;
+				pointer		top = toRight ? left : right;
+				pointer		low = toRight ? right : left;
+				size_type	hLow = toRight ? hRight : hLeft;
+				size_type	h = toRight ? hLeft : hRight;
+				pointer		parent = _header;
+				pointer		node = top;
+
+				_header->setParent(top);
+				top->setParent(_header);
+				while (isBlack(node) == false || h != hLow) {
+					if (node->color() == BLACK_NODE)
+						--h;
+					parent = node;
+					node = toRight ? node->right() : node->left();
 				}
 
-				destroyTree(root->left);
-				destroyTree(root->right);
+				mid->setLeft(toRight ? node : low);
+				mid->setRight(toRight ? low : node);
+				if (mid->left() != ft_nullptr)
+					mid->left()->setParent(mid);
+				if (mid->right() != ft_nullptr)
+					mid->right()->setParent(mid);
+				mid->setParent(parent);
+				if (toRight)
+					parent->setRight(mid);
+				else
+					parent->setLeft(mid);
+				mid->setColor(RED_NODE);
+				updatePath(mid);
+
+				height = (toRight ? hLeft : hRight) + (RBT_RedBlack::fixInsert(*this, mid) ? 1 : 0);
+				return unhook();
+			}
+
+			/** @brief join two subtrees with no node in between: the minimum of right is taken out as the middle node */
+			pointer	join2(pointer left, size_type hLeft, pointer right, size_type hRight, size_type & height) {
+				left = detach(left, hLeft);
+				right = detach(right, hRight);
+				if (right == ft_nullptr) {
+					height = hLeft;
+					return left;
+				}
+				if (left == ft_nullptr) {
+					height = hRight;
+					return right;
+				}
+
+				pointer mid = min(right);
+
+				linkHeader(right, mid, max(right));
+				unlinkNode(mid);
+				++_size; // mid is not leaving the tree
+				right = getRoot();
+				if (right != ft_nullptr)
+					right = unhook();
+				hRight = blackHeight(right);
+				return join(left, hLeft, mid, right, hRight, height);
+			}
+
+			/**
+			 * @brief split a subtree by a key
+			 * @note O(log n): the join of the pieces on the way down telescopes.
+			 * 
+			 * @return the node with an equivalent key (detached, its links are stale) or ft_nullptr,
+			 * the nodes going before key in left, the ones going after it in right.
+			 */
+			pointer	split(pointer root, size_type height, key_type const & key,
+				pointer & left, size_type & hLeft, pointer & right, size_type & hRight) {
+				if (root == ft_nullptr) {
+					left = ft_nullptr;
+					right = ft_nullptr;
+					hLeft = 0;
+					hRight = 0;
+					return ft_nullptr;
+				}
+
+				pointer		childLeft, childRight, piece;
+				size_type	hChildLeft, hChildRight, hPiece;
+				pointer		found;
+
+				detachChildren(root, height, childLeft, hChildLeft, childRight, hChildRight);
+				if (_comp(key, keyOf(root))) {
+					found = split(childLeft, hChildLeft, key, left, hLeft, piece, hPiece);
+					right = join(piece, hPiece, root, childRight, hChildRight, hRight);
+				}
+				else if (_comp(keyOf(root), key)) {
+					found = split(childRight, hChildRight, key, piece, hPiece, right, hRight);
+					left = join(childLeft, hChildLeft, root, piece, hPiece, hLeft);
+				}
+				else {
+					left = childLeft;
+					hLeft = hChildLeft;
+					right = childRight;
+					hRight = hChildRight;
+					found = root;
+				}
+				return found;
+			}
+
+			/** @note the nodes of other whose key is in the tree go to the sorted list kept (in order) */
+			pointer	unionHelper(pointer root, size_type height, pointer other, size_type hOther, size_type & hResult,
+				pointer & kept, pointer & keptTail, size_type & nKept) {
+				if (other == ft_nullptr) {
+					hResult = height;
+					return root;
+				}
+				if (root == ft_nullptr) {
+					hResult = hOther;
+					return other;
+				}
+
+				pointer		childLeft, childRight, otherLeft, otherRight;
+				size_type	hChildLeft, hChildRight, hOtherLeft, hOtherRight;
+
+				detachChildren(root, height, childLeft, hChildLeft, childRight, hChildRight);
+				pointer found = split(other, hOther, keyOf(root), otherLeft, hOtherLeft, otherRight, hOtherRight);
+
+				childLeft = unionHelper(childLeft, hChildLeft, otherLeft, hOtherLeft, hChildLeft, kept, keptTail, nKept);
+				if (found != ft_nullptr) {
+					found->setRight(ft_nullptr);
+					if (keptTail == ft_nullptr)
+						kept = found;
+					else
+						keptTail->setRight(found);
+					keptTail = found;
+					++nKept;
+				}
+				childRight = unionHelper(childRight, hChildRight, otherRight, hOtherRight, hChildRight, kept, keptTail, nKept);
+				return join(childLeft, hChildLeft, root, childRight, hChildRight, hResult);
+			}
+
+			/** @note other is a subtree of another tree, only read. the nodes kept are counted in _size */
+			pointer	intersectHelper(pointer root, size_type height, pointer other, size_type & hResult) {
+				if (root == ft_nullptr || other == ft_nullptr) {
+					destroySubtree(root);
+					hResult = 0;
+					return ft_nullptr;
+				}
+
+				pointer		left, right;
+				size_type	hLeft, hRight;
+				pointer		found = split(root, height, keyOf(other), left, hLeft, right, hRight);
+
+				left = intersectHelper(left, hLeft, other->left(), hLeft);
+				right = intersectHelper(right, hRight, other->right(), hRight);
+				if (found == ft_nullptr)
+					return join2(left, hLeft, right, hRight, hResult);
+				++_size;
+				return join(left, hLeft, found, right, hRight, hResult);
+			}
 
-				allocator_type().destroy(root);
-				allocator_type().deallocate(root, 1);
+			/** @note other is a subtree of another tree, only read. the nodes destroyed are taken from _size */
+			pointer	subtractHelper(pointer root, size_type height, pointer other, size_type & hResult) {
+				if (root == ft_nullptr || other == ft_nullptr) {
+					hResult = height;
+					return root;
+				}
+
+				pointer		left, right;
+				size_type	hLeft, hRight;
+				pointer		found = split(root, height, keyOf(other), left, hLeft, right, hRight);
+
+				if (found != ft_nullptr)
+					destroyNode(found);
+				left = subtractHelper(left, hLeft, other->left(), hLeft);
+				right = subtractHelper(right, hRight, other->right(), hRight);
+				return join2(left, hLeft, right, hRight, hResult);
+			}
+
+			/** @brief move the nodes of src whose key is not in the tree, one by one (merge) */
+			void	mergeNodes(RBT & src) {
+				pointer	parent;
+				bool	toLeft;
+
+				for (pointer node = src.min(); node != src._header; ) {
+					pointer next = RBT_increment(node); // stays in place when node is unlinked
+
+					if (insertPosition(keyOf(node), parent, toLeft) == ft_nullptr) {
+						src.unlinkNode(node);
+						linkNode(parent, toLeft, node);
+					}
+					node = next;
+				}
+			}
+
+			/**
+			 * @brief copy the values of src whose key is not in the tree, erasing them from src (merge without sharing)
+			 * @note each value is inserted next to the previous one: amortized O(1) when they go after the tree.
+			 * the nodes of src stay in place, only the ones of the tree may move (indexPool).
+			 */
+			void	copyNodes(RBT & src) {
+				pointer	hint = _header;
+
+				for (pointer node = src.min(); node != src._header; ) {
+					pointer						next = RBT_increment(node);
+					ft::pair<pointer, bool>		ret = insert(hint, toNode(node)->value());
+
+					if (ret.second == true)
+						src.eraseNode(node);
+					hint = ret.first;
+					node = next;
+				}
+			}
+
+			/** @brief erase the nodes whose key is in other (matching) or is not (intersect / subtract), in order */
+			void	eraseMatches(RBT const & other, bool matching) {
+				pointer	otherNode = other.min();
+
+				for (pointer node = min(); node != _header; ) {
+					pointer next = RBT_increment(node);
+
+					while (otherNode != other._header && _comp(keyOf(otherNode), keyOf(node)))
+						otherNode = RBT_increment(otherNode);
+					if (matching == (otherNode != other._header && _comp(keyOf(node), keyOf(otherNode)) == false))
+						eraseNode(node);
+					node = next;
+				}
+			}
+
+			/** @brief destroy and give back an unlinked node */
+			void	destroyNode(pointer node) {
+				_alloc.destroy(toNode(node));
+				_pool.deallocate(toNode(node));
+				--_size;
+			}
+
+			/** @brief destroy and give back every node of a detached subtree, the count is left to the caller */
+			void	destroySubtree(pointer root) {
+				for (pointer node = flattenTree(root); node != ft_nullptr; ) {
+					pointer next = node->right();
+
+					_alloc.destroy(toNode(node));
+					_pool.deallocate(toNode(node));
+					node = next;
+				}
+			}
+
+			/** @note the values only, the storage goes back with the pool. no recursion: a tree may be deep (RBT_Splay) */
+			void destroyTree(pointer root) {
+				for (pointer node = flattenTree(root); node != ft_nullptr; ) {
+					pointer next = node->right();
+
+					_alloc.destroy(toNode(node));
+					node = next;
+				}
 			}
 
 		private:
 		/* attributes */
 
-			pointer			_root;
-			pointer			_null;
-			value_compare	_comp;
+			pointer								_header;
+			size_type							_size;
+			key_compare						_comp;
+			allocator_type						_alloc;
+			pool_type							_pool;
 	};
 
 _END_NS_FT
@@ -0,0 +1,217 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arenaAllocator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/16 15:21:09 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/16 15:21:09 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARENAALLOCATOR_HPP
+# define ARENAALLOCATOR_HPP
+
+#include <memory>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+#define ARENA_BLOCK_SIZE 4096
+
+/**
+ * @class arena
+ */
+
+	/**
+	 * @brief monotonic memory arena
+	 * @note hands out memory by bumping a pointer into blocks obtained from std::allocator.
+	 * nothing is given back one by one: every block is released at once by release() or the destructor.
+	 * an arena is neither copyable nor assignable, allocators refer to it.
+	 */
+	class arena {
+		public:
+		/* member types */
+
+			typedef std::size_t	size_type;
+
+		public:
+		/* member function: constructor / destructor  */
+
+			/**
+			 * @param blockSize: size in bytes of the blocks asked to std::allocator
+			 * (bigger requests get a block of their own size).
+			 */
+			explicit arena(size_type blockSize = ARENA_BLOCK_SIZE) :
+				_blocks(ft_nullptr),
+				_cursor(ft_nullptr),
+				_end(ft_nullptr),
+				_blockSize(blockSize),
+				_used(0) {}
+
+			~arena(void) { release(); }
+
+		/* member function: capacity  */
+
+			/** @brief number of bytes handed out since the last release */
+			size_type	used(void) const { return _used; }
+
+		/* member function: modifiers  */
+
+			/**
+			 * @brief get n bytes aligned on align (a power of two)
+			 * @exception std::bad_alloc if the underlying allocator fails.
+			 */
+			void *	allocate(size_type n, size_type align) {
+				std::size_t	addr = reinterpret_cast<std::size_t>(_cursor);
+				std::size_t	pad = (align - (addr & (align - 1))) & (align - 1);
+
+				if (_cursor == ft_nullptr || n + pad > static_cast<size_type>(_end - _cursor)) {
+					addBlock(n + align);
+					addr = reinterpret_cast<std::size_t>(_cursor);
+					pad = (align - (addr & (align - 1))) & (align - 1);
+				}
+
+				void * ret = _cursor + pad;
+
+				_cursor += pad + n;
+				_used += n;
+				return ret;
+			}
+
+			/** @brief give every block back at once, all the memory handed out becomes invalid */
+			void	release(void) {
+				while (_blocks != ft_nullptr) {
+					block *next = _blocks->next;
+
+					std::allocator<char>().deallocate(reinterpret_cast<char *>(_blocks), _blocks->size);
+					_blocks = next;
+				}
+				_cursor = ft_nullptr;
+				_end = ft_nullptr;
+				_used = 0;
+			}
+
+		private:
+		/* member types (private) */
+
+			struct block {
+				block		*next;
+				size_type	size;
+			};
+
+		/* member function (private) */
+
+			arena(arena const &);
+			arena & operator=(arena const &);
+
+			void	addBlock(size_type n) {
+				size_type	size = sizeof(block) + (n > _blockSize ? n : _blockSize);
+				block		*toAdd = reinterpret_cast<block *>(std::allocator<char>().allocate(size));
+
+				toAdd->next = _blocks;
+				toAdd->size = size;
+				_blocks = toAdd;
+
+				_cursor = reinterpret_cast<char *>(toAdd) + sizeof(block);
+				_end = reinterpret_cast<char *>(toAdd) + size;
+			}
+
+		private:
+		/* attributes */
+
+			block		*_blocks;
+			char		*_cursor;
+			char		*_end;
+			size_type	_blockSize;
+			size_type	_used;
+	};
+
+/**
+ * @class template: arena_allocator
+ */
+
+	/**
+	 * @brief allocator drawing its memory from an arena
+	 * @note deallocate does nothing, the memory goes back when the arena is released.
+	 * copies (and rebound copies) share the same arena and compare equal.
+	 * meant for request-scoped containers: they are all freed in one shot with their arena.
+	 *
+	 * @param T: type of the elements.
+	 */
+	template < class T >
+	class arena_allocator {
+		public:
+		/* member types */
+
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef std::size_t		size_type;
+			typedef std::ptrdiff_t	difference_type;
+
+			template < class U >
+			struct rebind { typedef arena_allocator<U> other; };
+
+		public:
+		/* member function: constructor / destructor  */
+
+			/** @note no default constructor: an arena_allocator always refers to an arena (an empty node handle holds no allocator) */
+			explicit arena_allocator(ft::arena & a) : _arena(&a) {}
+
+			arena_allocator(arena_allocator const & src) : _arena(src._arena) {}
+
+			template < class U >
+			arena_allocator(arena_allocator<U> const & src) : _arena(src.getArena()) {}
+
+			~arena_allocator(void) {}
+
+		/* member function: getters  */
+
+			ft::arena *	getArena(void) const { return _arena; }
+
+		/* member function: allocation  */
+
+			pointer			address(reference x) const { return &x; }
+			const_pointer	address(const_reference x) const { return &x; }
+
+			pointer	allocate(size_type n, const void * hint = 0) {
+				(void)hint;
+				if (n > max_size())
+					throw std::bad_alloc();
+				return static_cast<pointer>(_arena->allocate(n * sizeof(T), ft::alignment_of<T>::value));
+			}
+
+			void	deallocate(pointer p, size_type n) { (void)p; (void)n; }
+
+			size_type	max_size(void) const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+			void	construct(pointer p, const_reference val) { new (static_cast<void *>(p)) T(val); }
+
+			void	destroy(pointer p) { p->~T(); }
+
+		private:
+		/* attributes */
+
+			ft::arena	*_arena;
+	};
+
+	template < class T1, class T2 >
+	bool operator== (arena_allocator<T1> const & lhs, arena_allocator<T2> const & rhs) {
+		return lhs.getArena() == rhs.getArena();
+	}
+
+	template < class T1, class T2 >
+	bool operator!= (arena_allocator<T1> const & lhs, arena_allocator<T2> const & rhs) {
+		return lhs.getArena() != rhs.getArena();
+	}
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
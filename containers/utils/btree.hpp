@@ -0,0 +1,902 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 10:04:51 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 10:04:51 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_HPP
+# define BTREE_HPP
+
+#include <memory>
+#include <functional>
+#include "btreeIte.hpp"
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+#define BTREE_NODE_BYTES 256
+#define BTREE_MIN_CAPACITY 4
+
+/**
+ * @class template: btree_linear_search
+ */
+
+	/**
+	 * @brief whether the keys of a btree node are searched by a linear scan
+	 * @note for arithmetic keys compared with less, a scan of the node counting the keys going before the one searched
+	 * has no branch to mispredict and compiles to vector compares: it beats a binary search on a node of a few cache lines.
+	 * any other key or comparison is searched by bisection.
+	 */
+	template < class Key, class Compare >
+	struct btree_linear_search : public false_type {};
+
+	template < class Key >
+	struct btree_linear_search< Key, ft::less<Key> > : public integral_constant<bool, is_integral<Key>::value> {};
+
+	template < class Key >
+	struct btree_linear_search< Key, std::less<Key> > : public integral_constant<bool, is_integral<Key>::value> {};
+
+	template <> struct btree_linear_search< float, ft::less<float> > : public true_type {};
+	template <> struct btree_linear_search< double, ft::less<double> > : public true_type {};
+	template <> struct btree_linear_search< float, std::less<float> > : public true_type {};
+	template <> struct btree_linear_search< double, std::less<double> > : public true_type {};
+
+/**
+ * @class template: btreeNode / btreeLeaf / btreeInternal
+ */
+
+	/**
+	 * @brief what every node of a btree has: its place under its parent and its number of entries
+	 * @note the storage of the entries is raw, only the count first ones are constructed.
+	 */
+	struct btreeNode {
+		/* member types */
+
+			typedef size_t		size_type;
+
+		/* attributes */
+
+			btreeNode	*parent;
+			size_type	position;
+			size_type	count;
+			bool		leaf;
+	};
+
+	/** @brief raw storage for n objects of type T, aligned for any fundamental type */
+	template < class T, size_t N >
+	union btreeStorage {
+		char		bytes[N * sizeof(T)];
+		long double	alignLongDouble;
+		long long	alignLongLong;
+		void		*alignPointer;
+	};
+
+	/**
+	 * @brief leaf of a btree: a sorted array of values, linked to the leaves before and after it
+	 * @note the capacity is set for the values to fill BTREE_NODE_BYTES (BTREE_MIN_CAPACITY at least).
+	 */
+	template < class T >
+	struct btreeLeaf : public btreeNode {
+		/* member types */
+
+			static const size_type	capacity = BTREE_NODE_BYTES / sizeof(T) < BTREE_MIN_CAPACITY ?
+				BTREE_MIN_CAPACITY : BTREE_NODE_BYTES / sizeof(T);
+
+		/* attributes */
+
+			btreeLeaf					*prev;
+			btreeLeaf					*next;
+			btreeStorage<T, capacity>	storage;
+
+		/* member functions */
+
+			T *	values(void) { return reinterpret_cast<T *>(storage.bytes); }
+
+			T &	value(size_type pos) { return values()[pos]; }
+	};
+
+	/**
+	 * @brief internal node of a btree: count separating keys and count + 1 children
+	 * @note every key of children[i] goes before keys[i], which goes before every key of children[i + 1] or is one of them.
+	 */
+	template < class Key >
+	struct btreeInternal : public btreeNode {
+		/* member types */
+
+			static const size_type	capacity = BTREE_NODE_BYTES / sizeof(Key) < BTREE_MIN_CAPACITY ?
+				BTREE_MIN_CAPACITY : BTREE_NODE_BYTES / sizeof(Key);
+
+		/* attributes */
+
+			btreeStorage<Key, capacity>	storage;
+			btreeNode					*children[capacity + 1];
+
+		/* member functions */
+
+			Key *	keys(void) { return reinterpret_cast<Key *>(storage.bytes); }
+	};
+
+/**
+ * @class template: btree
+ */
+
+	/**
+	 * @brief B+ tree
+	 * @note the values are kept in sorted arrays, the leaves, linked in order: a lookup misses the cache
+	 * once per level of a tree of a few levels, a scan walks the arrays one after the other.
+	 * the internal nodes only hold copies of keys to route the searches, in arrays searched in place
+	 * (see btree_linear_search). every node but the root is at least half full,
+	 * except on the right edge of the tree where an insertion past the last value leaves the node
+	 * it splits full: sorted input (bulk loading) fills every node, in O(1) amortized per value.
+	 * values move between nodes when they split or merge: an insertion or an erasure invalidates
+	 * every iterator and reference into the tree.
+	 *
+	 * @param Key: type of the keys the tree is ordered by (copied into the internal nodes).
+	 * @param T: type of the values stored in the leaves.
+	 * @param KeyOfValue: function object returning a (const reference to the) key of a value.
+	 * @param Compare: strict weak ordering on keys.
+	 * @param Alloc: allocator of T, rebound to the nodes and the keys.
+	 */
+	template < class Key,
+		class T,
+		class KeyOfValue,
+		class Compare,
+		class Alloc = std::allocator<T> >
+	class btree {
+		public:
+		/* member types */
+
+			typedef				Key																key_type;
+			typedef				T																value_type;
+			typedef				Compare															key_compare;
+			typedef				Alloc															allocator_type;
+
+			typedef				btreeNode														node_type;
+			typedef				btreeLeaf<value_type>											leaf_type;
+			typedef				btreeInternal<key_type>											internal_type;
+
+			typedef				ft::btreeIterator<value_type, leaf_type>						iterator;
+			typedef				ft::btreeIterator<const value_type, leaf_type>					const_iterator;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type									difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type										size_type;
+
+		private:
+		/* member types (private) */
+
+			typedef typename	allocator_type::template rebind<key_type>::other				key_allocator;
+			typedef typename	allocator_type::template rebind<leaf_type>::other				leaf_allocator;
+			typedef typename	allocator_type::template rebind<internal_type>::other			internal_allocator;
+
+			static const size_type	LEAF_CAPACITY = leaf_type::capacity;
+			static const size_type	LEAF_MIN = leaf_type::capacity / 2;
+			static const size_type	INTERNAL_CAPACITY = internal_type::capacity;
+			static const size_type	INTERNAL_MIN = internal_type::capacity / 2;
+
+		public:
+		/* member function: constructor / destructor  */
+
+			btree(key_compare const & comp = key_compare(), allocator_type const & alloc = allocator_type()) :
+				_root(ft_nullptr),
+				_first(ft_nullptr),
+				_last(ft_nullptr),
+				_size(0),
+				_comp(comp),
+				_alloc(alloc) {}
+
+			/** @brief copy: clone the nodes of src as they are, in O(n) */
+			btree(btree const & src) :
+				_root(ft_nullptr),
+				_first(ft_nullptr),
+				_last(ft_nullptr),
+				_size(0),
+				_comp(src._comp),
+				_alloc(src._alloc) {
+				cloneTree(src);
+			}
+
+			~btree() { clear(); }
+
+			btree &	operator=(btree const & rhs) {
+				if (this == &rhs) return *this;
+
+				clear();
+				_comp = rhs._comp;
+				cloneTree(rhs);
+				return *this;
+			}
+
+		/* member function: getters  */
+
+			key_compare		getComp() const { return _comp; }
+
+			allocator_type	get_allocator() const { return _alloc; }
+
+		/* member function: capacity  */
+
+			bool		empty() const { return _size == 0; }
+
+			size_type	size() const { return _size; }
+
+			size_type	max_size() const { return _alloc.max_size(); }
+
+		/* member function: iterators  */
+
+			iterator		begin() { return iterator(_first, 0); }
+
+			const_iterator	begin() const { return const_iterator(_first, 0); }
+
+			iterator		end() { return past(); }
+
+			const_iterator	end() const { return past(); }
+
+		/* member function: operation  */
+
+			iterator	find(key_type const & key) const {
+				iterator it = lower_bound(key);
+
+				if (it == past() || _comp(key, keyOf(*it)))
+					return past();
+				return it;
+			}
+
+			/** @note first value whose key does not go before key: one descent, one search per node */
+			iterator	lower_bound(key_type const & key) const {
+				if (_root == ft_nullptr)
+					return past();
+
+				leaf_type *leaf = findLeaf(key);
+
+				return position(leaf, countBefore(leaf->values(), leaf->count, key, KeyOfValue()));
+			}
+
+			/** @note first value whose key goes after key */
+			iterator	upper_bound(key_type const & key) const {
+				if (_root == ft_nullptr)
+					return past();
+
+				leaf_type *leaf = findLeaf(key);
+
+				return position(leaf, countNotAfter(leaf->values(), leaf->count, key, KeyOfValue()));
+			}
+
+		/* member function: modifiers  */
+
+			/**
+			 * @brief insert a value if no equivalent one is in the tree
+			 * @return a pair with the position of the value (new or existing) and whether it was inserted.
+			 */
+			ft::pair<iterator, bool>	insert(value_type const & val) {
+				if (_root == ft_nullptr)
+					return ft::make_pair(insertAt(ft_nullptr, 0, val), true);
+
+				key_type const &	key = keyOf(val);
+				leaf_type			*leaf = findLeaf(key);
+				size_type			pos = countBefore(leaf->values(), leaf->count, key, KeyOfValue());
+
+				if (pos != leaf->count && _comp(key, keyOf(leaf->value(pos))) == false)
+					return ft::make_pair(iterator(leaf, pos), false);
+				return ft::make_pair(insertAt(leaf, pos, val), true);
+			}
+
+			/**
+			 * @brief insert a value next to a hint
+			 * @note if val goes after every value and hint is end(), it is appended to the last leaf
+			 * without any descent: O(1) amortized for sorted input, which leaves every node full.
+			 * it goes in place as well if it goes right before hint in the same leaf. otherwise falls back to insert(val).
+			 */
+			ft::pair<iterator, bool>	insert(iterator hint, value_type const & val) {
+				key_type const & key = keyOf(val);
+
+				if (hint == end()) {
+					if (_last != ft_nullptr && _comp(keyOf(_last->value(_last->count - 1)), key))
+						return ft::make_pair(insertAt(_last, _last->count, val), true);
+				}
+				else if (hint.getPos() != 0 && _comp(key, keyOf(*hint))
+					&& _comp(keyOf(hint.getLeaf()->value(hint.getPos() - 1)), key))
+					return ft::make_pair(insertAt(hint.getLeaf(), hint.getPos(), val), true);
+				return insert(val);
+			}
+
+			/** @note fill from a range: sorted input is appended (bulk loading), the rest is inserted */
+			template < class InputIterator >
+			void	insert(InputIterator first, InputIterator last) {
+				for (; first != last; ++first)
+					insert(end(), *first);
+			}
+
+			/** @return 1 if the value of key was erased, 0 if there was none */
+			size_type	erase(key_type const & key) {
+				iterator it = find(key);
+
+				if (it == end())
+					return 0;
+				erase(it);
+				return 1;
+			}
+
+			/**
+			 * @brief erase the value at a position
+			 * @note O(log n) at worst: a leaf left less than half full takes a value from a sibling or merges with it,
+			 * which may go on up the tree.
+			 *
+			 * @return the position of the value which followed the erased one.
+			 */
+			iterator	erase(iterator it) {
+				leaf_type	*leaf = it.getLeaf();
+				size_type	pos = it.getPos();
+
+				eraseValue(leaf, pos);
+				if (leaf == _root && leaf->count == 0) {
+					clear();
+					return end();
+				}
+				if (leaf == _root || leaf->count >= LEAF_MIN)
+					return position(leaf, pos);
+
+				// the leaf changes: the next value is found again by its key
+				if (pos == leaf->count && leaf->next == ft_nullptr) {
+					rebalanceLeaf(leaf);
+					return end();
+				}
+
+				key_type next = keyOf(*position(leaf, pos));
+
+				rebalanceLeaf(leaf);
+				return lower_bound(next);
+			}
+
+			/** @note O(k log n) for k values, the whole tree is torn down in O(n) */
+			iterator	erase(iterator first, iterator last) {
+				if (first == begin() && last == end()) {
+					clear();
+					return end();
+				}
+
+				size_type n = 0;
+
+				for (iterator it = first; it != last; ++it)
+					++n;
+				for (; n != 0; --n)
+					first = erase(first);
+				return first;
+			}
+
+			void	swap(btree & toSwap) {
+				swapValue(_root, toSwap._root);
+				swapValue(_first, toSwap._first);
+				swapValue(_last, toSwap._last);
+				swapValue(_size, toSwap._size);
+				swapValue(_comp, toSwap._comp);
+				swapValue(_alloc, toSwap._alloc);
+			}
+
+			void	clear() {
+				if (_root != ft_nullptr)
+					destroyNode(_root);
+				_root = ft_nullptr;
+				_first = ft_nullptr;
+				_last = ft_nullptr;
+				_size = 0;
+			}
+
+		/* member function: introspection  */
+
+			/** @brief number of levels, 0 for an empty tree */
+			size_type	height() const {
+				size_type height = 0;
+
+				for (node_type *node = _root; node != ft_nullptr; ++height)
+					node = node->leaf ? ft_nullptr : toInternal(node)->children[0];
+				return height;
+			}
+
+			static key_type const &	keyOf(value_type const & val) { return KeyOfValue()(val); }
+
+		private:
+		/* member function (private): search  */
+
+			/**
+			 * @brief number of the n first entries whose key goes before key (countBefore)
+			 * or does not go after key (countNotAfter): the place of key in a node
+			 */
+			template < class U, class Extract >
+			size_type	countBefore(U const * entries, size_type n, key_type const & key, Extract extract) const {
+				if (btree_linear_search<key_type, key_compare>::value) {
+					size_type count = 0;
+
+					for (size_type i = 0; i < n; ++i)
+						count += _comp(extract(entries[i]), key) ? 1 : 0;
+					return count;
+				}
+
+				size_type low = 0;
+
+				while (n != 0) {
+					size_type half = n / 2;
+
+					if (_comp(extract(entries[low + half]), key)) {
+						low += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return low;
+			}
+
+			template < class U, class Extract >
+			size_type	countNotAfter(U const * entries, size_type n, key_type const & key, Extract extract) const {
+				if (btree_linear_search<key_type, key_compare>::value) {
+					size_type count = 0;
+
+					for (size_type i = 0; i < n; ++i)
+						count += _comp(key, extract(entries[i])) ? 0 : 1;
+					return count;
+				}
+
+				size_type low = 0;
+
+				while (n != 0) {
+					size_type half = n / 2;
+
+					if (_comp(key, extract(entries[low + half])) == false) {
+						low += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return low;
+			}
+
+			/** @note the child of an internal node holding key is the one after the separators not going after it */
+			leaf_type *	findLeaf(key_type const & key) const {
+				node_type *node = _root;
+
+				while (node->leaf == false) {
+					internal_type *internal = toInternal(node);
+
+					node = internal->children[countNotAfter(internal->keys(), internal->count, key, ft::identity<key_type>())];
+				}
+				return toLeaf(node);
+			}
+
+			iterator	past() const { return iterator(_last, _last == ft_nullptr ? 0 : _last->count); }
+
+			/** @brief the iterator of a position, past the end of a leaf is the first value of the next one */
+			iterator	position(leaf_type * leaf, size_type pos) const {
+				if (pos == leaf->count && leaf->next != ft_nullptr)
+					return iterator(leaf->next, 0);
+				return iterator(leaf, pos);
+			}
+
+			static leaf_type *		toLeaf(node_type * node) { return static_cast<leaf_type *>(node); }
+
+			static internal_type *	toInternal(node_type * node) { return static_cast<internal_type *>(node); }
+
+		/* member function (private): nodes  */
+
+			leaf_type *	newLeaf() {
+				leaf_type *leaf = leaf_allocator(_alloc).allocate(1);
+
+				leaf->parent = ft_nullptr;
+				leaf->position = 0;
+				leaf->count = 0;
+				leaf->leaf = true;
+				leaf->prev = ft_nullptr;
+				leaf->next = ft_nullptr;
+				return leaf;
+			}
+
+			internal_type *	newInternal() {
+				internal_type *internal = internal_allocator(_alloc).allocate(1);
+
+				internal->parent = ft_nullptr;
+				internal->position = 0;
+				internal->count = 0;
+				internal->leaf = false;
+				return internal;
+			}
+
+			/** @brief destroy the entries of a subtree and give its nodes back (the recursion is as deep as the tree) */
+			void	destroyNode(node_type * node) {
+				if (node->leaf) {
+					leaf_type *leaf = toLeaf(node);
+
+					for (size_type i = 0; i < leaf->count; ++i)
+						_alloc.destroy(leaf->values() + i);
+					leaf_allocator(_alloc).deallocate(leaf, 1);
+					return ;
+				}
+
+				internal_type	*internal = toInternal(node);
+				key_allocator	keyAlloc(_alloc);
+
+				for (size_type i = 0; i < internal->count; ++i)
+					keyAlloc.destroy(internal->keys() + i);
+				for (size_type i = 0; i <= internal->count; ++i)
+					destroyNode(internal->children[i]);
+				internal_allocator(_alloc).deallocate(internal, 1);
+			}
+
+			/** @brief move n constructed entries to raw storage, from the last one (the ranges may overlap on the right) */
+			template < class U, class A >
+			static void	moveBackward(A alloc, U * from, size_type n, U * to) {
+				while (n-- != 0) {
+					alloc.construct(to + n, from[n]);
+					alloc.destroy(from + n);
+				}
+			}
+
+			/** @brief move n constructed entries to raw storage, from the first one (the ranges may overlap on the left) */
+			template < class U, class A >
+			static void	moveForward(A alloc, U * from, size_type n, U * to) {
+				for (size_type i = 0; i < n; ++i) {
+					alloc.construct(to + i, from[i]);
+					alloc.destroy(from + i);
+				}
+			}
+
+			/** @brief put child at place pos of node */
+			static void	setChild(internal_type * node, size_type pos, node_type * child) {
+				node->children[pos] = child;
+				child->parent = node;
+				child->position = pos;
+			}
+
+			/** @brief move n children of an internal node to another one (or another place of the same), renumbering them */
+			static void	moveChildren(internal_type * from, size_type first, size_type n, internal_type * to, size_type dest) {
+				if (from == to && dest > first) {
+					while (n-- != 0)
+						setChild(to, dest + n, from->children[first + n]);
+					return ;
+				}
+				for (size_type i = 0; i < n; ++i)
+					setChild(to, dest + i, from->children[first + i]);
+			}
+
+		/* member function (private): insertion  */
+
+			/**
+			 * @brief construct val at place pos of leaf, splitting it if it is full (the tree is empty if leaf is ft_nullptr)
+			 * @return the position of the new value.
+			 */
+			iterator	insertAt(leaf_type * leaf, size_type pos, value_type const & val) {
+				if (leaf == ft_nullptr) {
+					leaf = newLeaf();
+					_root = leaf;
+					_first = leaf;
+					_last = leaf;
+				}
+				else if (leaf->count == LEAF_CAPACITY)
+					splitLeaf(leaf, pos);
+
+				moveBackward(_alloc, leaf->values() + pos, leaf->count - pos, leaf->values() + pos + 1);
+				_alloc.construct(leaf->values() + pos, val);
+				++leaf->count;
+				++_size;
+
+				if (leaf->prev != ft_nullptr && pos == 0 && leaf->count == 1)
+					addSeparator(leaf);
+				return iterator(leaf, pos);
+			}
+
+			/**
+			 * @brief make room in a full leaf for a value going at pos
+			 * @note leaf and pos are updated to where the value goes. the upper half of the values goes to a new leaf,
+			 * or none of them when the value goes past the last one of the tree: the new leaf starts empty
+			 * and its separator is added once the value is in (see insertAt).
+			 */
+			void	splitLeaf(leaf_type * & leaf, size_type & pos) {
+				leaf_type	*right = newLeaf();
+				size_type	moved = (leaf == _last && pos == leaf->count) ? 0 : LEAF_CAPACITY / 2;
+
+				right->prev = leaf;
+				right->next = leaf->next;
+				if (leaf->next != ft_nullptr)
+					leaf->next->prev = right;
+				else
+					_last = right;
+				leaf->next = right;
+
+				leaf->count -= moved;
+				moveForward(_alloc, leaf->values() + leaf->count, moved, right->values());
+				right->count = moved;
+
+				if (moved != 0)
+					addSeparator(right);
+				if (pos > leaf->count) {
+					pos -= leaf->count;
+					leaf = right;
+				}
+				else if (moved == 0) {
+					pos = 0;
+					leaf = right;
+				}
+			}
+
+			/** @brief link a new leaf (holding values) after the previous one, under the separator of its first key */
+			void	addSeparator(leaf_type * right) {
+				leaf_type *left = right->prev;
+
+				insertChild(left, keyOf(right->value(0)), right);
+			}
+
+			/**
+			 * @brief link child right after left, with key as their separator
+			 * @note left is the root: a new root is made. the parent is full: it is split, which goes on up the tree.
+			 */
+			void	insertChild(node_type * left, key_type const & key, node_type * child) {
+				internal_type	*parent = toInternal(left->parent);
+				key_allocator	keyAlloc(_alloc);
+
+				if (parent == ft_nullptr) {
+					parent = newInternal();
+					keyAlloc.construct(parent->keys(), key);
+					parent->count = 1;
+					setChild(parent, 0, left);
+					setChild(parent, 1, child);
+					_root = parent;
+					return ;
+				}
+
+				size_type pos = left->position;
+
+				if (parent->count == INTERNAL_CAPACITY) {
+					splitInternal(parent, pos, key, child);
+					return ;
+				}
+				moveBackward(keyAlloc, parent->keys() + pos, parent->count - pos, parent->keys() + pos + 1);
+				keyAlloc.construct(parent->keys() + pos, key);
+				moveChildren(parent, pos + 1, parent->count - pos, parent, pos + 2);
+				setChild(parent, pos + 1, child);
+				++parent->count;
+			}
+
+			/**
+			 * @brief split a full internal node to insert key at place pos and child after it
+			 * @note the node keeps the lower half of its keys, the middle one goes up as the separator of the new node.
+			 * at the right edge of the tree (key goes past the last one), the node stays full but one key.
+			 */
+			void	splitInternal(internal_type * node, size_type pos, key_type const & key, node_type * child) {
+				key_allocator	keyAlloc(_alloc);
+				internal_type	*right = newInternal();
+				bool			edge = pos == node->count && isRightEdge(node);
+				size_type		middle = edge ? INTERNAL_CAPACITY - 1 : INTERNAL_CAPACITY / 2;
+				key_type		up = node->keys()[middle];
+
+				// keys after the middle one, and the children after it, go to the new node
+				moveForward(keyAlloc, node->keys() + middle + 1, node->count - middle - 1, right->keys());
+				moveChildren(node, middle + 1, node->count - middle, right, 0);
+				right->count = node->count - middle - 1;
+				keyAlloc.destroy(node->keys() + middle);
+				node->count = middle;
+
+				internal_type	*target = node;
+
+				if (pos > middle) {
+					target = right;
+					pos -= middle + 1;
+				}
+				moveBackward(keyAlloc, target->keys() + pos, target->count - pos, target->keys() + pos + 1);
+				keyAlloc.construct(target->keys() + pos, key);
+				moveChildren(target, pos + 1, target->count - pos, target, pos + 2);
+				setChild(target, pos + 1, child);
+				++target->count;
+
+				insertChild(node, up, right);
+			}
+
+			/** @note on the path from the root to the last leaf */
+			static bool	isRightEdge(node_type * node) {
+				for (; node->parent != ft_nullptr; node = node->parent) {
+					if (node->position != node->parent->count)
+						return false;
+				}
+				return true;
+			}
+
+		/* member function (private): erasure  */
+
+			void	eraseValue(leaf_type * leaf, size_type pos) {
+				_alloc.destroy(leaf->values() + pos);
+				moveForward(_alloc, leaf->values() + pos + 1, leaf->count - pos - 1, leaf->values() + pos);
+				--leaf->count;
+				--_size;
+			}
+
+			/**
+			 * @brief fill a leaf less than half full from a sibling: take one value if it can spare it, or merge with it
+			 * @note a merge takes a separator out of the parent, which may then need the same.
+			 */
+			void	rebalanceLeaf(leaf_type * leaf) {
+				internal_type	*parent = toInternal(leaf->parent);
+				size_type		pos = leaf->position;
+				leaf_type		*left = pos != 0 ? toLeaf(parent->children[pos - 1]) : ft_nullptr;
+				leaf_type		*right = pos != parent->count ? toLeaf(parent->children[pos + 1]) : ft_nullptr;
+
+				if (left != ft_nullptr && left->count + leaf->count <= LEAF_CAPACITY)
+					return mergeLeaves(left, leaf);
+				if (right != ft_nullptr && leaf->count + right->count <= LEAF_CAPACITY)
+					return mergeLeaves(leaf, right);
+
+				key_allocator keyAlloc(_alloc);
+
+				if (left != ft_nullptr) {
+					moveBackward(_alloc, leaf->values(), leaf->count, leaf->values() + 1);
+					moveForward(_alloc, left->values() + left->count - 1, 1, leaf->values());
+					--left->count;
+					++leaf->count;
+					keyAlloc.destroy(parent->keys() + pos - 1);
+					keyAlloc.construct(parent->keys() + pos - 1, keyOf(leaf->value(0)));
+				}
+				else {
+					moveForward(_alloc, right->values(), 1, leaf->values() + leaf->count);
+					moveForward(_alloc, right->values() + 1, right->count - 1, right->values());
+					--right->count;
+					++leaf->count;
+					keyAlloc.destroy(parent->keys() + pos);
+					keyAlloc.construct(parent->keys() + pos, keyOf(right->value(0)));
+				}
+			}
+
+			/** @brief move the values of right at the end of left, drop right and its separator */
+			void	mergeLeaves(leaf_type * left, leaf_type * right) {
+				moveForward(_alloc, right->values(), right->count, left->values() + left->count);
+				left->count += right->count;
+				left->next = right->next;
+				if (right->next != ft_nullptr)
+					right->next->prev = left;
+				else
+					_last = left;
+				removeChild(toInternal(left->parent), right->position);
+				leaf_allocator(_alloc).deallocate(right, 1);
+			}
+
+			/**
+			 * @brief take the child at place pos (and the separator before it) out of an internal node
+			 * @note the root left without any separator gives its place to its only child.
+			 */
+			void	removeChild(internal_type * node, size_type pos) {
+				key_allocator keyAlloc(_alloc);
+
+				keyAlloc.destroy(node->keys() + pos - 1);
+				moveForward(keyAlloc, node->keys() + pos, node->count - pos, node->keys() + pos - 1);
+				moveChildren(node, pos + 1, node->count - pos, node, pos);
+				--node->count;
+
+				if (node == _root) {
+					if (node->count == 0) {
+						_root = node->children[0];
+						_root->parent = ft_nullptr;
+						_root->position = 0;
+						internal_allocator(_alloc).deallocate(node, 1);
+					}
+				}
+				else if (node->count < INTERNAL_MIN)
+					rebalanceInternal(node);
+			}
+
+			/** @brief same as rebalanceLeaf, the separators of the parent rotate through it */
+			void	rebalanceInternal(internal_type * node) {
+				internal_type	*parent = toInternal(node->parent);
+				size_type		pos = node->position;
+				internal_type	*left = pos != 0 ? toInternal(parent->children[pos - 1]) : ft_nullptr;
+				internal_type	*right = pos != parent->count ? toInternal(parent->children[pos + 1]) : ft_nullptr;
+				key_allocator	keyAlloc(_alloc);
+
+				if (left != ft_nullptr && left->count + 1 + node->count <= INTERNAL_CAPACITY)
+					return mergeInternals(left, node);
+				if (right != ft_nullptr && node->count + 1 + right->count <= INTERNAL_CAPACITY)
+					return mergeInternals(node, right);
+
+				if (left != ft_nullptr) {
+					// the separator comes down in front of node, the last key of left goes up in its place
+					moveBackward(keyAlloc, node->keys(), node->count, node->keys() + 1);
+					moveForward(keyAlloc, parent->keys() + pos - 1, 1, node->keys());
+					moveForward(keyAlloc, left->keys() + left->count - 1, 1, parent->keys() + pos - 1);
+					moveChildren(node, 0, node->count + 1, node, 1);
+					setChild(node, 0, left->children[left->count]);
+					--left->count;
+					++node->count;
+				}
+				else {
+					moveForward(keyAlloc, parent->keys() + pos, 1, node->keys() + node->count);
+					moveForward(keyAlloc, right->keys(), 1, parent->keys() + pos);
+					setChild(node, node->count + 1, right->children[0]);
+					moveForward(keyAlloc, right->keys() + 1, right->count - 1, right->keys());
+					moveChildren(right, 1, right->count, right, 0);
+					--right->count;
+					++node->count;
+				}
+			}
+
+			/** @brief move the separator of right then its keys and children at the end of left, drop right */
+			void	mergeInternals(internal_type * left, internal_type * right) {
+				key_allocator	keyAlloc(_alloc);
+				internal_type	*parent = toInternal(left->parent);
+
+				keyAlloc.construct(left->keys() + left->count, parent->keys()[right->position - 1]);
+				moveForward(keyAlloc, right->keys(), right->count, left->keys() + left->count + 1);
+				moveChildren(right, 0, right->count + 1, left, left->count + 1);
+				left->count += right->count + 1;
+				removeChild(parent, right->position);
+				internal_allocator(_alloc).deallocate(right, 1);
+			}
+
+		/* member function (private): copy  */
+
+			void	cloneTree(btree const & src) {
+				if (src._root == ft_nullptr)
+					return ;
+
+				leaf_type *prev = ft_nullptr;
+
+				_root = cloneNode(src._root, ft_nullptr, 0, prev);
+				_last = prev;
+				_size = src._size;
+			}
+
+			/** @note the leaves are linked as they are cloned, in order: prev is the last one so far */
+			node_type *	cloneNode(node_type * src, internal_type * parent, size_type pos, leaf_type * & prev) {
+				node_type *node;
+
+				if (src->leaf) {
+					leaf_type *leaf = newLeaf();
+
+					for (; leaf->count < src->count; ++leaf->count)
+						_alloc.construct(leaf->values() + leaf->count, toLeaf(src)->value(leaf->count));
+					leaf->prev = prev;
+					if (prev != ft_nullptr)
+						prev->next = leaf;
+					else
+						_first = leaf;
+					prev = leaf;
+					node = leaf;
+				}
+				else {
+					internal_type	*internal = newInternal();
+					key_allocator	keyAlloc(_alloc);
+
+					for (; internal->count < src->count; ++internal->count)
+						keyAlloc.construct(internal->keys() + internal->count, toInternal(src)->keys()[internal->count]);
+					for (size_type i = 0; i <= src->count; ++i)
+						internal->children[i] = cloneNode(toInternal(src)->children[i], internal, i, prev);
+					node = internal;
+				}
+				node->parent = parent;
+				node->position = pos;
+				return node;
+			}
+
+			template < class U >
+			static void	swapValue(U & a, U & b) {
+				U tmp = a;
+
+				a = b;
+				b = tmp;
+			}
+
+		private:
+		/* attributes */
+
+			node_type		*_root;
+			leaf_type		*_first;
+			leaf_type		*_last;
+			size_type		_size;
+			key_compare		_comp;
+			allocator_type	_alloc;
+	};
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btreeIte.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 10:12:40 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 10:12:40 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREEITE_HPP
+# define BTREEITE_HPP
+
+#include "iterator.hpp"
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: btreeIterator
+ */
+
+	/**
+	 * @class template: btreeIterator
+	 * @brief bidirectional iterator
+	 * @note a leaf and a position in it: the leaves of a btree are linked in order, so a scan never goes up the tree.
+	 * end() is the position past the last element of the last leaf (no leaf at all when the tree is empty),
+	 * any other position is a valid element: a position past the end of a leaf which is not the last one
+	 * is never handed out, it is the first element of the next leaf.
+	 */
+	template < class T, class Leaf >
+	class btreeIterator : public ft::iterator<bidirectional_iterator_tag, T> {
+		public:
+		/* member types */
+
+			typedef 			T																		value_type;
+
+			typedef typename	ft::iterator<bidirectional_iterator_tag, value_type>::difference_type	difference_type;
+			typedef typename 	ft::iterator<bidirectional_iterator_tag, value_type>::pointer			pointer;
+			typedef typename 	ft::iterator<bidirectional_iterator_tag, value_type>::reference			reference;
+			typedef typename 	ft::iterator<bidirectional_iterator_tag, value_type>::iterator_category	iterator_category;
+
+			typedef				Leaf								leaf_type;
+			typedef				Leaf*								leaf_pointer;
+			typedef typename	Leaf::size_type						size_type;
+
+		public:
+		/* member functions */
+
+		/* constructor / destructor / operator= */
+
+			btreeIterator(void) : _leaf(ft_nullptr), _pos(0) {}
+
+			btreeIterator(leaf_pointer leaf, size_type pos) : _leaf(leaf), _pos(pos) {}
+
+			btreeIterator(btreeIterator const & src) : _leaf(src._leaf), _pos(src._pos) {}
+
+			~btreeIterator(void) {}
+
+			btreeIterator & operator= (btreeIterator const & rhs) {
+				if (this == &rhs) return *this;
+
+				_leaf = rhs._leaf;
+				_pos = rhs._pos;
+				return *this;
+			}
+
+		/* getters */
+
+			leaf_pointer	getLeaf(void) const { return _leaf; }
+
+			size_type		getPos(void) const { return _pos; }
+
+		/* operator */
+
+			reference	operator* (void) const { return _leaf->value(_pos); }
+
+			pointer		operator->(void) const { return &(operator*()); }
+
+			/** @brief increment position (O(1), the next leaf is linked) */
+			btreeIterator &	operator++ (void) {
+				if (++_pos == _leaf->count && _leaf->next != ft_nullptr) {
+					_leaf = _leaf->next;
+					_pos = 0;
+				}
+				return *this;
+			}
+
+			btreeIterator	operator++ (int) {
+				btreeIterator tmp(*this);
+				operator++();
+				return tmp;
+			}
+
+			/** @brief decrease position (O(1), --end() is the last element of the last leaf) */
+			btreeIterator &	operator-- (void) {
+				if (_pos == 0) {
+					_leaf = _leaf->prev;
+					_pos = _leaf->count;
+				}
+				--_pos;
+				return *this;
+			}
+
+			btreeIterator	operator-- (int) {
+				btreeIterator tmp(*this);
+				operator--();
+				return tmp;
+			}
+
+			operator btreeIterator<const T, Leaf> (void) const {
+				return btreeIterator<const T, Leaf>(_leaf, _pos);
+			}
+
+		private:
+		/** attributes */
+
+			leaf_pointer	_leaf;
+			size_type		_pos;
+	};
+
+	template < class _TL, class _TR, class _Leaf >
+	bool operator== (const btreeIterator<_TL, _Leaf> & lhs, const btreeIterator<_TR, _Leaf> & rhs) {
+		return lhs.getLeaf() == rhs.getLeaf() && lhs.getPos() == rhs.getPos();
+	}
+
+	template < class _TL, class _TR, class _Leaf >
+	bool operator!= (const btreeIterator<_TL, _Leaf> & lhs, const btreeIterator<_TR, _Leaf> & rhs) {
+		return !(lhs == rhs);
+	}
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
@@ -0,0 +1,238 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flatIte.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 15:20:47 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 15:20:47 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLATITE_HPP
+# define FLATITE_HPP
+
+#include "iterator.hpp"
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: flatReference / flatPointer
+ */
+
+	template < class Key, class T, class Mapped >
+	struct flatPointer;
+
+	/**
+	 * @brief reference to an element of a flat_map: references to its key and to its mapped value
+	 * @note the keys and the mapped values live in two arrays, there is no ft::pair to refer to.
+	 * it converts to the value_type of the map (a copy), and compares like it.
+	 * taking its address gives a flatPointer, so reverse_iterator::operator-> works as is.
+	 *
+	 * @param Mapped: T, or const T for a const_iterator.
+	 */
+	template < class Key, class T, class Mapped >
+	struct flatReference {
+	/* attributes */
+
+		const Key	&first;
+		Mapped		&second;
+
+	/* member functions */
+
+		flatReference(const Key & k, Mapped & v) : first(k), second(v) {}
+
+		operator ft::pair<const Key, T> (void) const { return ft::pair<const Key, T>(first, second); }
+
+		flatPointer<Key, T, Mapped>	operator&(void) const { return flatPointer<Key, T, Mapped>(*this); }
+
+		/** @note the address of the reference itself, for flatPointer */
+		const flatReference *	self(void) const { return this; }
+	};
+
+	/** @brief what operator-> of a flat_map iterator returns: holds the reference, gives access to first and second */
+	template < class Key, class T, class Mapped >
+	struct flatPointer {
+		flatPointer(flatReference<Key, T, Mapped> const & r) : ref(r) {}
+
+		const flatReference<Key, T, Mapped> *	operator->(void) const { return ref.self(); }
+
+		flatReference<Key, T, Mapped>	ref;
+	};
+
+	/** @note same as the relational operators of pair: by key, then by mapped value */
+	template < class Key, class T, class Mapped >
+	bool operator== (const flatReference<Key, T, Mapped> & lhs, const flatReference<Key, T, Mapped> & rhs) {
+		return lhs.first == rhs.first && lhs.second == rhs.second;
+	}
+
+	template < class Key, class T, class Mapped >
+	bool operator!= (const flatReference<Key, T, Mapped> & lhs, const flatReference<Key, T, Mapped> & rhs) {
+		return !(lhs == rhs);
+	}
+
+	template < class Key, class T, class Mapped >
+	bool operator< (const flatReference<Key, T, Mapped> & lhs, const flatReference<Key, T, Mapped> & rhs) {
+		return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+	}
+
+/**
+ * @class template: flatIterator
+ */
+
+	/**
+	 * @class template: flatIterator
+	 * @brief random-access iterator
+	 * @note a pointer into the keys and a pointer into the mapped values, moved together.
+	 *
+	 * @param Key: type of the keys.
+	 * @param T: type of the mapped values.
+	 * @param Mapped: T, or const T for a const_iterator.
+	 */
+	template < class Key, class T, class Mapped >
+	class flatIterator : public ft::iterator<random_access_iterator_tag, ft::pair<const Key, T>, ptrdiff_t,
+		flatPointer<Key, T, Mapped>, flatReference<Key, T, Mapped> > {
+		public:
+		/* member types */
+
+			typedef				ft::iterator<random_access_iterator_tag, ft::pair<const Key, T>, ptrdiff_t,
+									flatPointer<Key, T, Mapped>, flatReference<Key, T, Mapped> >		base_type;
+
+			typedef typename	base_type::value_type											value_type;
+			typedef typename	base_type::difference_type										difference_type;
+			typedef typename	base_type::pointer												pointer;
+			typedef typename	base_type::reference											reference;
+			typedef typename	base_type::iterator_category									iterator_category;
+
+		public:
+		/* member functions */
+
+		/* constructor / destructor / operator= */
+
+			flatIterator(void) : _key(ft_nullptr), _value(ft_nullptr) {}
+
+			flatIterator(const Key * key, Mapped * value) : _key(key), _value(value) {}
+
+			flatIterator(flatIterator const & src) : _key(src._key), _value(src._value) {}
+
+			~flatIterator(void) {}
+
+			flatIterator & operator= (flatIterator const & rhs) {
+				if (this == &rhs) return *this;
+
+				_key = rhs._key;
+				_value = rhs._value;
+				return *this;
+			}
+
+		/* getters */
+
+			const Key *	keyBase(void) const { return _key; }
+
+			Mapped *	valueBase(void) const { return _value; }
+
+		/* operator */
+
+			reference	operator* (void) const { return reference(*_key, *_value); }
+
+			pointer		operator->(void) const { return pointer(operator*()); }
+
+			reference	operator[] (difference_type n) const { return reference(_key[n], _value[n]); }
+
+			flatIterator &	operator++ (void) {
+				++_key;
+				++_value;
+				return *this;
+			}
+
+			flatIterator	operator++ (int) {
+				flatIterator tmp(*this);
+				operator++();
+				return tmp;
+			}
+
+			flatIterator &	operator-- (void) {
+				--_key;
+				--_value;
+				return *this;
+			}
+
+			flatIterator	operator-- (int) {
+				flatIterator tmp(*this);
+				operator--();
+				return tmp;
+			}
+
+			flatIterator &	operator+= (difference_type n) {
+				_key += n;
+				_value += n;
+				return *this;
+			}
+
+			flatIterator &	operator-= (difference_type n) {
+				_key -= n;
+				_value -= n;
+				return *this;
+			}
+
+			flatIterator	operator+ (difference_type n) const { return flatIterator(_key + n, _value + n); }
+
+			flatIterator	operator- (difference_type n) const { return flatIterator(_key - n, _value - n); }
+
+			operator flatIterator<Key, T, const T> (void) const {
+				return flatIterator<Key, T, const T>(_key, _value);
+			}
+
+		private:
+		/** attributes */
+
+			const Key	*_key;
+			Mapped		*_value;
+	};
+
+	/** @note the keys tell the positions: iterators of a map and its const_iterators compare with each other */
+	template < class Key, class T, class _ML, class _MR >
+	bool operator== (const flatIterator<Key, T, _ML> & lhs, const flatIterator<Key, T, _MR> & rhs) {
+		return lhs.keyBase() == rhs.keyBase();
+	}
+
+	template < class Key, class T, class _ML, class _MR >
+	bool operator!= (const flatIterator<Key, T, _ML> & lhs, const flatIterator<Key, T, _MR> & rhs) {
+		return lhs.keyBase() != rhs.keyBase();
+	}
+
+	template < class Key, class T, class _ML, class _MR >
+	bool operator<  (const flatIterator<Key, T, _ML> & lhs, const flatIterator<Key, T, _MR> & rhs) {
+		return lhs.keyBase() < rhs.keyBase();
+	}
+
+	template < class Key, class T, class _ML, class _MR >
+	bool operator<= (const flatIterator<Key, T, _ML> & lhs, const flatIterator<Key, T, _MR> & rhs) {
+		return lhs.keyBase() <= rhs.keyBase();
+	}
+
+	template < class Key, class T, class _ML, class _MR >
+	bool operator>  (const flatIterator<Key, T, _ML> & lhs, const flatIterator<Key, T, _MR> & rhs) {
+		return lhs.keyBase() > rhs.keyBase();
+	}
+
+	template < class Key, class T, class _ML, class _MR >
+	bool operator>= (const flatIterator<Key, T, _ML> & lhs, const flatIterator<Key, T, _MR> & rhs) {
+		return lhs.keyBase() >= rhs.keyBase();
+	}
+
+	template < class Key, class T, class _ML, class _MR >
+	ptrdiff_t operator- (const flatIterator<Key, T, _ML> & lhs, const flatIterator<Key, T, _MR> & rhs) {
+		return lhs.keyBase() - rhs.keyBase();
+	}
+
+	template < class Key, class T, class Mapped >
+	flatIterator<Key, T, Mapped> operator+ (ptrdiff_t n, const flatIterator<Key, T, Mapped> & it) {
+		return it + n;
+	}
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
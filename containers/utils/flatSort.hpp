@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flatSort.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 15:02:31 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 15:02:31 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLATSORT_HPP
+# define FLATSORT_HPP
+
+#include <cstddef>
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+#define FLAT_SORT_RUN 16
+
+/**
+ * @class template: flat_lower_bound / flat_upper_bound / flat_sort
+ */
+
+	/** @brief position of the first of the n sorted keys not going before key (bisection) */
+	template < class Key, class Compare >
+	size_t	flat_lower_bound(const Key * keys, size_t n, const Key & key, Compare const & comp) {
+		size_t low = 0;
+
+		while (n != 0) {
+			size_t half = n / 2;
+
+			if (comp(keys[low + half], key)) {
+				low += half + 1;
+				n -= half + 1;
+			}
+			else
+				n = half;
+		}
+		return low;
+	}
+
+	/** @brief position of the first of the n sorted keys going after key (bisection) */
+	template < class Key, class Compare >
+	size_t	flat_upper_bound(const Key * keys, size_t n, const Key & key, Compare const & comp) {
+		size_t low = 0;
+
+		while (n != 0) {
+			size_t half = n / 2;
+
+			if (comp(key, keys[low + half]) == false) {
+				low += half + 1;
+				n -= half + 1;
+			}
+			else
+				n = half;
+		}
+		return low;
+	}
+
+	/**
+	 * @brief stable sort of the positions of n keys, by key
+	 * @note the keys do not move: the sort runs on positions (the flat containers move keys and values along),
+	 * insertion sort on runs of FLAT_SORT_RUN then bottom-up merges, O(n log n).
+	 * equivalent keys keep their order, so the first one of a range is the one a container keeps.
+	 *
+	 * @param order, buffer: arrays of n positions.
+	 * @return order or buffer, whichever holds the sorted positions.
+	 */
+	template < class Key, class Compare >
+	size_t *	flat_sort(const Key * keys, size_t n, Compare const & comp, size_t * order, size_t * buffer) {
+		for (size_t i = 0; i < n; ++i)
+			order[i] = i;
+
+		for (size_t run = 0; run < n; run += FLAT_SORT_RUN) {
+			size_t end = run + FLAT_SORT_RUN < n ? run + FLAT_SORT_RUN : n;
+
+			for (size_t i = run + 1; i < end; ++i) {
+				size_t	pos = order[i];
+				size_t	j = i;
+
+				for (; j > run && comp(keys[pos], keys[order[j - 1]]); --j)
+					order[j] = order[j - 1];
+				order[j] = pos;
+			}
+		}
+
+		for (size_t width = FLAT_SORT_RUN; width < n; width *= 2) {
+			for (size_t left = 0; left < n; left += 2 * width) {
+				size_t	mid = left + width < n ? left + width : n;
+				size_t	end = mid + width < n ? mid + width : n;
+				size_t	i = left;
+				size_t	j = mid;
+				size_t	k = left;
+
+				// the left run wins ties: stable
+				while (i < mid && j < end)
+					buffer[k++] = comp(keys[order[j]], keys[order[i]]) ? order[j++] : order[i++];
+				while (i < mid)
+					buffer[k++] = order[i++];
+				while (j < end)
+					buffer[k++] = order[j++];
+			}
+
+			size_t *tmp = order;
+
+			order = buffer;
+			buffer = tmp;
+		}
+		return order;
+	}
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/19 10:03:17 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/19 10:03:17 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_HPP
+# define HASH_HPP
+
+#include <cstddef>
+#include <climits>
+#include <cstring>
+#include <string>
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: hash
+ */
+
+	/**
+	 * @brief function object class for hashing
+	 * @note unary function object class whose call returns a hash value of its argument:
+	 * equal arguments give equal hashes. like std::hash, integers and pointers hash to their own value,
+	 * the containers mix the bits themselves (see hashMix), so a hash only has to be equal for equal keys and spread.
+	 * there is no generic version: a key type needs its own specialization, or a Hash parameter.
+	 *
+	 * @param T: type of the argument.
+	 */
+	template < class T >
+	struct hash;
+
+	#define FT_HASH_INTEGRAL(T) \
+	template <> \
+	struct hash<T> { \
+		typedef T		argument_type; \
+		typedef size_t	result_type; \
+		size_t operator() (T x) const { return static_cast<size_t>(x); } \
+	};
+
+	FT_HASH_INTEGRAL(bool)
+	FT_HASH_INTEGRAL(char)
+	FT_HASH_INTEGRAL(signed char)
+	FT_HASH_INTEGRAL(unsigned char)
+	FT_HASH_INTEGRAL(wchar_t)
+	FT_HASH_INTEGRAL(short int)
+	FT_HASH_INTEGRAL(unsigned short int)
+	FT_HASH_INTEGRAL(int)
+	FT_HASH_INTEGRAL(unsigned int)
+	FT_HASH_INTEGRAL(long int)
+	FT_HASH_INTEGRAL(unsigned long int)
+	FT_HASH_INTEGRAL(long long int)
+	FT_HASH_INTEGRAL(unsigned long long int)
+
+	#undef FT_HASH_INTEGRAL
+
+	template < class T >
+	struct hash<T *> {
+		typedef T *		argument_type;
+		typedef size_t	result_type;
+
+		size_t operator() (T * p) const { return reinterpret_cast<size_t>(p); }
+	};
+
+	/**
+	 * @brief hash of n bytes (FNV-1a)
+	 * @note for strings and floating point values, whose bytes are the value.
+	 */
+	inline size_t	hashBytes(const void * data, size_t n) {
+		const unsigned char	*bytes = static_cast<const unsigned char *>(data);
+		size_t				h = static_cast<size_t>(2166136261UL);
+
+		for (size_t i = 0; i < n; ++i) {
+			h ^= bytes[i];
+			h *= static_cast<size_t>(16777619UL);
+		}
+		return h;
+	}
+
+	/** @note 0.0 and -0.0 compare equal: they hash the same */
+	#define FT_HASH_FLOATING(T) \
+	template <> \
+	struct hash<T> { \
+		typedef T		argument_type; \
+		typedef size_t	result_type; \
+		size_t operator() (T x) const { return x == 0 ? 0 : hashBytes(&x, sizeof(x)); } \
+	};
+
+	FT_HASH_FLOATING(float)
+	FT_HASH_FLOATING(double)
+
+	#undef FT_HASH_FLOATING
+
+	template <>
+	struct hash<std::string> {
+		typedef std::string	argument_type;
+		typedef size_t		result_type;
+
+		size_t operator() (std::string const & s) const { return hashBytes(s.data(), s.size()); }
+	};
+
+/**
+ * @class template: hashMix
+ */
+
+	/**
+	 * @brief finalizer of the hash containers: spreads every bit of a hash over the whole word
+	 * @note the tables take the 7 low bits for the control bytes and the bits above them (hash >> 7)
+	 * for the position: an identity hash of integers would leave them all alike. murmur3 fmix, for the size of size_t.
+	 */
+	template < size_t Bytes >
+	struct hashMix {
+		static size_t	mix(size_t h) {
+			h ^= h >> 16;
+			h *= static_cast<size_t>(0x85ebca6bUL);
+			h ^= h >> 13;
+			h *= static_cast<size_t>(0xc2b2ae35UL);
+			h ^= h >> 16;
+			return h;
+		}
+	};
+
+	/** @note 64 bits words (LP64): the constants are built from two halves, there is no long long literal in C++98 */
+	#if ULONG_MAX > 0xffffffffUL
+	template <>
+	struct hashMix<8> {
+		static size_t	mix(size_t h) {
+			h ^= h >> 33;
+			h *= (static_cast<size_t>(0xff51afd7UL) << 32) | static_cast<size_t>(0xed558ccdUL);
+			h ^= h >> 33;
+			h *= (static_cast<size_t>(0xc4ceb9feUL) << 32) | static_cast<size_t>(0x1a85ec53UL);
+			h ^= h >> 33;
+			return h;
+		}
+	};
+	#endif
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hashIte.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/19 10:41:05 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/19 10:41:05 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASHITE_HPP
+# define HASHITE_HPP
+
+#include "iterator.hpp"
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: hashIterator
+ */
+
+	/**
+	 * @class template: hashIterator
+	 * @brief forward iterator
+	 * @note a control byte and the slot it describes (see hashTable): incrementing skips the slots
+	 * whose control byte is negative (empty or deleted) and stops on a full one or on the sentinel,
+	 * the control byte past the last slot, which is end().
+	 */
+	template < class T >
+	class hashIterator : public ft::iterator<forward_iterator_tag, T> {
+		public:
+		/* member types */
+
+			typedef typename	ft::iterator<forward_iterator_tag, T>::value_type			value_type;
+			typedef typename	ft::iterator<forward_iterator_tag, T>::difference_type		difference_type;
+			typedef typename	ft::iterator<forward_iterator_tag, T>::pointer				pointer;
+			typedef typename	ft::iterator<forward_iterator_tag, T>::reference			reference;
+			typedef typename	ft::iterator<forward_iterator_tag, T>::iterator_category	iterator_category;
+
+			typedef				signed char													ctrl_type;
+
+		public:
+		/* member functions */
+
+		/* constructor / destructor / operator= */
+
+			hashIterator(void) : _ctrl(ft_nullptr), _slot(ft_nullptr) {}
+
+			/** @note the position given is skipped forward to the first full slot, or to the sentinel */
+			hashIterator(const ctrl_type * ctrl, pointer slot) : _ctrl(ctrl), _slot(slot) { skipFree(); }
+
+			hashIterator(hashIterator const & src) : _ctrl(src._ctrl), _slot(src._slot) {}
+
+			~hashIterator(void) {}
+
+			hashIterator & operator= (hashIterator const & rhs) {
+				if (this == &rhs) return *this;
+
+				_ctrl = rhs._ctrl;
+				_slot = rhs._slot;
+				return *this;
+			}
+
+		/* getters */
+
+			const ctrl_type *	getCtrl(void) const { return _ctrl; }
+
+			pointer				getSlot(void) const { return _slot; }
+
+		/* operator */
+
+			reference	operator* (void) const { return *_slot; }
+
+			pointer		operator->(void) const { return _slot; }
+
+			hashIterator &	operator++ (void) {
+				++_ctrl;
+				++_slot;
+				skipFree();
+				return *this;
+			}
+
+			hashIterator	operator++ (int) {
+				hashIterator tmp(*this);
+				operator++();
+				return tmp;
+			}
+
+			operator hashIterator<const T> (void) const {
+				return hashIterator<const T>(_ctrl, _slot);
+			}
+
+		private:
+		/* member functions (private) */
+
+			/** @note the sentinel is -1, empty and deleted are below it */
+			void	skipFree(void) {
+				if (_ctrl == ft_nullptr)
+					return ;
+				while (*_ctrl < -1) {
+					++_ctrl;
+					++_slot;
+				}
+			}
+
+		/** attributes */
+
+			const ctrl_type	*_ctrl;
+			pointer			_slot;
+	};
+
+	template < class _TL, class _TR >
+	bool operator== (const hashIterator<_TL> & lhs, const hashIterator<_TR> & rhs) {
+		return lhs.getCtrl() == rhs.getCtrl();
+	}
+
+	template < class _TL, class _TR >
+	bool operator!= (const hashIterator<_TL> & lhs, const hashIterator<_TR> & rhs) {
+		return lhs.getCtrl() != rhs.getCtrl();
+	}
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
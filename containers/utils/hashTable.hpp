@@ -0,0 +1,684 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hashTable.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/19 11:15:36 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/19 11:15:36 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASHTABLE_HPP
+# define HASHTABLE_HPP
+
+#include <memory>
+#include <cstring>
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+#include "hash.hpp"
+#include "hashIte.hpp"
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+#define HASH_GROUP_WIDTH 16
+#define HASH_MAX_LOAD_FACTOR 0.875f
+
+/**
+ * @class template: hashCtrl / hashGroup
+ */
+
+	/**
+	 * @brief control bytes of a hashTable, one per slot
+	 * @note a full slot has the 7 low bits of the hash of its key (0 to 127),
+	 * a free one is empty or deleted (a tombstone: probes go on past it), both negative.
+	 * the sentinel ends the slots, iterators stop on it.
+	 */
+	struct hashCtrl {
+		enum {
+			EMPTY = -128,
+			DELETED = -2,
+			SENTINEL = -1
+		};
+	};
+
+	/**
+	 * @brief HASH_GROUP_WIDTH control bytes read at once, matched as a bitmask (bit i for the byte i)
+	 * @note one SSE2 compare checks 16 slots. without SSE2 (__SSE2__ undefined) the bytes are compared one by one.
+	 */
+	struct hashGroup {
+		/* member types */
+
+			typedef signed char		ctrl_type;
+			typedef unsigned int	mask_type;
+
+		/* member functions */
+
+		#if defined(__SSE2__)
+
+			explicit hashGroup(const ctrl_type * pos) : _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+			/** @brief the bytes equal to h */
+			mask_type	match(ctrl_type h) const {
+				return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h), _ctrl)));
+			}
+
+			/** @brief the free bytes: empty or deleted, below the sentinel */
+			mask_type	matchFree() const {
+				return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(hashCtrl::SENTINEL), _ctrl)));
+			}
+
+		#else
+
+			explicit hashGroup(const ctrl_type * pos) : _ctrl(pos) {}
+
+			mask_type	match(ctrl_type h) const {
+				mask_type mask = 0;
+
+				for (int i = 0; i < HASH_GROUP_WIDTH; ++i)
+					mask |= static_cast<mask_type>(_ctrl[i] == h) << i;
+				return mask;
+			}
+
+			mask_type	matchFree() const {
+				mask_type mask = 0;
+
+				for (int i = 0; i < HASH_GROUP_WIDTH; ++i)
+					mask |= static_cast<mask_type>(_ctrl[i] < hashCtrl::SENTINEL) << i;
+				return mask;
+			}
+
+		#endif
+
+			mask_type	matchEmpty() const { return match(static_cast<ctrl_type>(hashCtrl::EMPTY)); }
+
+			/** @brief position of the lowest bit set (mask is not 0) */
+			static unsigned int	lowestBit(mask_type mask) {
+			#if defined(__GNUC__)
+				return static_cast<unsigned int>(__builtin_ctz(mask));
+			#else
+				unsigned int bit = 0;
+
+				for (; (mask & 1) == 0; mask >>= 1)
+					++bit;
+				return bit;
+			#endif
+			}
+
+			/** @brief number of bits clear above the highest one set, in HASH_GROUP_WIDTH bits (mask is not 0) */
+			static unsigned int	leadingZeros(mask_type mask) {
+				unsigned int zeros = 0;
+
+				for (mask_type bit = 1U << (HASH_GROUP_WIDTH - 1); (mask & bit) == 0; bit >>= 1)
+					++zeros;
+				return zeros;
+			}
+
+		private:
+		/* attributes */
+
+		#if defined(__SSE2__)
+			__m128i				_ctrl;
+		#else
+			const ctrl_type		*_ctrl;
+		#endif
+	};
+
+	/**
+	 * @brief control bytes of a table without slots: a sentinel then empty bytes
+	 * @note an empty table points to it instead of allocating, lookups find nothing without a test on the capacity.
+	 */
+	template < class Dummy = void >
+	struct hashEmptyGroup {
+		static const signed char	ctrl[HASH_GROUP_WIDTH];
+	};
+
+	template < class Dummy >
+	const signed char	hashEmptyGroup<Dummy>::ctrl[HASH_GROUP_WIDTH] = {
+		hashCtrl::SENTINEL, hashCtrl::EMPTY, hashCtrl::EMPTY, hashCtrl::EMPTY,
+		hashCtrl::EMPTY, hashCtrl::EMPTY, hashCtrl::EMPTY, hashCtrl::EMPTY,
+		hashCtrl::EMPTY, hashCtrl::EMPTY, hashCtrl::EMPTY, hashCtrl::EMPTY,
+		hashCtrl::EMPTY, hashCtrl::EMPTY, hashCtrl::EMPTY, hashCtrl::EMPTY
+	};
+
+/**
+ * @class template: hashTable
+ */
+
+	/**
+	 * @brief open addressing hash table (swiss table)
+	 * @note the values live in one array of slots, with one control byte per slot in another array.
+	 * the capacity is 2^k - 1: the hash (mixed, see hashMix) gives a first group of slots, probed
+	 * HASH_GROUP_WIDTH at a time (see hashGroup) against 7 bits of the hash, then the next groups
+	 * (triangular probing), until a group with an empty slot. a lookup compares keys only on control byte matches,
+	 * it mostly reads one group of control bytes and one slot.
+	 * the HASH_GROUP_WIDTH - 1 first control bytes are cloned past the sentinel, so a group read never wraps.
+	 * erasing empties the slot unless some group was seen full around it: the tombstone then stays until a rehash.
+	 * the table grows (doubling) past max_load_factor() of its capacity, HASH_MAX_LOAD_FACTOR at most;
+	 * values are copied to the new slots: an insertion may invalidate every iterator, an erasure only the erased one.
+	 *
+	 * @param Key: type of the keys.
+	 * @param T: type of the values stored in the slots.
+	 * @param KeyOfValue: function object returning a (const reference to the) key of a value.
+	 * @param Hash: hash function object on keys.
+	 * @param KeyEqual: equality on keys, consistent with Hash.
+	 * @param Alloc: allocator of T, rebound to the control bytes.
+	 */
+	template < class Key,
+		class T,
+		class KeyOfValue,
+		class Hash,
+		class KeyEqual,
+		class Alloc = std::allocator<T> >
+	class hashTable {
+		public:
+		/* member types */
+
+			typedef				Key																key_type;
+			typedef				T																value_type;
+			typedef				Hash															hasher;
+			typedef				KeyEqual														key_equal;
+			typedef				Alloc															allocator_type;
+			typedef				signed char														ctrl_type;
+
+			typedef				ft::hashIterator<value_type>									iterator;
+			typedef				ft::hashIterator<const value_type>								const_iterator;
+
+			/** @note usually the same as ptrdiff_t */
+			typedef	typename	allocator_type::difference_type									difference_type;
+			/** @note usually the same as size_t */
+			typedef	typename	allocator_type::size_type										size_type;
+
+		private:
+		/* member types (private) */
+
+			typedef typename	allocator_type::template rebind<ctrl_type>::other				ctrl_allocator;
+			typedef				hashGroup::mask_type											mask_type;
+
+		public:
+		/* member function: constructor / destructor  */
+
+			/** @note n: number of slots to start with (see rehash), none by default */
+			explicit hashTable(size_type n = 0, hasher const & hf = hasher(), key_equal const & eq = key_equal(),
+				allocator_type const & alloc = allocator_type()) :
+				_ctrl(emptyGroup()),
+				_slots(ft_nullptr),
+				_capacity(0),
+				_size(0),
+				_growthLeft(0),
+				_maxLoad(HASH_MAX_LOAD_FACTOR),
+				_hash(hf),
+				_eq(eq),
+				_alloc(alloc) {
+				if (n != 0)
+					rehash(n);
+			}
+
+			/** @brief copy: same capacity, same slots: the control bytes are copied as they are, O(capacity) */
+			hashTable(hashTable const & src) :
+				_ctrl(emptyGroup()),
+				_slots(ft_nullptr),
+				_capacity(0),
+				_size(0),
+				_growthLeft(0),
+				_maxLoad(src._maxLoad),
+				_hash(src._hash),
+				_eq(src._eq),
+				_alloc(src._alloc) {
+				cloneTable(src);
+			}
+
+			~hashTable() { destroyTable(); }
+
+			/** @note copy and swap: if a copy throws, the table is left as it was */
+			hashTable &	operator=(hashTable const & rhs) {
+				if (this == &rhs) return *this;
+
+				hashTable tmp(rhs);
+
+				swap(tmp);
+				return *this;
+			}
+
+		/* member function: getters  */
+
+			hasher			hash_function() const { return _hash; }
+
+			key_equal		key_eq() const { return _eq; }
+
+			allocator_type	get_allocator() const { return _alloc; }
+
+		/* member function: capacity  */
+
+			bool		empty() const { return _size == 0; }
+
+			size_type	size() const { return _size; }
+
+			size_type	max_size() const { return _alloc.max_size(); }
+
+			/** @note the number of slots */
+			size_type	bucket_count() const { return _capacity; }
+
+			float		load_factor() const { return _capacity == 0 ? 0.0f : static_cast<float>(_size) / _capacity; }
+
+			float		max_load_factor() const { return _maxLoad; }
+
+			/**
+			 * @brief set the greatest load before growing, and rehash to it
+			 * @note clamped to [0.125, HASH_MAX_LOAD_FACTOR]: past 7 / 8 the probes get long, and a group has to stay empty.
+			 */
+			void		max_load_factor(float ml) {
+				if (ml > HASH_MAX_LOAD_FACTOR)
+					ml = HASH_MAX_LOAD_FACTOR;
+				if (ml < 0.125f)
+					ml = 0.125f;
+				_maxLoad = ml;
+				if (_capacity != 0)
+					resize(capacityFor(_size, _capacity));
+			}
+
+			/**
+			 * @brief set the number of slots to n at least, and enough for size() (rounded to 2^k - 1)
+			 * @note rehash(0) shrinks the table to fit and drops the tombstones (an empty table gives its storage back).
+			 */
+			void		rehash(size_type n) {
+				if (n == 0) {
+					if (_size == 0)
+						destroyTable();
+					else
+						resize(capacityFor(_size));
+					return ;
+				}
+
+				size_type capacity = normalize(n);
+
+				if (capacity < capacityFor(_size))
+					capacity = capacityFor(_size);
+				if (capacity != _capacity)
+					resize(capacity);
+			}
+
+			/** @brief make room for n values without growing again */
+			void		reserve(size_type n) {
+				if (n > _size + _growthLeft)
+					resize(capacityFor(n, _capacity));
+			}
+
+		/* member function: iterators  */
+
+			iterator		begin() { return iterator(_ctrl, _slots); }
+
+			const_iterator	begin() const { return const_iterator(_ctrl, _slots); }
+
+			iterator		end() { return iterator(_ctrl + _capacity, _slots + _capacity); }
+
+			const_iterator	end() const { return const_iterator(_ctrl + _capacity, _slots + _capacity); }
+
+		/* member function: lookup  */
+
+			size_t		hashOf(key_type const & key) const { return ft::hashMix<sizeof(size_t)>::mix(_hash(key)); }
+
+			/** @return the slot of key, bucket_count() if there is none */
+			size_type	lookup(key_type const & key, size_t hash) const {
+				ctrl_type	h = h2(hash);
+				size_type	offset = h1(hash) & _capacity;
+				size_type	step = 0;
+
+				while (true) {
+					hashGroup group(_ctrl + offset);
+
+					for (mask_type mask = group.match(h); mask != 0; mask &= mask - 1) {
+						size_type i = (offset + hashGroup::lowestBit(mask)) & _capacity;
+
+						if (_eq(keyOf(_slots[i]), key))
+							return i;
+					}
+					if (group.matchEmpty() != 0)
+						return _capacity;
+					step += HASH_GROUP_WIDTH;
+					offset = (offset + step) & _capacity;
+				}
+			}
+
+			iterator		find(key_type const & key) { return position(lookup(key, hashOf(key))); }
+
+			const_iterator	find(key_type const & key) const { return position(lookup(key, hashOf(key))); }
+
+			iterator		position(size_type i) { return iterator(_ctrl + i, _slots + i); }
+
+			const_iterator	position(size_type i) const { return const_iterator(_ctrl + i, _slots + i); }
+
+		/* member function: modifiers  */
+
+			/**
+			 * @brief insert a value if no equivalent key is in the table
+			 * @return a pair with the position of the value (new or existing) and whether it was inserted.
+			 */
+			ft::pair<iterator, bool>	insert(value_type const & val) {
+				key_type const &	key = keyOf(val);
+				size_t				hash = hashOf(key);
+				size_type			i = lookup(key, hash);
+
+				if (i != _capacity)
+					return ft::make_pair(position(i), false);
+				return ft::make_pair(insertAt(prepareInsert(hash), hash, val), true);
+			}
+
+			/**
+			 * @brief the slot a new key of this hash goes to, growing the table first if needed
+			 * @note the key must not be in the table (see lookup). the slot must be filled by insertAt right away.
+			 */
+			size_type	prepareInsert(size_t hash) {
+				size_type i = findFree(_ctrl, _capacity, hash);
+
+				// a tombstone is reused as is, an empty slot takes some growth
+				if (_growthLeft == 0 && _ctrl[i] != hashCtrl::DELETED) {
+					grow();
+					i = findFree(_ctrl, _capacity, hash);
+				}
+				return i;
+			}
+
+			/** @note if the copy throws, the slot stays free */
+			iterator	insertAt(size_type i, size_t hash, value_type const & val) {
+				_alloc.construct(_slots + i, val);
+				if (_ctrl[i] == hashCtrl::EMPTY)
+					--_growthLeft;
+				setCtrl(_ctrl, _capacity, i, h2(hash));
+				++_size;
+				return position(i);
+			}
+
+			/** @return the position of the value which followed the erased one */
+			iterator	erase(const_iterator it) {
+				size_type i = it.getCtrl() - _ctrl;
+
+				eraseAt(i);
+				return iterator(_ctrl + i + 1, _slots + i + 1);
+			}
+
+			/** @return 1 if the value of key was erased, 0 if there was none */
+			size_type	erase(key_type const & key) {
+				size_type i = lookup(key, hashOf(key));
+
+				if (i == _capacity)
+					return 0;
+				eraseAt(i);
+				return 1;
+			}
+
+			iterator	erase(const_iterator first, const_iterator last) {
+				size_type	i = first.getCtrl() - _ctrl;
+				size_type	end = last.getCtrl() - _ctrl;
+
+				for (; i < end; ++i) {
+					if (_ctrl[i] >= 0)
+						eraseAt(i);
+				}
+				return position(end);
+			}
+
+			/** @note the slots are kept, like vector::clear */
+			void	clear() {
+				if (_capacity == 0)
+					return ;
+				destroySlots();
+				resetCtrl(_ctrl, _capacity);
+				_size = 0;
+				_growthLeft = growth(_capacity);
+			}
+
+			void	swap(hashTable & toSwap) {
+				swapValue(_ctrl, toSwap._ctrl);
+				swapValue(_slots, toSwap._slots);
+				swapValue(_capacity, toSwap._capacity);
+				swapValue(_size, toSwap._size);
+				swapValue(_growthLeft, toSwap._growthLeft);
+				swapValue(_maxLoad, toSwap._maxLoad);
+				swapValue(_hash, toSwap._hash);
+				swapValue(_eq, toSwap._eq);
+				swapValue(_alloc, toSwap._alloc);
+			}
+
+			static key_type const &	keyOf(value_type const & val) { return KeyOfValue()(val); }
+
+		private:
+		/* member function (private): control bytes  */
+
+			static ctrl_type *	emptyGroup() { return const_cast<ctrl_type *>(hashEmptyGroup<>::ctrl); }
+
+			/** @note the position of the first group */
+			static size_t		h1(size_t hash) { return hash >> 7; }
+
+			/** @note the control byte of a full slot */
+			static ctrl_type	h2(size_t hash) { return static_cast<ctrl_type>(hash & 0x7F); }
+
+			/** @note HASH_GROUP_WIDTH - 1 control bytes are cloned past the sentinel, they are set along with the first ones */
+			static void	setCtrl(ctrl_type * ctrl, size_type capacity, size_type i, ctrl_type h) {
+				ctrl[i] = h;
+				ctrl[((i - (HASH_GROUP_WIDTH - 1)) & capacity) + ((HASH_GROUP_WIDTH - 1) & capacity)] = h;
+			}
+
+			static void	resetCtrl(ctrl_type * ctrl, size_type capacity) {
+				std::memset(ctrl, hashCtrl::EMPTY, capacity + HASH_GROUP_WIDTH);
+				ctrl[capacity] = hashCtrl::SENTINEL;
+			}
+
+			/**
+			 * @brief first free slot on the probe sequence of hash
+			 * @note a table smaller than a group is read from its sentinel: the clones then cover every slot,
+			 * and no empty byte past them can be taken for a slot. the sentinel comes back only when it is full.
+			 */
+			static size_type	findFree(const ctrl_type * ctrl, size_type capacity, size_t hash) {
+				size_type	offset = capacity < HASH_GROUP_WIDTH - 1 ? capacity : h1(hash) & capacity;
+				size_type	step = 0;
+
+				while (true) {
+					mask_type mask = hashGroup(ctrl + offset).matchFree();
+
+					if (mask != 0)
+						return (offset + hashGroup::lowestBit(mask)) & capacity;
+					step += HASH_GROUP_WIDTH;
+					offset = (offset + step) & capacity;
+				}
+			}
+
+			/**
+			 * @brief destroy the value of a slot and free it
+			 * @note no probe can have gone past the slot if the empty bytes around it are less than a group apart
+			 * (or if the whole table fits in a group): it is emptied. otherwise it becomes a tombstone,
+			 * which does not give its growth back.
+			 */
+			void	eraseAt(size_type i) {
+				_alloc.destroy(_slots + i);
+				--_size;
+
+				mask_type	after = hashGroup(_ctrl + i).matchEmpty();
+				mask_type	before = hashGroup(_ctrl + ((i - HASH_GROUP_WIDTH) & _capacity)).matchEmpty();
+				bool		neverFull = _capacity < HASH_GROUP_WIDTH - 1 || (after != 0 && before != 0
+					&& hashGroup::lowestBit(after) + hashGroup::leadingZeros(before) < HASH_GROUP_WIDTH);
+
+				setCtrl(_ctrl, _capacity, i, neverFull ? hashCtrl::EMPTY : hashCtrl::DELETED);
+				if (neverFull)
+					++_growthLeft;
+			}
+
+		/* member function (private): capacity  */
+
+			/** @brief number of values a capacity holds before growing */
+			size_type	growth(size_type capacity) const {
+				size_type g = static_cast<size_type>(static_cast<double>(capacity) * _maxLoad);
+
+				if (g == 0)
+					g = 1;
+				// up to 7 slots, a group read always reaches empty bytes past the clones: the table may be full
+				if (capacity >= HASH_GROUP_WIDTH / 2 && g >= capacity)
+					g = capacity - 1;
+				return g;
+			}
+
+			/** @brief smallest 2^k - 1 not below n */
+			static size_type	normalize(size_type n) {
+				size_type capacity = 1;
+
+				while (capacity < n)
+					capacity = capacity * 2 + 1;
+				return capacity;
+			}
+
+			/** @brief smallest capacity holding n values, from the capacity given on (2^k - 1) */
+			size_type	capacityFor(size_type n, size_type capacity = 1) const {
+
+				while (capacity == 0 || growth(capacity) < n)
+					capacity = capacity * 2 + 1;
+				return capacity;
+			}
+
+			/** @note a table mostly full of tombstones is rehashed in place, otherwise it doubles (at least) */
+			void	grow() {
+				if (_capacity > HASH_GROUP_WIDTH && _size * 32 <= growth(_capacity) * 25)
+					resize(_capacity);
+				else
+					resize(capacityFor(_size + 1, _capacity * 2 + 1));
+			}
+
+			/**
+			 * @brief move the values to new arrays of capacity slots
+			 * @note the values are copied first, the old ones destroyed once all are in: if a copy or a hash throws,
+			 * the table is left as it was.
+			 */
+			void	resize(size_type capacity) {
+				ctrl_type	*ctrl = ctrl_allocator(_alloc).allocate(capacity + HASH_GROUP_WIDTH);
+				value_type	*slots;
+
+				try {
+					slots = _alloc.allocate(capacity);
+				}
+				catch (...) {
+					ctrl_allocator(_alloc).deallocate(ctrl, capacity + HASH_GROUP_WIDTH);
+					throw;
+				}
+				resetCtrl(ctrl, capacity);
+
+				try {
+					for (size_type i = 0; i < _capacity; ++i) {
+						if (_ctrl[i] < 0)
+							continue;
+
+						size_t		hash = hashOf(keyOf(_slots[i]));
+						size_type	j = findFree(ctrl, capacity, hash);
+
+						_alloc.construct(slots + j, _slots[i]);
+						setCtrl(ctrl, capacity, j, h2(hash));
+					}
+				}
+				catch (...) {
+					for (size_type j = 0; j < capacity; ++j) {
+						if (ctrl[j] >= 0)
+							_alloc.destroy(slots + j);
+					}
+					_alloc.deallocate(slots, capacity);
+					ctrl_allocator(_alloc).deallocate(ctrl, capacity + HASH_GROUP_WIDTH);
+					throw;
+				}
+
+				size_type size = _size;
+
+				destroyTable();
+				_ctrl = ctrl;
+				_slots = slots;
+				_capacity = capacity;
+				_size = size;
+				_growthLeft = growth(capacity) - size;
+			}
+
+			void	destroySlots() {
+				for (size_type i = 0; i < _capacity; ++i) {
+					if (_ctrl[i] >= 0)
+						_alloc.destroy(_slots + i);
+				}
+			}
+
+			/** @brief destroy the values and give the arrays back: the table is empty, without slots */
+			void	destroyTable() {
+				if (_capacity != 0) {
+					destroySlots();
+					_alloc.deallocate(_slots, _capacity);
+					ctrl_allocator(_alloc).deallocate(_ctrl, _capacity + HASH_GROUP_WIDTH);
+				}
+				_ctrl = emptyGroup();
+				_slots = ft_nullptr;
+				_capacity = 0;
+				_size = 0;
+				_growthLeft = 0;
+			}
+
+			/** @note the copy has the capacity and the layout of src, the table must be empty without slots */
+			void	cloneTable(hashTable const & src) {
+				if (src._capacity == 0)
+					return ;
+
+				ctrl_type	*ctrl = ctrl_allocator(_alloc).allocate(src._capacity + HASH_GROUP_WIDTH);
+				value_type	*slots;
+
+				try {
+					slots = _alloc.allocate(src._capacity);
+				}
+				catch (...) {
+					ctrl_allocator(_alloc).deallocate(ctrl, src._capacity + HASH_GROUP_WIDTH);
+					throw;
+				}
+				std::memcpy(ctrl, src._ctrl, src._capacity + HASH_GROUP_WIDTH);
+
+				size_type i = 0;
+
+				try {
+					for (; i < src._capacity; ++i) {
+						if (ctrl[i] >= 0)
+							_alloc.construct(slots + i, src._slots[i]);
+					}
+				}
+				catch (...) {
+					while (i-- != 0) {
+						if (ctrl[i] >= 0)
+							_alloc.destroy(slots + i);
+					}
+					_alloc.deallocate(slots, src._capacity);
+					ctrl_allocator(_alloc).deallocate(ctrl, src._capacity + HASH_GROUP_WIDTH);
+					throw;
+				}
+				_ctrl = ctrl;
+				_slots = slots;
+				_capacity = src._capacity;
+				_size = src._size;
+				_growthLeft = src._growthLeft;
+			}
+
+			template < class U >
+			static void	swapValue(U & a, U & b) {
+				U tmp = a;
+
+				a = b;
+				b = tmp;
+			}
+
+		private:
+		/* attributes */
+
+			ctrl_type		*_ctrl;
+			value_type		*_slots;
+			size_type		_capacity;
+			size_type		_size;
+			size_type		_growthLeft;
+			float			_maxLoad;
+			hasher			_hash;
+			key_equal		_eq;
+			allocator_type	_alloc;
+	};
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
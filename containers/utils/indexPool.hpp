@@ -0,0 +1,301 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   indexPool.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 10:12:24 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 10:12:24 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INDEXPOOL_HPP
+# define INDEXPOOL_HPP
+
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+#define INDEX_POOL_FIRST_CAPACITY 8
+#define INDEX_POOL_MAX_CAPACITY (1U << 30)
+
+/**
+ * @class template: indexPool
+ */
+
+	/**
+	 * @brief index node pool
+	 * @note every node, the header included (slot 0), lives in a single array,
+	 * so nodes can link to each other with 32-bit indices relative to themselves (see RBT_IndexNode, RBT_IndexStorage).
+	 * released nodes go to a free list chained by index. when the array is full it is doubled
+	 * and the nodes are moved: pointers taken before allocate() / reserve() are translated with rebase().
+	 * release() keeps the array (like vector::clear), it goes back to the allocator with the pool.
+	 * the header cannot be embedded (links are relative): a tree in an indexPool owns an array even when empty.
+	 *
+	 * @param Node: type of the nodes, providing copyLinks() to be moved with its links.
+	 * @param Alloc: allocator of Node, used for the array.
+	 */
+	template < class Node, class Alloc = std::allocator<Node> >
+	class indexPool {
+		public:
+		/* member types */
+
+			typedef				Node									node_type;
+			typedef				Alloc									allocator_type;
+			typedef	typename	allocator_type::pointer					pointer;
+			typedef	typename	allocator_type::size_type				size_type;
+			typedef				unsigned int							index_type;
+
+			/** @note nodes cannot leave the array (relative links): there is no store to share, see nodePool::store */
+			typedef				void									store;
+
+		private:
+		/* member types (private) */
+
+			typedef typename	allocator_type::template rebind<char>::other	char_allocator;
+
+		public:
+		/* member function: constructor / destructor  */
+
+			explicit indexPool(allocator_type const & alloc = allocator_type()) :
+				_alloc(alloc),
+				_nodes(ft_nullptr),
+				_moved(ft_nullptr),
+				_capacity(0),
+				_cursor(0),
+				_free(NO_INDEX),
+				_available(0) {}
+
+			/** @note every node but the header must be destroyed, the header (links only) is just dropped */
+			~indexPool(void) {
+				if (_nodes != ft_nullptr)
+					_alloc.deallocate(_nodes, _capacity);
+			}
+
+		/* member function: capacity  */
+
+			allocator_type	get_allocator(void) const { return _alloc; }
+
+			/** @brief number of nodes which can be handed out without moving the array */
+			size_type	available(void) const { return _available; }
+
+			/** @note the relative indices of the nodes reach INDEX_POOL_MAX_CAPACITY slots at most */
+			size_type	max_size(void) const {
+				size_type allocMax = _alloc.max_size();
+
+				return allocMax < INDEX_POOL_MAX_CAPACITY - 1 ? allocMax : INDEX_POOL_MAX_CAPACITY - 1;
+			}
+
+			/**
+			 * @brief make sure n nodes can be handed out without moving the array again
+			 * @exception std::length_error if the array would outgrow INDEX_POOL_MAX_CAPACITY.
+			 */
+			void	reserve(size_type n) {
+				_moved = _nodes;
+				if (n > _available)
+					grow(_capacity + n - _available);
+			}
+
+		/* member function: modifiers  */
+
+			/**
+			 * @brief the header of the tree: the slot 0 of the array, which is created by the first call
+			 * @note the header is built by the default constructor of the node: links only, no value.
+			 */
+			pointer	header(void) {
+				if (_nodes == ft_nullptr) {
+					grow(INDEX_POOL_FIRST_CAPACITY);
+					new (static_cast<void *>(_nodes)) node_type();
+				}
+				return _nodes;
+			}
+
+			/**
+			 * @brief get storage for one node (not constructed)
+			 * @exception std::length_error if the array would outgrow INDEX_POOL_MAX_CAPACITY.
+			 */
+			pointer	allocate(void) {
+				pointer node;
+
+				_moved = _nodes;
+				if (_free != NO_INDEX) {
+					node = _nodes + _free;
+					_free = nextFree(node);
+				}
+				else {
+					if (_cursor == _capacity)
+						grow(_capacity * 2);
+					node = _nodes + _cursor++;
+				}
+				--_available;
+				return node;
+			}
+
+			/** @brief give back the storage of a node (already destroyed) */
+			void	deallocate(pointer node) {
+				nextFree(node) = _free;
+				_free = static_cast<index_type>(node - _nodes);
+				++_available;
+			}
+
+			/** @brief forget every node but the header, they must all be destroyed. the array is kept */
+			void	release(void) {
+				if (_nodes == ft_nullptr)
+					return ;
+				_cursor = 1;
+				_free = NO_INDEX;
+				_available = _capacity - 1;
+			}
+
+			/**
+			 * @brief translate a pointer taken before the last allocate() / reserve() into the current array
+			 * @note ft_nullptr stays ft_nullptr.
+			 */
+			template < class P >
+			P	rebase(P node) const {
+				if (node == ft_nullptr || _moved == _nodes)
+					return node;
+				return _nodes + (node - _moved);
+			}
+
+			/** @note the allocators are swapped along with the arrays they own */
+			void	swap(indexPool & toSwap) {
+				swapValue(_alloc, toSwap._alloc);
+				swapValue(_nodes, toSwap._nodes);
+				swapValue(_moved, toSwap._moved);
+				swapValue(_capacity, toSwap._capacity);
+				swapValue(_cursor, toSwap._cursor);
+				swapValue(_free, toSwap._free);
+				swapValue(_available, toSwap._available);
+			}
+
+		/* member function: sharing  */
+
+			/**
+			 * @brief nodes cannot leave the array (relative links): nothing is shared, see nodePool::share
+			 * @return false: the values of src must be copied into this pool instead of relinked.
+			 */
+			bool	share(indexPool &) const { return false; }
+
+			/**
+			 * @note no store: the node handles need RBT_NodeStorage (see RBT_node_handles_need_RBT_NodeStorage),
+			 * these only keep the interface of nodePool so that the check is the only error.
+			 */
+			store *	storeOf(pointer) const { return ft_nullptr; }
+
+			void	borrow(store *) const {}
+
+			static void	unref(store *) {}
+
+		private:
+		/* member function (private) */
+
+			indexPool(indexPool const &);
+			indexPool & operator=(indexPool const &);
+
+			static const index_type NO_INDEX = static_cast<index_type>(-1);
+
+			/** @note a free slot is raw storage, its first bytes hold the index of the next free slot */
+			static index_type &	nextFree(pointer node) { return *reinterpret_cast<index_type *>(node); }
+
+			/**
+			 * @brief move the nodes to a new array of capacity slots
+			 * @note the constructed nodes are copied with their (relative) links, the free slots keep their chain.
+			 * the header has no value to copy: a new header takes its links.
+			 * the old nodes are destroyed once every copy succeeded: if a copy throws,
+			 * the copies made so far are destroyed and the pool is left as it was.
+			 */
+			void	grow(size_type capacity) {
+				if (capacity > INDEX_POOL_MAX_CAPACITY || capacity > _alloc.max_size())
+					throw std::length_error("indexPool");
+				if (capacity < INDEX_POOL_FIRST_CAPACITY)
+					capacity = INDEX_POOL_FIRST_CAPACITY;
+
+				pointer	nodes = _alloc.allocate(capacity);
+				char	*isFree = ft_nullptr;
+
+				if (_free != NO_INDEX) {
+					try {
+						isFree = char_allocator(_alloc).allocate(_cursor);
+					}
+					catch (...) {
+						_alloc.deallocate(nodes, capacity);
+						throw;
+					}
+					for (size_type i = 0; i < _cursor; ++i)
+						isFree[i] = 0;
+					for (index_type i = _free; i != NO_INDEX; i = nextFree(_nodes + i))
+						isFree[i] = 1;
+				}
+
+				if (_nodes != ft_nullptr) {
+					new (static_cast<void *>(nodes)) node_type();
+					nodes->copyLinks(*_nodes);
+				}
+
+				size_type i = 1;
+
+				try {
+					for (; i < _cursor; ++i) {
+						if (isFree != ft_nullptr && isFree[i] != 0)
+							nextFree(nodes + i) = nextFree(_nodes + i);
+						else {
+							_alloc.construct(nodes + i, _nodes[i]);
+							nodes[i].copyLinks(_nodes[i]);
+						}
+					}
+				}
+				catch (...) {
+					while (i-- > 1) {
+						if (isFree == ft_nullptr || isFree[i] == 0)
+							_alloc.destroy(nodes + i);
+					}
+					if (isFree != ft_nullptr)
+						char_allocator(_alloc).deallocate(isFree, _cursor);
+					_alloc.deallocate(nodes, capacity);
+					throw;
+				}
+
+				for (i = 1; i < _cursor; ++i) {
+					if (isFree == ft_nullptr || isFree[i] == 0)
+						_alloc.destroy(_nodes + i);
+				}
+				if (isFree != ft_nullptr)
+					char_allocator(_alloc).deallocate(isFree, _cursor);
+				if (_nodes != ft_nullptr)
+					_alloc.deallocate(_nodes, _capacity);
+				else
+					_cursor = 1; // the slot 0 is the header's
+
+				_available += capacity - _capacity - (_nodes == ft_nullptr ? 1 : 0);
+				_nodes = nodes;
+				_capacity = capacity;
+			}
+
+			template < class U >
+			static void	swapValue(U & a, U & b) {
+				U tmp = a;
+
+				a = b;
+				b = tmp;
+			}
+
+		private:
+		/* attributes */
+
+			allocator_type	_alloc;
+			pointer			_nodes;
+			pointer			_moved;
+			size_type		_capacity;
+			size_type		_cursor;
+			index_type		_free;
+			size_type		_available;
+	};
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
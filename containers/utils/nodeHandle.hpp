@@ -0,0 +1,225 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   nodeHandle.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 14:52:31 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 14:52:31 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODEHANDLE_HPP
+# define NODEHANDLE_HPP
+
+#include <memory>
+#include <new>
+#include "RBT.hpp"
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+/**
+ * @class template: nodeHandle
+ */
+
+	/**
+	 * @brief node handle
+	 * @note owns a node taken out of a map / set by extract(), until it is inserted in a container:
+	 * the same one or another one with an equal allocator relinks the node, the value is never copied nor reallocated
+	 * (a container with an allocator not comparing equal copies the value, and the node is destroyed).
+	 * the handle also holds a reference to the storage of the node, so the node outlives its first container.
+	 * without move semantics, a handle is transferred by copy: the copy takes the node, the source becomes empty.
+	 * a node still owned when the handle dies is destroyed, its storage goes back with its store.
+	 * the allocator is only held along with a node: an empty handle does not need a default constructible one
+	 * (ft::arena_allocator), and get_allocator() requires a handle which is not empty.
+	 * only available for the default node storage (ft::RBT_NodeStorage).
+	 *
+	 * @param Node: type of the nodes of the container (see ft::RBT_node_of).
+	 * @param Alloc: allocator of the container.
+	 */
+	template < class Node, class Alloc >
+	class nodeHandle {
+		public:
+		/* member types */
+
+			typedef				Alloc													allocator_type;
+
+			typedef				Node													node_type;
+			typedef typename	node_type::value_type									value_type;
+			typedef typename	node_type::base_type									node_base;
+			typedef typename	allocator_type::template rebind<node_type>::other		node_allocator;
+			typedef typename	ft::RBT_pool_of<node_type, node_allocator>::type		pool_type;
+			typedef typename	pool_type::store										store_type;
+
+		public:
+		/* member function: constructor / destructor / operator=  */
+
+			nodeHandle(void) : _node(ft_nullptr), _store(ft_nullptr) {}
+
+			/** @note used by the containers: node is unlinked (or ft_nullptr), store is a reference taken for it */
+			nodeHandle(node_base * node, store_type * store, allocator_type const & alloc) :
+				_node(static_cast<node_type *>(node)),
+				_store(store) {
+				if (_node != ft_nullptr)
+					new (_allocStorage.bytes) allocator_type(alloc);
+			}
+
+			/** @note takes the node of src, which becomes empty */
+			nodeHandle(nodeHandle const & src) :
+				_node(src._node),
+				_store(src._store) {
+				if (_node != ft_nullptr)
+					new (_allocStorage.bytes) allocator_type(src.alloc());
+				src.release();
+			}
+
+			~nodeHandle(void) { clear(); }
+
+			/** @note takes the node of rhs, which becomes empty */
+			nodeHandle & operator=(nodeHandle const & rhs) {
+				if (this == &rhs) return *this;
+
+				clear();
+				_node = rhs._node;
+				_store = rhs._store;
+				if (_node != ft_nullptr)
+					new (_allocStorage.bytes) allocator_type(rhs.alloc());
+				rhs.release();
+				return *this;
+			}
+
+		/* member function: observers  */
+
+			bool			empty(void) const { return _node == ft_nullptr; }
+
+			/** @note the handle must not be empty */
+			allocator_type	get_allocator(void) const { return alloc(); }
+
+			node_base *		getNode(void) const { return _node; }
+
+			store_type *	getStore(void) const { return _store; }
+
+		/* member function: modifiers  */
+
+			/** @note goes through a third handle: each allocator is copied along with its node */
+			void	swap(nodeHandle & toSwap) {
+				if (this == &toSwap) return ;
+
+				nodeHandle tmp(*this);
+
+				*this = toSwap;
+				toSwap = tmp;
+			}
+
+			/** @brief destroy the node, its storage goes back with its store (a container took a copy of the value) */
+			void	clear(void) const {
+				if (_node == ft_nullptr)
+					return ;
+				node_allocator(alloc()).destroy(_node);
+				pool_type::unref(_store);
+				release();
+			}
+
+			/** @brief forget the node and its storage, a container took them */
+			void	release(void) const {
+				if (_node != ft_nullptr)
+					alloc().~allocator_type();
+				_node = ft_nullptr;
+				_store = ft_nullptr;
+			}
+
+		protected:
+		/* member function (protected) */
+
+			value_type &	nodeValue(void) const { return _node->value(); }
+
+		private:
+		/* member function (private) */
+
+			/** @note constructed in _allocStorage while the handle holds a node */
+			allocator_type &	alloc(void) const { return *_allocStorage.get(); }
+
+		private:
+		/* attributes */
+
+			mutable node_type						*_node;
+			mutable store_type						*_store;
+			mutable ft::raw_storage<allocator_type>	_allocStorage;
+	};
+
+/**
+ * @class template: mapNodeHandle / setNodeHandle
+ */
+
+	/** @brief node handle of a map: key() and mapped() of the element */
+	template < class Key, class T, class Node, class Alloc >
+	class mapNodeHandle : public nodeHandle<Node, Alloc> {
+		public:
+		/* member types */
+
+			typedef				Key												key_type;
+			typedef				T												mapped_type;
+			typedef				nodeHandle<Node, Alloc>							base;
+
+		public:
+		/* member function: constructor / destructor / operator=  */
+
+			mapNodeHandle(void) : base() {}
+
+			mapNodeHandle(typename base::node_base * node, typename base::store_type * store, Alloc const & alloc) :
+				base(node, store, alloc) {}
+
+			mapNodeHandle(mapNodeHandle const & src) : base(src) {}
+
+			~mapNodeHandle(void) {}
+
+			mapNodeHandle & operator=(mapNodeHandle const & rhs) {
+				base::operator=(rhs);
+				return *this;
+			}
+
+		/* member function: observers  */
+
+			/** @note the key can be changed while the node is out of any container */
+			key_type &		key(void) const { return const_cast<key_type &>(this->nodeValue().first); }
+
+			mapped_type &	mapped(void) const { return this->nodeValue().second; }
+	};
+
+	/** @brief node handle of a set: value() of the element */
+	template < class T, class Node, class Alloc >
+	class setNodeHandle : public nodeHandle<Node, Alloc> {
+		public:
+		/* member types */
+
+			typedef				T							value_type;
+			typedef				nodeHandle<Node, Alloc>		base;
+
+		public:
+		/* member function: constructor / destructor / operator=  */
+
+			setNodeHandle(void) : base() {}
+
+			setNodeHandle(typename base::node_base * node, typename base::store_type * store, Alloc const & alloc) :
+				base(node, store, alloc) {}
+
+			setNodeHandle(setNodeHandle const & src) : base(src) {}
+
+			~setNodeHandle(void) {}
+
+			setNodeHandle & operator=(setNodeHandle const & rhs) {
+				base::operator=(rhs);
+				return *this;
+			}
+
+		/* member function: observers  */
+
+			/** @note the value can be changed while the node is out of any container */
+			value_type &	value(void) const { return this->nodeValue(); }
+	};
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
@@ -0,0 +1,378 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   nodePool.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/16 11:02:47 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 14:40:12 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODEPOOL_HPP
+# define NODEPOOL_HPP
+
+#include <memory>
+#include <functional>
+#include "utils.hpp"
+
+_BEGIN_NS_FT
+
+#define POOL_FIRST_SLAB 8
+#define POOL_MAX_SLAB 4096
+
+/**
+ * @class template: nodePool
+ */
+
+	/**
+	 * @brief node pool
+	 * @note hands out uninitialized storage for one node at a time, carved out of slabs
+	 * (arrays of nodes) obtained from the allocator. slabs grow geometrically up to POOL_MAX_SLAB nodes.
+	 * released nodes go to a free list and are handed out again before the current slab is used.
+	 * memory only goes back to the allocator, one whole slab at a time, on release().
+	 * the header of the tree is a bare base_type embedded in the pool: an empty pool owns no memory.
+	 *
+	 * the slabs are kept in a reference counted store, so nodes can leave the pool (node handles, merge):
+	 * whoever holds a node of another pool also holds a reference to its store (borrow / share),
+	 * and a store goes back to the allocator with its last reference.
+	 * a store keeps its slabs in an array sorted by address, so the slab of a node is found by bisection.
+	 * borrowing a store for the first time allocates one small reference (storeRef) in the borrowing pool.
+	 *
+	 * @param Node: type of the nodes.
+	 * @param Alloc: allocator of Node, used for the slabs.
+	 */
+	template < class Node, class Alloc = std::allocator<Node> >
+	class nodePool {
+		public:
+		/* member types */
+
+			typedef				Node									node_type;
+			typedef typename	node_type::base_type					base_type;
+			typedef				Alloc									allocator_type;
+			typedef	typename	allocator_type::pointer					pointer;
+			typedef	typename	allocator_type::size_type				size_type;
+
+			struct slab {
+				pointer		nodes;
+				size_type	capacity;
+			};
+
+			/** @brief slabs shared by the pools (and node handles) holding their nodes, sorted by address */
+			struct store {
+				allocator_type	alloc;
+				slab			*slabs;
+				size_type		count;
+				size_type		capacity;
+				size_type		refs;
+
+				store(allocator_type const & a) : alloc(a), slabs(ft_nullptr), count(0), capacity(0), refs(1) {}
+			};
+
+		private:
+		/* member types (private) */
+
+			struct storeRef {
+				store		*owner;
+				storeRef	*next;
+			};
+
+			typedef typename	allocator_type::template rebind<slab>::other		slab_allocator;
+			typedef typename	allocator_type::template rebind<store>::other		store_allocator;
+			typedef typename	allocator_type::template rebind<storeRef>::other	storeRef_allocator;
+
+		public:
+		/* member function: constructor / destructor  */
+
+			explicit nodePool(allocator_type const & alloc = allocator_type()) :
+				_alloc(alloc),
+				_header(),
+				_store(ft_nullptr),
+				_borrowed(ft_nullptr),
+				_free(ft_nullptr),
+				_cursor(ft_nullptr),
+				_cursorEnd(ft_nullptr),
+				_available(0),
+				_nextSlab(POOL_FIRST_SLAB) {}
+
+			~nodePool(void) { release(); }
+
+		/* member function: capacity  */
+
+			allocator_type	get_allocator(void) const { return _alloc; }
+
+			/** @brief number of nodes which can be handed out without asking the allocator */
+			size_type	available(void) const { return _available; }
+
+			size_type	max_size(void) const { return _alloc.max_size(); }
+
+			/**
+			 * @brief make sure n nodes can be handed out without asking the allocator again
+			 * @note the missing capacity is allocated as one slab.
+			 */
+			void	reserve(size_type n) {
+				if (n > _available)
+					addSlab(n - _available);
+			}
+
+		/* member function: modifiers  */
+
+			/** @brief the header of the tree, it never moves and is not exchanged by swap() */
+			base_type *	header(void) { return &_header; }
+
+			/** @brief get storage for one node (not constructed) */
+			pointer	allocate(void) {
+				pointer node;
+
+				if (_free != ft_nullptr) {
+					node = _free;
+					_free = nextFree(node);
+				}
+				else {
+					if (_cursor == _cursorEnd) {
+						addSlab(_nextSlab);
+						if (_nextSlab < POOL_MAX_SLAB)
+							_nextSlab *= 2;
+					}
+					node = _cursor++;
+				}
+				--_available;
+				return node;
+			}
+
+			/** @brief give back the storage of a node (already destroyed), it may come from a borrowed store */
+			void	deallocate(pointer node) {
+				nextFree(node) = _free;
+				_free = node;
+				++_available;
+			}
+
+			/**
+			 * @brief forget every node, they must all be destroyed
+			 * @note the borrowed stores are dropped, the own store goes back to the allocator
+			 * unless nodes of it live elsewhere: then it is left to them and a new one is started.
+			 */
+			void	release(void) {
+				while (_borrowed != ft_nullptr) {
+					storeRef *next = _borrowed->next;
+
+					unref(_borrowed->owner);
+					storeRef_allocator(_alloc).deallocate(_borrowed, 1);
+					_borrowed = next;
+				}
+				unref(_store);
+				_store = ft_nullptr;
+				_free = ft_nullptr;
+				_cursor = ft_nullptr;
+				_cursorEnd = ft_nullptr;
+				_available = 0;
+				_nextSlab = POOL_FIRST_SLAB;
+			}
+
+			/** @note nodes never move in a slab: pointers stay valid, see indexPool::rebase */
+			template < class P >
+			P	rebase(P node) const { return node; }
+
+			/** @note the allocators are swapped along with the slabs they own */
+			void	swap(nodePool & toSwap) {
+				swapValue(_alloc, toSwap._alloc);
+				swapValue(_store, toSwap._store);
+				swapValue(_borrowed, toSwap._borrowed);
+				swapValue(_free, toSwap._free);
+				swapValue(_cursor, toSwap._cursor);
+				swapValue(_cursorEnd, toSwap._cursorEnd);
+				swapValue(_available, toSwap._available);
+				swapValue(_nextSlab, toSwap._nextSlab);
+			}
+
+		/* member function: sharing  */
+
+			/**
+			 * @brief take a reference to the store a node of this pool was carved out of
+			 * @note O(log(slabs)) per store, the own store first then the borrowed ones.
+			 * the reference goes with the node (node handle) until borrow() or unref().
+			 */
+			store *	storeOf(base_type * link) {
+				pointer	node = static_cast<pointer>(link);
+				store	*owner = ft_nullptr;
+
+				if (holds(_store, node))
+					owner = _store;
+				for (storeRef *ref = _borrowed; owner == ft_nullptr && ref != ft_nullptr; ref = ref->next) {
+					if (holds(ref->owner, node))
+						owner = ref->owner;
+				}
+				if (owner != ft_nullptr)
+					++owner->refs;
+				return owner;
+			}
+
+			/**
+			 * @brief keep alive a store nodes of which now belong to this pool, the reference is taken over
+			 * @note a store not known yet costs one storeRef allocation, the only one of a merge / node insertion.
+			 */
+			void	borrow(store * owner) {
+				if (owner == ft_nullptr)
+					return ;
+				if (owner == _store) {
+					unref(owner);
+					return ;
+				}
+				for (storeRef *ref = _borrowed; ref != ft_nullptr; ref = ref->next) {
+					if (ref->owner == owner) {
+						unref(owner);
+						return ;
+					}
+				}
+
+				storeRef *toAdd = storeRef_allocator(_alloc).allocate(1);
+
+				toAdd->owner = owner;
+				toAdd->next = _borrowed;
+				_borrowed = toAdd;
+			}
+
+			/**
+			 * @brief keep alive every store of src: any of its nodes may now belong to this pool
+			 * @note only with an allocator comparing equal: the nodes of src must go back to an allocator of this pool.
+			 * @return whether the nodes of src can be relinked, their values must be copied otherwise (see indexPool::share).
+			 */
+			bool	share(nodePool & src) {
+				if ((_alloc == src._alloc) == false)
+					return false;
+				if (src._store != ft_nullptr) {
+					++src._store->refs;
+					borrow(src._store);
+				}
+				for (storeRef *ref = src._borrowed; ref != ft_nullptr; ref = ref->next) {
+					++ref->owner->refs;
+					borrow(ref->owner);
+				}
+				return true;
+			}
+
+			/** @brief drop a reference to a store, the last one gives its slabs back to the allocator */
+			static void	unref(store * owner) {
+				if (owner == ft_nullptr || --owner->refs != 0)
+					return ;
+
+				for (size_type i = 0; i < owner->count; ++i)
+					owner->alloc.deallocate(owner->slabs[i].nodes, owner->slabs[i].capacity);
+				if (owner->slabs != ft_nullptr)
+					slab_allocator(owner->alloc).deallocate(owner->slabs, owner->capacity);
+
+				store_allocator storeAlloc(owner->alloc);
+
+				storeAlloc.destroy(owner);
+				storeAlloc.deallocate(owner, 1);
+			}
+
+		private:
+		/* member function (private) */
+
+			nodePool(nodePool const &);
+			nodePool & operator=(nodePool const &);
+
+			/** @note a free node is raw storage, its first bytes hold the link to the next free node */
+			static pointer &	nextFree(pointer node) { return *reinterpret_cast<pointer *>(node); }
+
+			/** @note bisection on the slabs of owner: the last one starting at or before node must contain it */
+			static bool	holds(store * owner, pointer node) {
+				if (owner == ft_nullptr)
+					return false;
+
+				std::less<pointer>	before;
+				size_type			first = 0;
+				size_type			last = owner->count;
+
+				while (first < last) {
+					size_type middle = first + (last - first) / 2;
+
+					if (before(node, owner->slabs[middle].nodes))
+						last = middle;
+					else
+						first = middle + 1;
+				}
+				return first != 0 && before(node, owner->slabs[first - 1].nodes + owner->slabs[first - 1].capacity);
+			}
+
+			/** @brief insert a slab in the address order of the store, the array grows geometrically */
+			static void	addToStore(store * owner, pointer nodes, size_type n) {
+				if (owner->count == owner->capacity) {
+					slab_allocator	slabAlloc(owner->alloc);
+					size_type		capacity = owner->capacity == 0 ? 4 : owner->capacity * 2;
+					slab			*slabs = slabAlloc.allocate(capacity);
+
+					for (size_type i = 0; i < owner->count; ++i)
+						slabs[i] = owner->slabs[i];
+					if (owner->slabs != ft_nullptr)
+						slabAlloc.deallocate(owner->slabs, owner->capacity);
+					owner->slabs = slabs;
+					owner->capacity = capacity;
+				}
+
+				std::less<pointer>	before;
+				size_type			pos = owner->count;
+
+				for (; pos != 0 && before(nodes, owner->slabs[pos - 1].nodes); --pos)
+					owner->slabs[pos] = owner->slabs[pos - 1];
+				owner->slabs[pos].nodes = nodes;
+				owner->slabs[pos].capacity = n;
+				++owner->count;
+			}
+
+			void	addSlab(size_type n) {
+				// what is left of the current slab goes to the free list
+				for (; _cursor != _cursorEnd; ++_cursor) {
+					nextFree(_cursor) = _free;
+					_free = _cursor;
+				}
+
+				if (_store == ft_nullptr) {
+					store_allocator storeAlloc(_alloc);
+
+					_store = storeAlloc.allocate(1);
+					storeAlloc.construct(_store, store(_alloc));
+				}
+
+				pointer nodes = _alloc.allocate(n);
+
+				try {
+					addToStore(_store, nodes, n);
+				}
+				catch (...) {
+					_alloc.deallocate(nodes, n);
+					throw ;
+				}
+
+				_cursor = nodes;
+				_cursorEnd = nodes + n;
+				_available += n;
+			}
+
+			template < class U >
+			static void	swapValue(U & a, U & b) {
+				U tmp = a;
+
+				a = b;
+				b = tmp;
+			}
+
+		private:
+		/* attributes */
+
+			allocator_type	_alloc;
+			base_type		_header;
+			store			*_store;
+			storeRef		*_borrowed;
+			pointer			_free;
+			pointer			_cursor;
+			pointer			_cursorEnd;
+			size_type		_available;
+			size_type		_nextSlab;
+	};
+
+_END_NS_FT
+
+#endif
\ No newline at end of file
@@ -28,6 +28,7 @@ _BEGIN_NS_FT
 	/**
 	 * @class template: treeIterator
 	 * @brief bidirectional iterator
+	 * @note a single node pointer: end() is the header of the tree, which RBT_decrement recognizes by itself.
 	 */
 	template < class T, class Node >
 	class treeIterator : public ft::iterator<bidirectional_iterator_tag, T> {
@@ -41,136 +42,72 @@ _BEGIN_NS_FT
 			typedef typename 	ft::iterator<bidirectional_iterator_tag, value_type>::reference			reference;
 			typedef typename 	ft::iterator<bidirectional_iterator_tag, value_type>::iterator_category	iterator_category;
 
-			typedef Node	node_type;
-			typedef Node*	node_pointer;
+			typedef				Node								node_type;
+			/** @note the iterator holds a link: end() is the header, which is only a node base */
+			typedef typename	Node::base_type*					node_pointer;
 		
 		public:
 		/* member functions */
 
 		/* constructor / destructor / operator= */
 			
-			treeIterator(void) :
-				_root(ft_nullptr),
-				_node(ft_nullptr),
-				_null(ft_nullptr) {}
+			treeIterator(void) : _node(ft_nullptr) {}
 
-			treeIterator(node_pointer root, node_pointer node, node_pointer null) :
-				_root(root),
-				_node(node),
-				_null(null) {}
+			explicit treeIterator(node_pointer node) : _node(node) {}
 
-			treeIterator(treeIterator const & src) :
-				_root(src._root),
-				_node(src._node),
-				_null(src._null) {}
+			treeIterator(treeIterator const & src) : _node(src._node) {}
 
 			~treeIterator(void) {}
 
 			treeIterator & operator= (treeIterator const & rhs) {
 				if (this == &rhs) return *this;
 
-				_root = rhs._root;
 				_node = rhs._node;
-				_null = rhs._null;
 				return *this;
 			}
 		
 		/* getters */
 
-			node_pointer getRoot(void) const { return _root; };
 			node_pointer getNode(void) const { return _node; };
-			node_pointer getNull(void) const { return _null; };
 
 		/* operator */
 			
-			reference	operator* (void) const { return _node->val; }
+			reference	operator* (void) const { return static_cast<node_type *>(_node)->value(); }
 
 			pointer		operator->(void) const { return &(operator*()); }
 
-			/** @brief increment node position*/
+			/** @brief increment node position (amortized O(1), end() is the header) */
 			treeIterator &	operator++ (void) {
-				if (_node == max(_root)) {
-					_node = _null;
-					return *this;
-				}
-				else if (_node == _null) {
-					_node = ft_nullptr;
-					return *this;
-				}
-				_node = successor(_node);
+				_node = ft::RBT_increment(_node);
 				return *this;
 			}
 			
 			treeIterator	operator++ (int) {
-				treeIterator tmp(_root, _node, _null);
+				treeIterator tmp(*this);
 				operator++();
 				return tmp;
 			}
 
-			/** @brief decrease node position*/
+			/** @brief decrease node position (amortized O(1), --end() is the cached rightmost) */
 			treeIterator &	operator-- (void) {
-				if (_node == _null) {
-					_node = max(_root);
-					return *this;
-				}
-				_node = predecessor(_node);
+				_node = ft::RBT_decrement(_node);
 				return *this;
 			}
 			
 			treeIterator	operator-- (int) {
-				treeIterator tmp(_root, _node, _null);
+				treeIterator tmp(*this);
 				operator--();
 				return tmp;
 			}
 
 			operator treeIterator<const T, Node> (void) {
-				return treeIterator<const T, Node>(_root, _node, _null);
+				return treeIterator<const T, Node>(_node);
 			}
 
 		private:
 		/** attributes */
 			
-			node_pointer _root;
 			node_pointer _node;
-			node_pointer _null;
-
-		/** private function */
-			
-			node_pointer	min(node_pointer s) {
-				while (s->left != _null)
-					s = s->left;
-				return s;
-			}
-
-			node_pointer	max(node_pointer s) {
-				while (s->right != _null)
-					s = s->right;
-				return s;
-			}
-
-			node_pointer	successor(node_pointer x) {
-				if (x->right != _null)
-					return min(x->right);
-
-				node_pointer y = x->parent;
-				while (y != _null && x == y->right) {
-					x = y;
-					y = y->parent;
-				}
-				return y;
-			}
-
-			node_pointer	predecessor(node_pointer s) {
-				if (s->left != _null)
-					return max(s->left);
-
-				node_pointer	tmp = s->parent;
-				while (tmp != _null && s == tmp->left) {
-					s = tmp;
-					tmp = tmp->parent;
-				}
-				return tmp;
-			}
 	};
 
 	template < class _T, class _Node >
@@ -193,6 +130,15 @@ _BEGIN_NS_FT
 		return lhs.getNode() != rhs.getNode();
 	}
 
+	/**
+	 * @brief distance between tree iterators
+	 * @note O(log n) with the order statistic nodes (ft::RBT_SizedNodeBase), a walk otherwise.
+	 */
+	template < class _T, class _Node >
+	typename treeIterator<_T, _Node>::difference_type	distance(treeIterator<_T, _Node> first, treeIterator<_T, _Node> last) {
+		return ft::RBT_distance(first.getNode(), last.getNode());
+	}
+
 _END_NS_FT
 
 #endif
\ No newline at end of file
@@ -213,6 +213,74 @@ _BEGIN_NS_FT
 		return (first1 == last1) && (first2 != last2);
 	}
 
+/** 
+ * @class template: conditional
+ */
+
+	/**
+	 * @brief conditional type
+	 * @note type is T if Cond is true, F otherwise.
+	 */
+	template < bool Cond, class T, class F >
+	struct conditional { typedef T type; };
+
+	template < class T, class F >
+	struct conditional<false, T, F> { typedef F type; };
+
+/** 
+ * @class template: alignment_of
+ */
+
+	/**
+	 * @brief alignment requirement of a type
+	 * @note the padding the compiler puts between a char and a T is the alignment of T.
+	 */
+	template < class T >
+	struct alignment_of {
+		private:
+			struct helper { char c; T t; };
+
+		public:
+			static const std::size_t value = sizeof(helper) - sizeof(T);
+	};
+
+/** 
+ * @class template: type_with_alignment
+ */
+
+	/**
+	 * @brief fundamental type of a given alignment
+	 * @note the first of char, short, int, long, double with an alignment of Align, long double otherwise.
+	 */
+	template < std::size_t Align >
+	struct type_with_alignment {
+		typedef typename conditional<alignment_of<char>::value == Align, char,
+				typename conditional<alignment_of<short>::value == Align, short,
+				typename conditional<alignment_of<int>::value == Align, int,
+				typename conditional<alignment_of<long>::value == Align, long,
+				typename conditional<alignment_of<double>::value == Align, double,
+				long double>::type>::type>::type>::type>::type	type;
+	};
+
+/** 
+ * @class template: raw_storage
+ */
+
+	/**
+	 * @brief uninitialized storage for one T
+	 * @note sized and aligned for a T, nothing is constructed:
+	 * a T is built in bytes with placement new, and destroyed by hand.
+	 */
+	template < class T >
+	union raw_storage {
+		char															bytes[sizeof(T)];
+		typename type_with_alignment<alignment_of<T>::value>::type		alignment;
+
+		T *			get(void) { return reinterpret_cast<T *>(bytes); }
+
+		T const *	get(void) const { return reinterpret_cast<T const *>(bytes); }
+	};
+
 /** 
  * @class template: binary_function
  */
@@ -243,8 +311,9 @@ _BEGIN_NS_FT
 	 * whether the its first argument compares less than the second (as returned by operator <).
 	 * 
 	 * @param T type of the arguments to compare by the functional call.
+	 * less<void> (or less<>) is transparent: it compares arguments of any types with operator <.
 	 */
-	template < class T >
+	template < class T = void >
 	struct less : binary_function <T, T, bool> {
 	/* member functions */
 
@@ -252,6 +321,61 @@ _BEGIN_NS_FT
 		bool operator() (const T& x, const T& y) const { return x < y; }
 	};
 
+	template <>
+	struct less<void> {
+	/* member types */
+
+		/** @brief tag telling the associative containers they may search with any type comparable to the key */
+		typedef void	is_transparent;
+
+	/* member functions */
+
+		template < class T, class U >
+		bool operator() (const T& x, const U& y) const { return x < y; }
+	};
+
+/**
+ * @class template: equal_to
+ */
+
+	/**
+	 * @brief function object class for equality comparison
+	 * @note binary function object class whose call returns whether its two arguments compare equal (as returned by operator ==).
+	 *
+	 * @param T type of the arguments to compare by the functional call.
+	 */
+	template < class T >
+	struct equal_to : binary_function <T, T, bool> {
+	/* member functions */
+
+		/** @brief member function returning whether its two arguments compare equal (x == y). */
+		bool operator() (const T& x, const T& y) const { return x == y; }
+	};
+
+/** 
+ * @class template: is_transparent_compare
+ */
+
+	/**
+	 * @brief is transparent compare
+	 * @note trait class that identifies whether the comparison object Compare defines the member type is_transparent.
+	 * K is the type used for the lookup, it only makes the trait dependent so it can drive enable_if on member templates.
+	 */
+	template < class Compare, class K >
+	struct is_transparent_compare {
+		private:
+			typedef char					yes;
+			typedef struct { char c[2]; }	no;
+
+			template < class U >
+			static yes	test(typename U::is_transparent *);
+			template < class U >
+			static no	test(...);
+
+		public:
+			static const bool value = sizeof(test<Compare>(0)) == sizeof(yes);
+	};
+
 /** 
  * @class template: pair
  */
@@ -383,6 +507,25 @@ _BEGIN_NS_FT
 		return pair<T1, T2>(x, y);
 	}
 
+/** 
+ * @class template: identity / select_first
+ */
+
+	/**
+	 * @brief key extractors
+	 * @note function objects returning the key of a value stored in a tree:
+	 * identity gives back the value itself (set), select_first the member first of a pair (map).
+	 */
+	template < class T >
+	struct identity {
+		const T &	operator() (const T & x) const { return x; }
+	};
+
+	template < class Pair >
+	struct select_first {
+		const typename Pair::first_type &	operator() (const Pair & x) const { return x.first; }
+	};
+
 _END_NS_FT
 
 #endif
\ No newline at end of file
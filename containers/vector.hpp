@@ -140,7 +140,7 @@ _BEGIN_NS_FT
 			 * 
 			 * @param x: another vector object of the same type, whose contents are either copied or acquired.
 			 */
-			vector(const vector & x) {
+			vector(const vector & x) : _alloc(x._alloc) {
 				size_type n = x.size();
 
 				this->_begin = this->_alloc.allocate(n);
@@ -241,12 +241,12 @@ _BEGIN_NS_FT
 			 */
 			size_type	max_size(void) const {
 			#if defined(__APPLE__) && defined(__MACH__)
-				size_type ret1 = allocator_type().max_size();
+				size_type ret1 = _alloc.max_size();
 				size_type ret2 = std::numeric_limits<difference_type>::max();
 				return (ret1 < ret2) ? ret1 : ret2;
 
 			#else
-				return allocator_type().max_size();
+				return _alloc.max_size();
 
 			#endif
 			}
@@ -0,0 +1,227 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   policyBench.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/18 10:12:40 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/18 10:12:40 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "map.hpp"
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <ctime>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief balancing policies benchmark
+ * @note build: c++ -O2 -std=c++98 -I../../containers policyBench.cpp -o policyBench
+ * usage: ./policyBench [n] (default 1000000 keys)
+ *
+ * the same map of n int keys is built, searched and half erased with every balancing policy.
+ * for each operation: the time and the key comparisons it takes, rebalancing included.
+ * depth: the average and the greatest number of nodes from the root to a key (the root is 1),
+ * what a lookup walks through.
+ * skewed: 4n lookups (find on the map, not const) of keys drawn with a zipf law of exponent 1,
+ * where ft::RBT_Splay moves every key found to the root. depth is then the average depth
+ * of the keys looked up, right before each lookup.
+ */
+
+/**
+ * @brief utils
+ */
+
+/** @brief less than on int, counting its calls */
+struct countingLess {
+	static unsigned long	calls;
+
+	bool operator() (int lhs, int rhs) const {
+		++calls;
+		return lhs < rhs;
+	}
+};
+
+unsigned long	countingLess::calls = 0;
+
+double	seconds(void) { return static_cast<double>(std::clock()) / CLOCKS_PER_SEC; }
+
+/** @brief deterministic pseudo random numbers (LCG) */
+int	nextRand(unsigned long & seed) {
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return static_cast<int>(seed >> 33);
+}
+
+/** @brief number of nodes from the root to node: the parent of the root is the header, whose parent is the root */
+template < class Pointer >
+std::size_t	depthOf(Pointer node) {
+	std::size_t depth = 1;
+
+	for (; node->parent()->parent() != node; node = node->parent())
+		++depth;
+	return depth;
+}
+
+template < class Map >
+void	printDepth(Map const & m) {
+	std::size_t	sum = 0;
+	std::size_t	max = 0;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it) {
+		std::size_t depth = depthOf(it.getNode());
+
+		sum += depth;
+		if (depth > max)
+			max = depth;
+	}
+	std::cout << "  " << std::left << std::setw(14) << "depth" << std::right
+		<< std::setw(8) << std::fixed << std::setprecision(2) << static_cast<double>(sum) / m.size() << " avg"
+		<< std::setw(8) << max << " max" << std::endl;
+}
+
+/** @brief time (ns) and comparisons for each of n operations */
+void	printCost(std::string const & what, double start, unsigned long calls, std::size_t n) {
+	std::cout << "  " << std::left << std::setw(14) << what << std::right
+		<< std::setw(8) << std::fixed << std::setprecision(0) << (seconds() - start) * 1e9 / n << " ns"
+		<< std::setw(8) << std::setprecision(2) << static_cast<double>(calls) / n << " cmp" << std::endl;
+}
+
+/**
+ * @brief benchmark of one policy
+ */
+
+template < class Map >
+void	run(std::string const & name, std::vector<int> const & keys) {
+	Map			m;
+	Map const &	cm = m;
+	std::size_t	n = keys.size();
+	long		hit = 0;
+	double		start;
+
+	std::cout << name << std::endl;
+
+	countingLess::calls = 0;
+	start = seconds();
+	for (std::size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(keys[i], 0));
+	printCost("insert", start, countingLess::calls, n);
+	printDepth(m);
+
+	countingLess::calls = 0;
+	start = seconds();
+	for (std::size_t i = 0; i < n; i++)
+		hit += cm.find(keys[i]) != cm.end();
+	printCost("find", start, countingLess::calls, n);
+
+	countingLess::calls = 0;
+	start = seconds();
+	for (std::size_t i = 0; i < n; i += 2)
+		m.erase(keys[i]);
+	printCost("erase half", start, countingLess::calls, (n + 1) / 2);
+	printDepth(m);
+
+	countingLess::calls = 0;
+	start = seconds();
+	for (std::size_t i = 1; i < n; i += 2)
+		hit += cm.find(keys[i]) != cm.end();
+	printCost("find after", start, countingLess::calls, n / 2);
+
+	if (hit != static_cast<long>(n + n / 2))
+		std::cout << "  lost keys!" << std::endl;
+}
+
+/** @brief lookups of the keys of trace, in that order */
+template < class Map >
+void	runSkewed(std::string const & name, std::vector<int> const & keys, std::vector<int> const & trace) {
+	Map			m;
+	Map const &	cm = m;
+	long		hit = 0;
+	std::size_t	depth = 0;
+	double		start;
+
+	for (std::size_t i = 0; i < keys.size(); i++)
+		m.insert(ft::make_pair(keys[i], 0));
+
+	std::cout << name << std::endl;
+
+	countingLess::calls = 0;
+	start = seconds();
+	for (std::size_t i = 0; i < trace.size(); i++)
+		hit += m.find(trace[i]) != m.end();
+	printCost("find", start, countingLess::calls, trace.size());
+
+	// the trace again: the depth of every key before the lookup moves it
+	for (std::size_t i = 0; i < trace.size(); i++) {
+		depth += depthOf(cm.find(trace[i]).getNode());
+		m.find(trace[i]);
+	}
+	std::cout << "  " << std::left << std::setw(14) << "depth" << std::right
+		<< std::setw(8) << std::fixed << std::setprecision(2) << static_cast<double>(depth) / trace.size() << " avg" << std::endl;
+
+	if (hit != static_cast<long>(trace.size()))
+		std::cout << "  lost keys!" << std::endl;
+}
+
+typedef std::allocator<ft::pair<const int, int> >	int_alloc;
+
+void	runAll(std::vector<int> const & keys) {
+	run<ft::map<int, int, countingLess> >("red black", keys);
+	run<ft::basic_map<int, int, countingLess, int_alloc, ft::RBT_AVL> >("avl", keys);
+	run<ft::basic_map<int, int, countingLess, int_alloc, ft::RBT_WeightBalanced> >("weight balanced", keys);
+}
+
+/**
+ * @brief main
+ */
+
+int main(int ac, char **av) {
+	std::size_t		n = ac > 1 ? std::strtoul(av[1], 0, 10) : 1000000;
+	unsigned long	seed = 42;
+
+	if (n < 2) {
+		std::cerr << "usage: ./policyBench [n >= 2]" << std::endl;
+		return 1;
+	}
+
+	std::vector<int> keys(n);
+	for (std::size_t i = 0; i < n; i++)
+		keys[i] = static_cast<int>(i);
+
+	std::cout << "-- [" << n << " sorted keys] --" << std::endl;
+	runAll(keys);
+
+	for (std::size_t i = n - 1; i > 0; i--)
+		std::swap(keys[i], keys[static_cast<std::size_t>(nextRand(seed)) % (i + 1)]);
+
+	std::cout << std::endl << "-- [" << n << " random keys] --" << std::endl;
+	runAll(keys);
+	run<ft::basic_map<int, int, countingLess, int_alloc, ft::RBT_Splay> >("splay", keys);
+
+	// the key of rank r (in keys order) is drawn with a probability proportional to 1 / (r + 1)
+	std::vector<double>	cdf(n);
+	double				sum = 0;
+	for (std::size_t i = 0; i < n; i++) {
+		sum += 1.0 / static_cast<double>(i + 1);
+		cdf[i] = sum;
+	}
+	std::vector<int> trace(4 * n);
+	for (std::size_t i = 0; i < trace.size(); i++) {
+		double u = static_cast<double>(static_cast<unsigned int>(nextRand(seed))) / 2147483648.0 * sum;
+		std::size_t r = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+
+		trace[i] = keys[r < n ? r : n - 1];
+	}
+
+	std::cout << std::endl << "-- [" << trace.size() << " skewed lookups] --" << std::endl;
+	runSkewed<ft::map<int, int, countingLess> >("red black", keys, trace);
+	runSkewed<ft::basic_map<int, int, countingLess, int_alloc, ft::RBT_AVL> >("avl", keys, trace);
+	runSkewed<ft::basic_map<int, int, countingLess, int_alloc, ft::RBT_WeightBalanced> >("weight balanced", keys, trace);
+	runSkewed<ft::basic_map<int, int, countingLess, int_alloc, ft::RBT_Splay> >("splay", keys, trace);
+	return 0;
+}
\ No newline at end of file
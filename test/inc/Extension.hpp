@@ -0,0 +1,597 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Extension.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 18:02:11 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 18:02:11 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EXTENSION_HPP
+# define EXTENSION_HPP
+
+/**
+ * @brief ft extensions under test
+ * @note the std containers have no equivalent of the ft extensions: the tests reach them through
+ * the helpers below, which give the std build the same output with plain std code.
+ * __STD__ is defined when __NS__ is std.
+ */
+
+#define EXT_CAT(a, b) a ## b
+#define EXT_XCAT(a, b) EXT_CAT(a, b)
+#define EXT_NS_std 1
+
+#if EXT_XCAT(EXT_NS_, __NS__) == 1
+# define __STD__
+#endif
+
+/** @brief a balancing / augmentation / storage policy of the ft trees (e.g. RBT_AVL), ignored for std */
+#ifdef __STD__
+struct ExtNoPolicy {};
+
+# define EXT_POLICY(name) ExtNoPolicy
+#else
+# define EXT_POLICY(name) ft::name
+#endif
+
+/** @brief ft::basic_map / ft::basic_set with the given policies, std::map / std::set for std */
+#ifdef __STD__
+# include <map>
+# include <set>
+
+template < class Key, class T, class Compare, class Alloc, class Balance, class Augment = ExtNoPolicy, class Storage = ExtNoPolicy >
+struct ext_basic_map { typedef std::map<Key, T, Compare, Alloc>	type; };
+
+template < class T, class Compare, class Alloc, class Balance, class Augment = ExtNoPolicy, class Storage = ExtNoPolicy >
+struct ext_basic_set { typedef std::set<T, Compare, Alloc>	type; };
+
+#else
+# include "map.hpp"
+# include "set.hpp"
+
+template < class Key, class T, class Compare, class Alloc, class Balance, class Augment = ft::RBT_NodeBase,
+	class Storage = ft::RBT_NodeStorage >
+struct ext_basic_map { typedef ft::basic_map<Key, T, Compare, Alloc, Balance, Augment, Storage>	type; };
+
+template < class T, class Compare, class Alloc, class Balance, class Augment = ft::RBT_NodeBase,
+	class Storage = ft::RBT_NodeStorage >
+struct ext_basic_set { typedef ft::basic_set<T, Compare, Alloc, Balance, Augment, Storage>	type; };
+
+#endif
+
+/**
+ * @brief erase the element at it, return the element after it
+ * @note the ft btree / flat / hash containers invalidate every iterator on erase but return the next one,
+ * the std tree containers of C++98 return nothing and keep the other iterators valid.
+ */
+#ifdef __STD__
+template < class C, class It >
+It	extEraseAt(C & c, It it) {
+	c.erase(it++);
+	return it;
+}
+
+#else
+template < class C, class It >
+It	extEraseAt(C & c, It it) { return c.erase(it); }
+
+#endif
+
+/** @brief a transparent comparison (ft::less<>), std::less<Key> for std (the keys are converted for the lookup) */
+#ifdef __STD__
+# define EXT_TRANSPARENT_LESS(Key) std::less<Key>
+#else
+# define EXT_TRANSPARENT_LESS(Key) ft::less<>
+#endif
+
+/** @brief an arena and allocators on it (ft::arena_allocator), std::allocator for std */
+#ifdef __STD__
+struct ExtArena {};
+
+template < class T >
+struct ext_arena_allocator {
+	typedef std::allocator<T>	type;
+
+	static type	make(ExtArena &) { return type(); }
+};
+
+#else
+# include "utils/arenaAllocator.hpp"
+
+typedef ft::arena	ExtArena;
+
+template < class T >
+struct ext_arena_allocator {
+	typedef ft::arena_allocator<T>	type;
+
+	static type	make(ExtArena & arena) { return type(arena); }
+};
+
+#endif
+
+/**
+ * @brief node handles: extract / insert(node) / merge
+ * @note the std build keeps a copy of the extracted value, transferred by copy like ft::nodeHandle.
+ * extInsert leaves nh empty, the node of a failed insertion is in the returned node (as for ft).
+ */
+#ifdef __STD__
+# include <map>
+# include <set>
+
+template < class Value >
+class ExtNode {
+	public:
+		ExtNode(void) : _val(0) {}
+		explicit ExtNode(Value const & val) : _val(new Value(val)) {}
+		ExtNode(ExtNode const & src) : _val(src._val) { src._val = 0; }
+		~ExtNode(void) { delete _val; }
+
+		ExtNode & operator=(ExtNode const & rhs) {
+			if (this == &rhs) return *this;
+
+			delete _val;
+			_val = rhs._val;
+			rhs._val = 0;
+			return *this;
+		}
+
+		bool	empty(void) const { return _val == 0; }
+
+		Value &	get(void) const { return *_val; }
+
+		void	clear(void) const {
+			delete _val;
+			_val = 0;
+		}
+
+	private:
+		mutable Value	*_val;
+};
+
+template < class Key, class T >
+class ExtMapNode : public ExtNode<std::pair<const Key, T> > {
+	public:
+		ExtMapNode(void) {}
+		explicit ExtMapNode(std::pair<const Key, T> const & val) : ExtNode<std::pair<const Key, T> >(val) {}
+
+		Key &	key(void) const { return const_cast<Key &>(this->get().first); }
+		T &		mapped(void) const { return this->get().second; }
+};
+
+template < class T >
+class ExtSetNode : public ExtNode<T> {
+	public:
+		ExtSetNode(void) {}
+		explicit ExtSetNode(T const & val) : ExtNode<T>(val) {}
+
+		T &	value(void) const { return this->get(); }
+};
+
+template < class C > struct ext_node;
+template < class K, class T, class Comp, class A >
+struct ext_node<std::map<K, T, Comp, A> > { typedef ExtMapNode<K, T> type; };
+template < class T, class Comp, class A >
+struct ext_node<std::set<T, Comp, A> > { typedef ExtSetNode<T> type; };
+
+template < class C >
+struct ext_insert_return {
+	struct type {
+		typename C::iterator		position;
+		bool						inserted;
+		typename ext_node<C>::type	node;
+	};
+};
+
+template < class C >
+typename ext_node<C>::type	extExtract(C & c, typename C::iterator pos) {
+	typename ext_node<C>::type nh(*pos);
+
+	c.erase(pos);
+	return nh;
+}
+
+template < class C >
+typename ext_node<C>::type	extExtract(C & c, typename C::key_type const & k) {
+	typename C::iterator pos = c.find(k);
+
+	if (pos == c.end())
+		return typename ext_node<C>::type();
+	return extExtract(c, pos);
+}
+
+template < class C >
+typename ext_insert_return<C>::type	extInsert(C & c, typename ext_node<C>::type const & nh) {
+	typename ext_insert_return<C>::type ret;
+
+	ret.position = c.end();
+	ret.inserted = false;
+	if (nh.empty())
+		return ret;
+
+	std::pair<typename C::iterator, bool> pos = c.insert(nh.get());
+
+	ret.position = pos.first;
+	ret.inserted = pos.second;
+	if (pos.second)
+		nh.clear();
+	else
+		ret.node = nh;
+	return ret;
+}
+
+template < class C >
+typename C::iterator	extInsert(C & c, typename C::iterator hint, typename ext_node<C>::type const & nh) {
+	if (nh.empty())
+		return c.end();
+
+	typename C::size_type	size = c.size();
+	typename C::iterator	pos = c.insert(hint, nh.get());
+
+	if (c.size() != size)
+		nh.clear();
+	return pos;
+}
+
+template < class C >
+void	extMerge(C & c, C & source) {
+	for (typename C::iterator it = source.begin(); it != source.end(); ) {
+		if (c.insert(*it).second)
+			source.erase(it++);
+		else
+			++it;
+	}
+}
+
+#else
+
+template < class C > struct ext_node { typedef typename C::node_type type; };
+
+template < class C > struct ext_insert_return { typedef typename C::insert_return_type type; };
+
+template < class C >
+typename ext_node<C>::type	extExtract(C & c, typename C::iterator pos) { return c.extract(pos); }
+
+template < class C >
+typename ext_node<C>::type	extExtract(C & c, typename C::key_type const & k) { return c.extract(k); }
+
+template < class C >
+typename ext_insert_return<C>::type	extInsert(C & c, typename ext_node<C>::type const & nh) { return c.insert(nh); }
+
+template < class C >
+typename C::iterator	extInsert(C & c, typename C::iterator hint, typename ext_node<C>::type const & nh) {
+	return c.insert(hint, nh);
+}
+
+template < class C >
+void	extMerge(C & c, C & source) { c.merge(source); }
+
+#endif
+
+/** @brief the key of an element of a map or of a set */
+#ifdef __STD__
+# include <utility>
+#else
+# include "utils/utils.hpp"
+#endif
+
+template < class T >
+T const &	extKeyOf(T const & val) { return val; }
+
+template < class K, class T >
+K const &	extKeyOf(__NS__::pair<const K, T> const & val) { return val.first; }
+
+/**
+ * @brief in place set algebra: set_union / set_intersection / set_difference
+ * @note the std build goes element by element.
+ */
+#ifdef __STD__
+template < class C >
+void	extSetUnion(C & c, C & other) {
+	for (typename C::iterator it = other.begin(); it != other.end(); ) {
+		if (c.insert(*it).second)
+			other.erase(it++);
+		else
+			++it;
+	}
+}
+
+template < class C >
+void	extSetIntersection(C & c, C const & other) {
+	for (typename C::iterator it = c.begin(); it != c.end(); ) {
+		if (other.count(extKeyOf(*it)) == 0)
+			c.erase(it++);
+		else
+			++it;
+	}
+}
+
+template < class C >
+void	extSetDifference(C & c, C const & other) {
+	for (typename C::const_iterator it = other.begin(); it != other.end(); ++it)
+		c.erase(extKeyOf(*it));
+}
+
+#else
+template < class C >
+void	extSetUnion(C & c, C & other) { c.set_union(other); }
+
+template < class C >
+void	extSetIntersection(C & c, C const & other) { c.set_intersection(other); }
+
+template < class C >
+void	extSetDifference(C & c, C const & other) { c.set_difference(other); }
+
+#endif
+
+/**
+ * @brief order statistics: nth / rank / count_range (ft::RBT_SizedNodeBase, ft::RBT_WeightBalanced)
+ * @note the std build walks the elements.
+ */
+#ifdef __STD__
+template < class C >
+typename C::const_iterator	extNth(C const & c, typename C::size_type n) {
+	typename C::const_iterator it = c.begin();
+
+	for (; n > 0 && it != c.end(); --n)
+		++it;
+	return it;
+}
+
+template < class C >
+typename C::size_type	extRank(C const & c, typename C::key_type const & k) {
+	return std::distance(c.begin(), c.lower_bound(k));
+}
+
+template < class C >
+typename C::size_type	extCountRange(C const & c, typename C::key_type const & lo, typename C::key_type const & hi) {
+	if (c.key_comp()(lo, hi) == false)
+		return 0;
+	return std::distance(c.lower_bound(lo), c.lower_bound(hi));
+}
+
+#else
+template < class C >
+typename C::const_iterator	extNth(C const & c, typename C::size_type n) { return c.nth(n); }
+
+template < class C >
+typename C::size_type	extRank(C const & c, typename C::key_type const & k) { return c.rank(k); }
+
+template < class C >
+typename C::size_type	extCountRange(C const & c, typename C::key_type const & lo, typename C::key_type const & hi) {
+	return c.count_range(lo, hi);
+}
+
+#endif
+
+/**
+ * @brief summaries: summary / aggregate / refresh (ft::RBT_AugmentedNodeBase<Policy>, see ext_augment)
+ * @note the std build folds the elements with Policy.
+ */
+#ifdef __STD__
+template < class Policy >
+struct ext_augment { typedef ExtNoPolicy	type; };
+
+template < class Policy, class C >
+typename Policy::summary_type	extAggregate(C const & c, typename C::key_type const & lo, typename C::key_type const & hi) {
+	typename Policy::summary_type sum = Policy::identity();
+
+	for (typename C::const_iterator it = c.lower_bound(lo); it != c.end() && c.key_comp()(extKeyOf(*it), hi); ++it)
+		sum = Policy::combine(sum, Policy::summarize(*it));
+	return sum;
+}
+
+template < class Policy, class C >
+typename Policy::summary_type	extSummary(C const & c) {
+	typename Policy::summary_type sum = Policy::identity();
+
+	for (typename C::const_iterator it = c.begin(); it != c.end(); ++it)
+		sum = Policy::combine(sum, Policy::summarize(*it));
+	return sum;
+}
+
+template < class C >
+void	extRefresh(C &, typename C::iterator) {}
+
+#else
+# include "utils/RBT.hpp"
+
+template < class Policy >
+struct ext_augment { typedef ft::RBT_AugmentedNodeBase<Policy>	type; };
+
+template < class Policy, class C >
+typename Policy::summary_type	extAggregate(C const & c, typename C::key_type const & lo, typename C::key_type const & hi) {
+	return c.aggregate(lo, hi);
+}
+
+template < class Policy, class C >
+typename Policy::summary_type	extSummary(C const & c) { return c.summary(); }
+
+template < class C >
+void	extRefresh(C & c, typename C::iterator position) { c.refresh(position); }
+
+#endif
+
+/**
+ * @brief ft::interval_map, with the allocator Alloc
+ * @note the std build is a std::map of the intervals searched one by one.
+ */
+#ifdef __STD__
+# include <map>
+
+template < class Bound, class T, class Alloc >
+class ExtIntervalMap : public std::map<std::pair<Bound, Bound>, T, std::less<std::pair<Bound, Bound> >, Alloc> {
+	public:
+		typedef std::map<std::pair<Bound, Bound>, T, std::less<std::pair<Bound, Bound> >, Alloc>	map_type;
+		typedef typename map_type::iterator				iterator;
+		typedef typename map_type::const_iterator		const_iterator;
+		typedef typename map_type::size_type			size_type;
+
+		explicit ExtIntervalMap(std::less<Bound> const & = std::less<Bound>(), Alloc const & alloc = Alloc()) :
+			map_type(std::less<std::pair<Bound, Bound> >(), alloc) {}
+
+		iterator	find_overlap(Bound const & lo, Bound const & hi) {
+			iterator it = this->begin();
+
+			while (it != this->end() && overlaps(it->first, lo, hi) == false)
+				++it;
+			return it;
+		}
+
+		template < class OutputIterator >
+		OutputIterator	find_overlaps(Bound const & lo, Bound const & hi, OutputIterator out) {
+			for (iterator it = this->begin(); it != this->end(); ++it) {
+				if (overlaps(it->first, lo, hi))
+					*out++ = it;
+			}
+			return out;
+		}
+
+		template < class OutputIterator >
+		OutputIterator	find_containing(Bound const & point, OutputIterator out) {
+			for (iterator it = this->begin(); it != this->end(); ++it) {
+				if ((point < it->first.first) == false && point < it->first.second)
+					*out++ = it;
+			}
+			return out;
+		}
+
+		size_type	count_overlaps(Bound const & lo, Bound const & hi) const {
+			size_type n = 0;
+
+			for (const_iterator it = this->begin(); it != this->end(); ++it)
+				n += overlaps(it->first, lo, hi);
+			return n;
+		}
+
+	private:
+		static bool	overlaps(std::pair<Bound, Bound> const & i, Bound const & lo, Bound const & hi) {
+			return i.first < hi && lo < i.second;
+		}
+};
+
+template < class Bound, class T, class Alloc = std::allocator<std::pair<const std::pair<Bound, Bound>, T> > >
+struct ext_interval_map { typedef ExtIntervalMap<Bound, T, Alloc>	type; };
+
+#else
+# include "interval_map.hpp"
+
+template < class Bound, class T, class Alloc = std::allocator<ft::pair<const ft::pair<Bound, Bound>, T> > >
+struct ext_interval_map { typedef ft::interval_map<Bound, T, ft::less<Bound>, Alloc>	type; };
+
+#endif
+
+/**
+ * @brief flat containers: reserve / keys / values (ft::flat_map, ft::flat_set)
+ * @note the std build reserves nothing, and copies the keys, the mapped values or the elements out of the tree.
+ */
+#ifdef __STD__
+# include <map>
+# include <set>
+# include <vector>
+
+template < class C >
+void	extReserve(C &, typename C::size_type) {}
+
+template < class K, class T, class Comp, class A >
+std::vector<K>	extKeys(std::map<K, T, Comp, A> const & m) {
+	std::vector<K>	keys;
+
+	for (typename std::map<K, T, Comp, A>::const_iterator it = m.begin(); it != m.end(); ++it)
+		keys.push_back(it->first);
+	return keys;
+}
+
+template < class K, class T, class Comp, class A >
+std::vector<T>	extValues(std::map<K, T, Comp, A> const & m) {
+	std::vector<T>	values;
+
+	for (typename std::map<K, T, Comp, A>::const_iterator it = m.begin(); it != m.end(); ++it)
+		values.push_back(it->second);
+	return values;
+}
+
+template < class T, class Comp, class A >
+std::vector<T>	extValues(std::set<T, Comp, A> const & s) { return std::vector<T>(s.begin(), s.end()); }
+
+#else
+# include "flat_map.hpp"
+# include "flat_set.hpp"
+
+template < class C >
+void	extReserve(C & c, typename C::size_type n) { c.reserve(n); }
+
+template < class K, class T, class Comp, class A >
+typename ft::flat_map<K, T, Comp, A>::key_container_type const &	extKeys(ft::flat_map<K, T, Comp, A> const & m) {
+	return m.keys();
+}
+
+template < class K, class T, class Comp, class A >
+typename ft::flat_map<K, T, Comp, A>::mapped_container_type const &	extValues(ft::flat_map<K, T, Comp, A> const & m) {
+	return m.values();
+}
+
+template < class T, class Comp, class A >
+typename ft::flat_set<T, Comp, A>::container_type const &	extValues(ft::flat_set<T, Comp, A> const & s) { return s.values(); }
+
+#endif
+
+/** @brief a value without default constructor */
+class NoDefault {
+	public:
+		explicit NoDefault(int const i) : _i(i) {}
+		NoDefault(NoDefault const & src) : _i(src._i) {}
+		~NoDefault(void) {}
+
+		NoDefault & operator=(NoDefault const & rhs) {
+			_i = rhs._i;
+			return *this;
+		}
+
+		int getI(void) const { return _i; }
+
+	private:
+		int _i;
+};
+
+
+#include <stdexcept>
+
+/**
+ * @brief a value whose copies throw on demand
+ * @note once countdown is set to n, the n-th copy throws (then countdown is 0: no more throw).
+ * live counts the instances and a destroyed value reads -1, so a leak or a use after destruction shows.
+ */
+class CopyThrower {
+	public:
+		explicit CopyThrower(int const i) : _i(i) { ++live; }
+		CopyThrower(CopyThrower const & src) : _i(src._i) {
+			if (countdown > 0 && --countdown == 0)
+				throw std::runtime_error("CopyThrower");
+			++live;
+		}
+		~CopyThrower(void) {
+			_i = -1;
+			--live;
+		}
+
+		CopyThrower & operator=(CopyThrower const & rhs) {
+			_i = rhs._i;
+			return *this;
+		}
+
+		int getI(void) const { return _i; }
+
+		static int	countdown;
+		static long	live;
+
+	private:
+		int _i;
+};
+
+int		CopyThrower::countdown = 0;
+long	CopyThrower::live = 0;
+
+#endif
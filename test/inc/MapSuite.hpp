@@ -0,0 +1,522 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   MapSuite.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 18:40:02 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 18:40:02 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAPSUITE_HPP
+# define MAPSUITE_HPP
+
+#include "Custom.hpp"
+#include "Extension.hpp"
+#include "Tester.hpp"
+#include <memory>
+#include <vector>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief printers of the ordered map containers
+ */
+
+template < class Map >
+void	printContent(Map const & m) {
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		std::cout << it->first << ": " << it->second << std::endl;
+	printSize(m);
+}
+
+/** @brief size, sum of the keys and of the values, first and last elements: enough to diff big maps */
+template < class Map >
+void	printDigest(Map const & m) {
+	long	keys = 0;
+	long	values = 0;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it) {
+		keys += it->first;
+		values += it->second;
+	}
+	std::cout << "size: " << m.size() << ", keys: " << keys << ", values: " << values;
+	if (m.empty() == false)
+		std::cout << ", first: " << m.begin()->first << ", last: " << m.rbegin()->first;
+	std::cout << std::endl;
+}
+
+struct classcomp { bool operator() (const int& lhs, const int& rhs) const { return lhs > rhs; } };
+
+/**
+ * @class template: MapSuite
+ */
+
+/**
+ * @brief the tests of the standard interface of a map (construction to equal_range), run on Map
+ * @note the map containers with no std equivalent (ft::btree_map, ft::flat_map) are diffed against std::map:
+ * Map is the container template, taking Key, T, Compare and Alloc, instantiated with the default allocator.
+ * a test program picks the tests it runs, e.g. {"constructTest", &MapSuite<ft::flat_map>::constructTest}.
+ */
+template < template < class, class, class, class > class Map >
+class MapSuite {
+	public:
+	/* member types */
+
+		template < class Key, class T, class Compare = __NS__::less<Key> >
+		struct of { typedef Map<Key, T, Compare, std::allocator<__NS__::pair<const Key, T> > >	type; };
+
+		typedef typename	of<int, int>::type					int_map;
+		typedef typename	of<int, int, classcomp>::type		greater_map;
+		typedef typename	of<char, int>::type					char_map;
+		typedef typename	of<int, std::string>::type			str_map;
+		typedef typename	of<std::string, int>::type			word_map;
+		typedef typename	of<std::string, std::string>::type	string_map;
+		typedef typename	of<std::string, Custom>::type		custom_map;
+
+	/* tests */
+
+		/**
+		 * @brief constructor test
+		 */
+
+		static void	constructTest(void) {
+			printTitle("Constructor");
+
+			std::cout << "basic construct: + (a, 10) (b, 20) (c, 30) (d, 40):\n";
+			char_map m1;
+			m1['a'] = 10;
+			m1['b'] = 20;
+			m1['c'] = 30;
+			m1['d'] = 40;
+			printContent(m1);
+
+			std::cout << "range: unsorted vector of 1000 pairs, with duplicates:\n";
+			std::vector<__NS__::pair<int, int> >	v;
+			unsigned long							seed = 42;
+			for (int i = 0; i < 1000; i++)
+				v.push_back(__NS__::make_pair(nextRand(seed) % 700, i));
+			int_map m2(v.begin(), v.end());
+			printDigest(m2);
+
+			std::cout << "copy: m3(m2):\n";
+			int_map m3(m2);
+			printDigest(m3);
+			std::cout << "m3 == m2: " << (m3 == m2) << std::endl;
+
+			std::cout << "class as Compare (greater):\n";
+			greater_map m4(m2.begin(), m2.end());
+			printDigest(m4);
+			std::cout << "first: " << m4.begin()->first << std::endl;
+
+			std::cout << "assign: m5 = m2, then clear m2:\n";
+			int_map m5;
+			m5[1] = 1;
+			m5 = m2;
+			m2.clear();
+			printDigest(m5);
+			printDigest(m2);
+			std::cout << "m5 != m2: " << (m5 != m2) << std::endl;
+		}
+
+		/**
+		 * @brief iterator test
+		 */
+
+		static void	iteratorTest(void) {
+			printTitle("Iterator");
+
+			int_map m1;
+			std::cout << "+ (i * 7 % 500, i) for i in [0, 500):\n";
+			for (int i = 0; i < 500; i++)
+				m1[i * 7 % 500] = i;
+
+			std::cout << "begin -> end, every 50th:\n";
+			int n = 0;
+			for (typename int_map::iterator it = m1.begin(); it != m1.end(); ++it, ++n) {
+				if (n % 50 == 0)
+					std::cout << it->first << ": " << it->second << std::endl;
+			}
+
+			std::cout << "rbegin -> rend, every 50th:\n";
+			n = 0;
+			for (typename int_map::reverse_iterator it = m1.rbegin(); it != m1.rend(); ++it, ++n) {
+				if (n % 50 == 0)
+					std::cout << it->first << ": " << it->second << std::endl;
+			}
+
+			std::cout << "end -> begin with operator--:\n";
+			typename int_map::iterator it = m1.end();
+			n = 0;
+			while (it != m1.begin()) {
+				--it;
+				++n;
+			}
+			std::cout << "steps: " << n << ", first: " << it->first << std::endl;
+
+			std::cout << "const_iterator from iterator: ";
+			typename int_map::const_iterator cit = m1.begin();
+			std::cout << (cit == m1.begin() ? "equal" : "different") << std::endl;
+
+			std::cout << "write through the iterator: second *= 2:\n";
+			for (typename int_map::iterator wit = m1.begin(); wit != m1.end(); ++wit)
+				wit->second *= 2;
+			printDigest(m1);
+
+			std::cout << "post increment / decrement:\n";
+			it = m1.begin();
+			std::cout << (it++)->first << ' ';
+			std::cout << it->first << ' ';
+			std::cout << (it--)->first << ' ';
+			std::cout << it->first << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief empty test
+		 */
+
+		static void	emptyTest(void) {
+			printTitle("Empty");
+
+			custom_map m1;
+			std::cout << (m1.empty() == true ? "m1 is empty" : "m1 is not empty") << std::endl;
+			std::cout << "begin == end: " << (m1.begin() == m1.end()) << std::endl;
+			m1["one"] = Custom(1, "one");
+			std::cout << (m1.empty() == true ? "m1 is empty" : "m1 is not empty") << std::endl;
+			m1.erase("one");
+			std::cout << (m1.empty() == true ? "m1 is empty" : "m1 is not empty") << std::endl;
+			std::cout << "begin == end: " << (m1.begin() == m1.end()) << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief size test
+		 */
+
+		static void	sizeTest(void) {
+			printTitle("Size");
+
+			int_map m1;
+			printSize(m1);
+
+			std::cout << "+ 10000 ascending keys:\n";
+			for (int i = 0; i < 10000; i++)
+				m1.insert(__NS__::make_pair(i, i));
+			printSize(m1);
+
+			std::cout << "- every key but multiples of 100:\n";
+			for (int i = 0; i < 10000; i++) {
+				if (i % 100 != 0)
+					m1.erase(i);
+			}
+			printSize(m1);
+			printDigest(m1);
+
+			string_map m2;
+			m2["a"] = "b";
+			printSize(m2);
+		}
+
+		/**
+		 * @brief element access test
+		 */
+
+		static void	elementAccessTest(void) {
+			printTitle("Element access");
+
+			custom_map m1;
+			std::cout << "Insert with operator[]:\n";
+			m1["c"] = Custom(3, "s");
+			m1["a"] = Custom(1, "c");
+			m1["b"] = Custom(2, "u");
+			m1["d"];
+			std::cout << "change a:\n";
+			m1["a"] = Custom(10, "changed");
+
+			for (typename custom_map::iterator it = m1.begin(); it != m1.end(); ++it)
+				std::cout << it->first << ": " << it->second.getStr() << std::endl;
+			printSize(m1);
+
+			std::cout << "counter with operator[]: ++m[k % 37] for 5000 k\n";
+			int_map m2;
+			for (int k = 0; k < 5000; k++)
+				++m2[k * 13 % 37];
+			printContent(m2);
+		}
+
+		/**
+		 * @brief insert test
+		 */
+
+		static void	insertTest(void) {
+			printTitle("insert");
+
+			str_map m1;
+			std::cout << "insert 2 -> two, 1 -> one, 2 -> again:\n";
+			__NS__::pair<typename str_map::iterator, bool> ret;
+			ret = m1.insert(__NS__::make_pair(2, std::string("two")));
+			std::cout << ret.first->first << " " << ret.first->second << " " << ret.second << std::endl;
+			ret = m1.insert(__NS__::make_pair(1, std::string("one")));
+			std::cout << ret.first->first << " " << ret.first->second << " " << ret.second << std::endl;
+			ret = m1.insert(__NS__::make_pair(2, std::string("again")));
+			std::cout << ret.first->first << " " << ret.first->second << " " << ret.second << std::endl;
+
+			std::cout << "hint insert: end() for 3, begin() for 0, begin() for 10 (bad hint), end() for 2 (present):\n";
+			typename str_map::iterator it;
+			it = m1.insert(m1.end(), __NS__::make_pair(3, std::string("three")));
+			std::cout << it->first << " " << it->second << std::endl;
+			it = m1.insert(m1.begin(), __NS__::make_pair(0, std::string("zero")));
+			std::cout << it->first << " " << it->second << std::endl;
+			it = m1.insert(m1.begin(), __NS__::make_pair(10, std::string("ten")));
+			std::cout << it->first << " " << it->second << std::endl;
+			it = m1.insert(m1.end(), __NS__::make_pair(2, std::string("hint")));
+			std::cout << it->first << " " << it->second << std::endl;
+			printContent(m1);
+
+			std::cout << "20000 random insertions:\n";
+			int_map	m2;
+			unsigned long		seed = 7;
+			int					inserted = 0;
+			for (int i = 0; i < 20000; i++)
+				inserted += m2.insert(__NS__::make_pair(nextRand(seed), i)).second;
+			std::cout << "inserted: " << inserted << std::endl;
+			printDigest(m2);
+
+			std::cout << "insert range of m2 into m3 (every key from a sorted source):\n";
+			int_map m3;
+			m3[50000] = -1;
+			m3.insert(m2.begin(), m2.end());
+			printDigest(m3);
+
+			std::cout << "hinted insertion of ascending keys at end():\n";
+			int_map m4;
+			for (int i = 0; i < 3000; i++)
+				m4.insert(m4.end(), __NS__::make_pair(i * 2, i));
+			printDigest(m4);
+			std::cout << "hinted insertion of the odd keys before their successor:\n";
+			for (int i = 0; i < 3000; i++)
+				m4.insert(m4.find(i * 2), __NS__::make_pair(i * 2 - 1, -i));
+			printDigest(m4);
+		}
+
+		/**
+		 * @brief erase test
+		 */
+
+		static void	eraseTest(void) {
+			printTitle("erase");
+
+			int_map m1;
+			for (int i = 0; i < 5000; i++)
+				m1[i] = i * 3;
+
+			std::cout << "erase(key) of 10 present and 1 absent key: ";
+			std::size_t n = 0;
+			for (int i = 0; i < 5500; i += 500)
+				n += m1.erase(i);
+			std::cout << n << std::endl;
+			printDigest(m1);
+
+			std::cout << "erase(iterator) of every third element:\n";
+			typename int_map::iterator it = m1.begin();
+			n = 0;
+			while (it != m1.end()) {
+				if (n++ % 3 == 0)
+					it = extEraseAt(m1, it);
+				else
+					++it;
+			}
+			printDigest(m1);
+
+			std::cout << "erase(first, last) of [1000, 4000):\n";
+			m1.erase(m1.lower_bound(1000), m1.lower_bound(4000));
+			printDigest(m1);
+
+			std::cout << "erase of the random keys of a big map, one by one:\n";
+			int_map	m2;
+			unsigned long		seed = 3;
+			for (int i = 0; i < 20000; i++)
+				m2[nextRand(seed)] = i;
+			printDigest(m2);
+			seed = 3;
+			n = 0;
+			for (int i = 0; i < 15000; i++)
+				n += m2.erase(nextRand(seed));
+			std::cout << "erased: " << n << std::endl;
+			printDigest(m2);
+
+			std::cout << "erase(begin(), end()):\n";
+			m2.erase(m2.begin(), m2.end());
+			printDigest(m2);
+			m2[1] = 1;
+			printDigest(m2);
+		}
+
+		/**
+		 * @brief swap test
+		 */
+
+		static void	swapTest(void) {
+			printTitle("swap");
+
+			int_map m1;
+			int_map m2;
+			for (int i = 0; i < 1000; i++)
+				m1[i] = i;
+			m2[-1] = -1;
+
+			typename int_map::iterator it = m1.begin();
+			std::cout << "swap, iterators follow their elements:\n";
+			m1.swap(m2);
+			printDigest(m1);
+			printDigest(m2);
+			std::cout << "it still in m2: " << (it == m2.begin()) << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief clear test
+		 */
+
+		static void	clearTest(void) {
+			printTitle("clear");
+
+			string_map m1;
+			for (int i = 0; i < 300; i++)
+				m1[std::string(1 + i % 7, static_cast<char>('a' + i % 26))] = "x";
+			printSize(m1);
+			m1.clear();
+			printSize(m1);
+			m1["after"] = "clear";
+			printSize(m1);
+		}
+
+		/**
+		 * @brief key_comp test
+		 */
+
+		static void	keyCompTest(void) {
+			printTitle("key_comp");
+
+			greater_map m1;
+			for (int i = 0; i < 10; i++)
+				m1[i] = i;
+			typename greater_map::key_compare comp = m1.key_comp();
+			std::cout << "comp(1, 2): " << comp(1, 2) << std::endl;
+			int highest = m1.rbegin()->first;
+			for (typename greater_map::iterator it = m1.begin(); comp(it->first, highest); ++it)
+				std::cout << it->first << ' ';
+			std::cout << std::endl << std::endl;
+		}
+
+		/**
+		 * @brief value_comp test
+		 */
+
+		static void	valueCompTest(void) {
+			printTitle("value_comp");
+
+			char_map m1;
+			m1['x'] = 1001;
+			m1['y'] = 2002;
+			m1['z'] = 3003;
+			typename char_map::value_type highest = *m1.rbegin();
+			typename char_map::iterator it = m1.begin();
+			do {
+				std::cout << it->first << " => " << it->second << '\n';
+			} while (m1.value_comp()(*it++, highest));
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief find test
+		 */
+
+		static void	findTest(void) {
+			printTitle("find");
+
+			int_map m1;
+			for (int i = 0; i < 2000; i += 2)
+				m1[i] = -i;
+			const int_map & cm1 = m1;
+
+			int found = 0;
+			for (int i = -5; i < 2005; i++) {
+				if (m1.find(i) != m1.end() && cm1.find(i)->second == -i)
+					++found;
+			}
+			std::cout << "found: " << found << std::endl;
+			std::cout << "find(1998): " << m1.find(1998)->second << std::endl;
+			std::cout << "find(1999) == end: " << (m1.find(1999) == m1.end()) << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief count test
+		 */
+
+		static void	countTest(void) {
+			printTitle("count");
+
+			word_map m1;
+			m1["a"] = 1;
+			m1["b"] = 2;
+			m1["cc"] = 3;
+			std::cout << "count(a): " << m1.count("a") << ", count(c): " << m1.count("c") << ", count(cc): " << m1.count("cc") << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief bound test
+		 */
+
+		static void	boundTest(void) {
+			printTitle("bound");
+
+			int_map m1;
+			for (int i = 0; i < 3000; i += 3)
+				m1[i] = i;
+
+			for (int k = -1; k < 3005; k += 250) {
+				typename int_map::iterator lo = m1.lower_bound(k);
+				typename int_map::iterator hi = m1.upper_bound(k);
+				std::cout << k << ": lower ";
+				if (lo == m1.end())
+					std::cout << "end";
+				else
+					std::cout << lo->first;
+				std::cout << ", upper ";
+				if (hi == m1.end())
+					std::cout << "end";
+				else
+					std::cout << hi->first;
+				std::cout << std::endl;
+			}
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief equal_range test
+		 */
+
+		static void	equalRangeTest(void) {
+			printTitle("equal_range");
+
+			int_map m1;
+			for (int i = 1; i <= 10; i++)
+				m1[i * 10] = i;
+
+			__NS__::pair<typename int_map::iterator, typename int_map::iterator> ret = m1.equal_range(30);
+			std::cout << "equal_range(30): " << ret.first->first << ", " << ret.second->first << std::endl;
+			ret = m1.equal_range(35);
+			std::cout << "equal_range(35): " << ret.first->first << ", " << ret.second->first << std::endl;
+			ret = m1.equal_range(100);
+			std::cout << "equal_range(100) second == end: " << (ret.second == m1.end()) << std::endl;
+			std::cout << std::endl;
+		}
+};
+
+#endif
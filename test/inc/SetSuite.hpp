@@ -0,0 +1,476 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   SetSuite.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 18:40:02 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 18:40:02 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SETSUITE_HPP
+# define SETSUITE_HPP
+
+#include "Custom.hpp"
+#include "Extension.hpp"
+#include "Tester.hpp"
+#include <memory>
+#include <vector>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief printers of the ordered set containers
+ */
+
+template < class Set >
+void	printContent(Set const & s) {
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+		std::cout << *it << ' ';
+	std::cout << std::endl;
+	printSize(s);
+}
+
+/** @brief size, sum of the values, first and last values: enough to diff big sets */
+template < class Set >
+void	printDigest(Set const & s) {
+	long	values = 0;
+
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+		values += *it;
+	std::cout << "size: " << s.size() << ", values: " << values;
+	if (s.empty() == false)
+		std::cout << ", first: " << *s.begin() << ", last: " << *s.rbegin();
+	std::cout << std::endl;
+}
+
+struct classcomp { bool operator() (const int& lhs, const int& rhs) const { return lhs > rhs; } };
+
+/**
+ * @class template: SetSuite
+ */
+
+/**
+ * @brief the tests of the standard interface of a set (construction to equal_range), run on Set
+ * @note the set containers with no std equivalent (ft::btree_set, ft::flat_set) are diffed against std::set:
+ * Set is the container template, taking T, Compare and Alloc, instantiated with the default allocator.
+ * a test program picks the tests it runs, e.g. {"constructTest", &SetSuite<ft::flat_set>::constructTest}.
+ */
+template < template < class, class, class > class Set >
+class SetSuite {
+	public:
+	/* member types */
+
+		template < class T, class Compare = __NS__::less<T> >
+		struct of { typedef Set<T, Compare, std::allocator<T> >	type; };
+
+		typedef typename	of<int>::type				int_set;
+		typedef typename	of<int, classcomp>::type	greater_set;
+		typedef typename	of<std::string>::type		str_set;
+		typedef typename	of<Custom>::type			custom_set;
+
+	/* tests */
+
+		/**
+		 * @brief constructor test
+		 */
+
+		static void	constructTest(void) {
+			printTitle("Constructor");
+
+			std::cout << "basic construct: + 10 20 30 40:\n";
+			int_set s1;
+			s1.insert(20);
+			s1.insert(40);
+			s1.insert(10);
+			s1.insert(30);
+			printContent(s1);
+
+			std::cout << "range: unsorted vector of 1000 values, with duplicates:\n";
+			std::vector<int>	v;
+			unsigned long		seed = 42;
+			for (int i = 0; i < 1000; i++)
+				v.push_back(nextRand(seed) % 700);
+			int_set s2(v.begin(), v.end());
+			printDigest(s2);
+
+			std::cout << "copy: s3(s2):\n";
+			int_set s3(s2);
+			printDigest(s3);
+			std::cout << "s3 == s2: " << (s3 == s2) << std::endl;
+
+			std::cout << "class as Compare (greater):\n";
+			greater_set s4(s2.begin(), s2.end());
+			printDigest(s4);
+			std::cout << "first: " << *s4.begin() << std::endl;
+
+			std::cout << "assign: s5 = s2, then clear s2:\n";
+			int_set s5;
+			s5.insert(1);
+			s5 = s2;
+			s2.clear();
+			printDigest(s5);
+			printDigest(s2);
+			std::cout << "s5 != s2: " << (s5 != s2) << std::endl;
+		}
+
+		/**
+		 * @brief iterator test
+		 */
+
+		static void	iteratorTest(void) {
+			printTitle("Iterator");
+
+			int_set s1;
+			std::cout << "+ i * 7 % 500 for i in [0, 500):\n";
+			for (int i = 0; i < 500; i++)
+				s1.insert(i * 7 % 500);
+
+			std::cout << "begin -> end, every 50th:\n";
+			int n = 0;
+			for (typename int_set::iterator it = s1.begin(); it != s1.end(); ++it, ++n) {
+				if (n % 50 == 0)
+					std::cout << *it << std::endl;
+			}
+
+			std::cout << "rbegin -> rend, every 50th:\n";
+			n = 0;
+			for (typename int_set::reverse_iterator it = s1.rbegin(); it != s1.rend(); ++it, ++n) {
+				if (n % 50 == 0)
+					std::cout << *it << std::endl;
+			}
+
+			std::cout << "end -> begin with operator--:\n";
+			typename int_set::iterator it = s1.end();
+			n = 0;
+			while (it != s1.begin()) {
+				--it;
+				++n;
+			}
+			std::cout << "steps: " << n << ", first: " << *it << std::endl;
+
+			std::cout << "const_iterator from iterator: ";
+			typename int_set::const_iterator cit = s1.begin();
+			std::cout << (cit == s1.begin() ? "equal" : "different") << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief empty test
+		 */
+
+		static void	emptyTest(void) {
+			printTitle("Empty");
+
+			str_set s1;
+			std::cout << (s1.empty() == true ? "s1 is empty" : "s1 is not empty") << std::endl;
+			std::cout << "begin == end: " << (s1.begin() == s1.end()) << std::endl;
+			s1.insert("one");
+			std::cout << (s1.empty() == true ? "s1 is empty" : "s1 is not empty") << std::endl;
+			s1.erase("one");
+			std::cout << (s1.empty() == true ? "s1 is empty" : "s1 is not empty") << std::endl;
+			std::cout << "begin == end: " << (s1.begin() == s1.end()) << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief size test
+		 */
+
+		static void	sizeTest(void) {
+			printTitle("Size");
+
+			int_set s1;
+			printSize(s1);
+
+			std::cout << "+ 10000 descending values:\n";
+			for (int i = 10000; i > 0; i--)
+				s1.insert(i);
+			printSize(s1);
+
+			std::cout << "- every value but multiples of 100:\n";
+			for (int i = 0; i <= 10000; i++) {
+				if (i % 100 != 0)
+					s1.erase(i);
+			}
+			printSize(s1);
+			printDigest(s1);
+
+			custom_set s2;
+			s2.insert(Custom(1, "a"));
+			printSize(s2);
+		}
+
+		/**
+		 * @brief insert test
+		 */
+
+		static void	insertTest(void) {
+			printTitle("insert");
+
+			str_set s1;
+			std::cout << "insert b, a, b:\n";
+			__NS__::pair<typename str_set::iterator, bool> ret;
+			ret = s1.insert("b");
+			std::cout << *ret.first << " " << ret.second << std::endl;
+			ret = s1.insert("a");
+			std::cout << *ret.first << " " << ret.second << std::endl;
+			ret = s1.insert("b");
+			std::cout << *ret.first << " " << ret.second << std::endl;
+
+			std::cout << "hint insert: end() for c, begin() for 0, begin() for z (bad hint), end() for b (present):\n";
+			typename str_set::iterator it;
+			it = s1.insert(s1.end(), "c");
+			std::cout << *it << std::endl;
+			it = s1.insert(s1.begin(), "0");
+			std::cout << *it << std::endl;
+			it = s1.insert(s1.begin(), "z");
+			std::cout << *it << std::endl;
+			it = s1.insert(s1.end(), "b");
+			std::cout << *it << std::endl;
+			printContent(s1);
+
+			std::cout << "20000 random insertions:\n";
+			int_set	s2;
+			unsigned long	seed = 7;
+			int				inserted = 0;
+			for (int i = 0; i < 20000; i++)
+				inserted += s2.insert(nextRand(seed)).second;
+			std::cout << "inserted: " << inserted << std::endl;
+			printDigest(s2);
+
+			std::cout << "insert range of s2 into s3:\n";
+			int_set s3;
+			s3.insert(50000);
+			s3.insert(s2.begin(), s2.end());
+			printDigest(s3);
+
+			std::cout << "hinted insertion of ascending values at end():\n";
+			int_set s4;
+			for (int i = 0; i < 3000; i++)
+				s4.insert(s4.end(), i * 2);
+			printDigest(s4);
+			std::cout << "hinted insertion of the odd values before their successor:\n";
+			for (int i = 0; i < 3000; i++)
+				s4.insert(s4.find(i * 2), i * 2 - 1);
+			printDigest(s4);
+		}
+
+		/**
+		 * @brief erase test
+		 */
+
+		static void	eraseTest(void) {
+			printTitle("erase");
+
+			int_set s1;
+			for (int i = 0; i < 5000; i++)
+				s1.insert(i);
+
+			std::cout << "erase(value) of 10 present and 1 absent value: ";
+			std::size_t n = 0;
+			for (int i = 0; i < 5500; i += 500)
+				n += s1.erase(i);
+			std::cout << n << std::endl;
+			printDigest(s1);
+
+			std::cout << "erase(iterator) of every third element:\n";
+			typename int_set::iterator it = s1.begin();
+			n = 0;
+			while (it != s1.end()) {
+				if (n++ % 3 == 0)
+					it = extEraseAt(s1, it);
+				else
+					++it;
+			}
+			printDigest(s1);
+
+			std::cout << "erase(first, last) of [1000, 4000):\n";
+			s1.erase(s1.lower_bound(1000), s1.lower_bound(4000));
+			printDigest(s1);
+
+			std::cout << "erase of the random values of a big set, one by one:\n";
+			int_set	s2;
+			unsigned long	seed = 3;
+			for (int i = 0; i < 20000; i++)
+				s2.insert(nextRand(seed));
+			printDigest(s2);
+			seed = 3;
+			n = 0;
+			for (int i = 0; i < 15000; i++)
+				n += s2.erase(nextRand(seed));
+			std::cout << "erased: " << n << std::endl;
+			printDigest(s2);
+
+			std::cout << "erase(begin(), end()):\n";
+			s2.erase(s2.begin(), s2.end());
+			printDigest(s2);
+			s2.insert(1);
+			printDigest(s2);
+		}
+
+		/**
+		 * @brief swap test
+		 */
+
+		static void	swapTest(void) {
+			printTitle("swap");
+
+			int_set s1;
+			int_set s2;
+			for (int i = 0; i < 1000; i++)
+				s1.insert(i);
+			s2.insert(-1);
+
+			typename int_set::iterator it = s1.begin();
+			std::cout << "swap, iterators follow their elements:\n";
+			s1.swap(s2);
+			printDigest(s1);
+			printDigest(s2);
+			std::cout << "it still in s2: " << (it == s2.begin()) << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief clear test
+		 */
+
+		static void	clearTest(void) {
+			printTitle("clear");
+
+			str_set s1;
+			for (int i = 0; i < 300; i++)
+				s1.insert(std::string(1 + i % 7, static_cast<char>('a' + i % 26)));
+			printSize(s1);
+			s1.clear();
+			printSize(s1);
+			s1.insert("after clear");
+			printSize(s1);
+		}
+
+		/**
+		 * @brief key_comp test
+		 */
+
+		static void	keyCompTest(void) {
+			printTitle("key_comp");
+
+			greater_set s1;
+			for (int i = 0; i < 10; i++)
+				s1.insert(i);
+			typename greater_set::key_compare comp = s1.key_comp();
+			std::cout << "comp(1, 2): " << comp(1, 2) << std::endl;
+			int highest = *s1.rbegin();
+			for (typename greater_set::iterator it = s1.begin(); comp(*it, highest); ++it)
+				std::cout << *it << ' ';
+			std::cout << std::endl << std::endl;
+		}
+
+		/**
+		 * @brief value_comp test
+		 */
+
+		static void	valueCompTest(void) {
+			printTitle("value_comp");
+
+			int_set s1;
+			for (int i = 0; i <= 5; i++)
+				s1.insert(i * 10);
+			int highest = *s1.rbegin();
+			typename int_set::iterator it = s1.begin();
+			do {
+				std::cout << *it << ' ';
+			} while (s1.value_comp()(*(++it), highest));
+			std::cout << std::endl << std::endl;
+		}
+
+		/**
+		 * @brief find test
+		 */
+
+		static void	findTest(void) {
+			printTitle("find");
+
+			int_set s1;
+			for (int i = 0; i < 2000; i += 2)
+				s1.insert(i);
+
+			int found = 0;
+			for (int i = -5; i < 2005; i++) {
+				if (s1.find(i) != s1.end() && *s1.find(i) == i)
+					++found;
+			}
+			std::cout << "found: " << found << std::endl;
+			std::cout << "find(1998): " << *s1.find(1998) << std::endl;
+			std::cout << "find(1999) == end: " << (s1.find(1999) == s1.end()) << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief count test
+		 */
+
+		static void	countTest(void) {
+			printTitle("count");
+
+			str_set s1;
+			s1.insert("a");
+			s1.insert("b");
+			s1.insert("cc");
+			std::cout << "count(a): " << s1.count("a") << ", count(c): " << s1.count("c") << ", count(cc): " << s1.count("cc") << std::endl;
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief bound test
+		 */
+
+		static void	boundTest(void) {
+			printTitle("bound");
+
+			int_set s1;
+			for (int i = 0; i < 3000; i += 3)
+				s1.insert(i);
+
+			for (int k = -1; k < 3005; k += 250) {
+				typename int_set::iterator lo = s1.lower_bound(k);
+				typename int_set::iterator hi = s1.upper_bound(k);
+				std::cout << k << ": lower ";
+				if (lo == s1.end())
+					std::cout << "end";
+				else
+					std::cout << *lo;
+				std::cout << ", upper ";
+				if (hi == s1.end())
+					std::cout << "end";
+				else
+					std::cout << *hi;
+				std::cout << std::endl;
+			}
+			std::cout << std::endl;
+		}
+
+		/**
+		 * @brief equal_range test
+		 */
+
+		static void	equalRangeTest(void) {
+			printTitle("equal_range");
+
+			int_set s1;
+			for (int i = 1; i <= 10; i++)
+				s1.insert(i * 10);
+
+			__NS__::pair<typename int_set::iterator, typename int_set::iterator> ret = s1.equal_range(30);
+			std::cout << "equal_range(30): " << *ret.first << ", " << *ret.second << std::endl;
+			ret = s1.equal_range(35);
+			std::cout << "equal_range(35): " << *ret.first << ", " << *ret.second << std::endl;
+			ret = s1.equal_range(100);
+			std::cout << "equal_range(100) second == end: " << (ret.second == s1.end()) << std::endl;
+			std::cout << std::endl;
+		}
+};
+
+#endif
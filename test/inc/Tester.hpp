@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Tester.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 18:40:02 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 18:40:02 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TESTER_HPP
+# define TESTER_HPP
+
+#include <iostream>
+#include <string>
+
+/**
+ * @brief what every test program shares: the table of its tests, the titles, the sizes
+ * and the pseudo random numbers (the same sequence for std and ft)
+ */
+
+typedef void	(*fp)(void);
+struct Test {
+	std::string	testName;
+	fp const	fptr;
+};
+
+void	printTitle(std::string const & title) {
+	std::cout << "-- [" << title << "] --" << std::endl;
+	std::cout << std::endl;
+}
+
+template < class C >
+void	printSize(C const & c) {
+	std::cout << "size: " << c.size() << std::endl;
+	std::cout << "maxSize >= size: " << (c.max_size() >= c.size()) << std::endl;
+	std::cout << std::endl;
+}
+
+/** @brief deterministic pseudo random numbers (LCG) */
+int	nextRand(unsigned long & seed) {
+	seed = seed * 1103515245UL + 12345UL;
+	return static_cast<int>((seed >> 8) % 100000);
+}
+
+#endif
@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_mapTest.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 18:40:02 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 18:40:02 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "MapSuite.hpp"
+#include "btree_map.hpp"
+#include <map>
+#include <vector>
+#include <iostream>
+#include <string>
+
+// #define __NS__ std // default namespace
+
+/** @note std has no btree_map: ft::btree_map is diffed against std::map */
+#ifdef __STD__
+# define BTREE_MAP std::map
+#else
+# define BTREE_MAP ft::btree_map
+#endif
+
+/**
+ * @brief B+ tree test (erase going on with the returned iterator, range insertion around full nodes)
+ * @note a leaf holds 32 pairs of int and an internal node 64 int keys (BTREE_NODE_BYTES): appended in order,
+ * the tree gets a new level at 33, 2081 and 133153 elements (the nodes of the right edge split full but one).
+ */
+
+/** @brief every key in order both ways and found by a lookup */
+template < class Map >
+void	printChecked(Map const & m) {
+	size_t	inOrder = 0;
+	size_t	found = 0;
+	size_t	backward = 0;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it) {
+		typename Map::const_iterator next = it;
+		inOrder += ++next == m.end() || it->first < next->first;
+		found += m.find(it->first) == it;
+	}
+	for (typename Map::const_reverse_iterator rit = m.rbegin(); rit != m.rend(); ++rit)
+		++backward;
+	std::cout << "in order: " << inOrder << ", found: " << found << ", backward: " << backward << ", ";
+	printDigest(m);
+}
+
+void	btreeTest(void) {
+	printTitle("B+ tree");
+
+	std::cout << "erase(iterator) of the even keys in [0, 5000), the returned iterator holding the next key:\n";
+	BTREE_MAP<int, int> m1;
+	for (int i = 0; i < 5000; i++)
+		m1[i] = i;
+	size_t	wrong = 0;
+	for (BTREE_MAP<int, int>::iterator it = m1.begin(); it != m1.end(); ) {
+		if (it->first % 2) {
+			++it;
+			continue;
+		}
+		BTREE_MAP<int, int>::iterator	next = it;
+		int								nextKey = ++next == m1.end() ? -1 : next->first;
+
+		it = extEraseAt(m1, it);
+		wrong += it == m1.end() ? nextKey != -1 : it->first != nextKey;
+	}
+	std::cout << "wrong: " << wrong << std::endl;
+	printChecked(m1);
+
+	std::cout << "erase(iterator) of the last element returns end(): ";
+	BTREE_MAP<int, int>::iterator last = m1.end();
+	last = extEraseAt(m1, --last);
+	std::cout << (last == m1.end()) << std::endl;
+
+	std::cout << "erase(iterator) of the keys in [1000, 1500) from lower_bound(1000), keeping the returned iterator:\n";
+	BTREE_MAP<int, int>::iterator from = m1.lower_bound(1000);
+	while (from != m1.end() && from->first < 1500)
+		from = extEraseAt(m1, from);
+	std::cout << "stopped at: " << from->first << std::endl;
+	printChecked(m1);
+
+	std::cout << "erase(begin()) until empty, the returned iterator being begin():\n";
+	wrong = 0;
+	for (BTREE_MAP<int, int>::iterator it = m1.begin(); it != m1.end(); ) {
+		it = extEraseAt(m1, it);
+		wrong += it != m1.begin();
+	}
+	std::cout << "wrong: " << wrong << std::endl;
+	printChecked(m1);
+
+	std::cout << "sorted range of n keys into an empty map, for n around a new level:\n";
+	int	sizes[] = {31, 32, 33, 34, 2079, 2080, 2081, 133151, 133152, 133153};
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+		std::vector<__NS__::pair<int, int> > v;
+		for (int i = 0; i < sizes[s]; i++)
+			v.push_back(__NS__::make_pair(i * 2, i));
+		BTREE_MAP<int, int>	m2;
+		m2.insert(v.begin(), v.end());
+		printChecked(m2);
+		if (sizes[s] == 2081) {
+			std::cout << "then the odd keys as a sorted range, splitting the full leaves:\n";
+			v.clear();
+			for (int i = 0; i < sizes[s]; i++)
+				v.push_back(__NS__::make_pair(i * 2 + 1, -i));
+			m2.insert(v.begin(), v.end());
+			printChecked(m2);
+			std::cout << "then a range from below the last key to past it, with repeats: [4150, 4200) twice:\n";
+			v.clear();
+			for (int k = 0; k < 2; k++)
+				for (int i = 4150; i < 4200; i++)
+					v.push_back(__NS__::make_pair(i, k));
+			m2.insert(v.begin(), v.end());
+			printChecked(m2);
+			std::cout << "then a descending range past the last key: (4300, 4200]:\n";
+			v.clear();
+			for (int i = 4300; i > 4200; i--)
+				v.push_back(__NS__::make_pair(i, i));
+			m2.insert(v.begin(), v.end());
+			printChecked(m2);
+		}
+	}
+	std::cout << std::endl;
+}
+
+/**
+ * @brief main
+ */
+
+int main(int ac, char **av) {
+	if (ac == 1) {
+		printTitle("Args help");
+
+		std::cout << "- \033[1;36mall\033[0m: launch all test\n"
+			<< "- \033[1;36mconstructTest\033[0m: launch about constructor test\n"
+			<< "- \033[1;36miteratorTest\033[0m: launch about iterator test\n"
+			<< "- \033[1;36memptyTest\033[0m: launch about empty test\n"
+			<< "- \033[1;36msizeTest\033[0m: launch about size/max_size test\n"
+			<< "- \033[1;36melementAccessTest\033[0m: launch about element access test\n"
+			<< "- \033[1;36minsertTest\033[0m: launch about insert test\n"
+			<< "- \033[1;36meraseTest\033[0m: launch about erase test\n"
+			<< "- \033[1;36mswapTest\033[0m: launch about swap test\n"
+			<< "- \033[1;36mclearTest\033[0m: launch about clear test\n"
+			<< "- \033[1;36mkeyCompTest\033[0m: launch about keyComp test\n"
+			<< "- \033[1;36mvalueCompTest\033[0m: launch about valueComp test\n"
+			<< "- \033[1;36mfindTest\033[0m: launch about find test\n"
+			<< "- \033[1;36mcountTest\033[0m: launch about count test\n"
+			<< "- \033[1;36mboundTest\033[0m: launch about bound test\n"
+			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n"
+			<< "- \033[1;36mbtreeTest\033[0m: launch about B+ tree test\n";
+		return 0;
+	}
+
+	Test test[] = {
+		{"constructTest", &MapSuite<BTREE_MAP>::constructTest},
+		{"iteratorTest", &MapSuite<BTREE_MAP>::iteratorTest},
+		{"emptyTest", &MapSuite<BTREE_MAP>::emptyTest},
+		{"sizeTest", &MapSuite<BTREE_MAP>::sizeTest},
+		{"elementAccessTest", &MapSuite<BTREE_MAP>::elementAccessTest},
+		{"insertTest", &MapSuite<BTREE_MAP>::insertTest},
+		{"eraseTest", &MapSuite<BTREE_MAP>::eraseTest},
+		{"swapTest", &MapSuite<BTREE_MAP>::swapTest},
+		{"clearTest", &MapSuite<BTREE_MAP>::clearTest},
+		{"keyCompTest", &MapSuite<BTREE_MAP>::keyCompTest},
+		{"valueCompTest", &MapSuite<BTREE_MAP>::valueCompTest},
+		{"findTest", &MapSuite<BTREE_MAP>::findTest},
+		{"countTest", &MapSuite<BTREE_MAP>::countTest},
+		{"boundTest", &MapSuite<BTREE_MAP>::boundTest},
+		{"equalRangeTest", &MapSuite<BTREE_MAP>::equalRangeTest},
+		{"btreeTest", &btreeTest}};
+
+	if (std::string(av[1]) == "all") {
+		for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++)
+			test[i].fptr();
+		return 0;
+	}
+
+	std::string arg(av[1]);
+	for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++) {
+		if (test[i].testName == arg) {
+			test[i].fptr();
+			return 0;
+		}
+	}
+	return 1;
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_setTest.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 19:12:45 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 19:12:45 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "SetSuite.hpp"
+#include "btree_set.hpp"
+#include <set>
+#include <vector>
+#include <iostream>
+#include <string>
+
+// #define __NS__ std // default namespace
+
+/** @note std has no btree_set: ft::btree_set is diffed against std::set */
+#ifdef __STD__
+# define BTREE_SET std::set
+#else
+# define BTREE_SET ft::btree_set
+#endif
+
+/**
+ * @brief B+ tree test (erase going on with the returned iterator, range insertion around full nodes)
+ * @note a leaf holds 64 int and an internal node 64 int keys (BTREE_NODE_BYTES): appended in order,
+ * the tree gets a new level at 65, 4161 and 266305 elements (the nodes of the right edge split full but one).
+ */
+
+/** @brief every value in order both ways and found by a lookup */
+template < class Set >
+void	printChecked(Set const & s) {
+	size_t	inOrder = 0;
+	size_t	found = 0;
+	size_t	backward = 0;
+
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it) {
+		typename Set::const_iterator next = it;
+		inOrder += ++next == s.end() || *it < *next;
+		found += s.find(*it) == it;
+	}
+	for (typename Set::const_reverse_iterator rit = s.rbegin(); rit != s.rend(); ++rit)
+		++backward;
+	std::cout << "in order: " << inOrder << ", found: " << found << ", backward: " << backward << ", ";
+	printDigest(s);
+}
+
+void	btreeTest(void) {
+	printTitle("B+ tree");
+
+	std::cout << "erase(iterator) of the even values in [0, 5000), the returned iterator holding the next value:\n";
+	BTREE_SET<int> s1;
+	for (int i = 0; i < 5000; i++)
+		s1.insert(i);
+	size_t	wrong = 0;
+	for (BTREE_SET<int>::iterator it = s1.begin(); it != s1.end(); ) {
+		if (*it % 2) {
+			++it;
+			continue;
+		}
+		BTREE_SET<int>::iterator	next = it;
+		int							nextValue = ++next == s1.end() ? -1 : *next;
+
+		it = extEraseAt(s1, it);
+		wrong += it == s1.end() ? nextValue != -1 : *it != nextValue;
+	}
+	std::cout << "wrong: " << wrong << std::endl;
+	printChecked(s1);
+
+	std::cout << "erase(iterator) of the last element returns end(): ";
+	BTREE_SET<int>::iterator last = s1.end();
+	last = extEraseAt(s1, --last);
+	std::cout << (last == s1.end()) << std::endl;
+
+	std::cout << "erase(iterator) of the values in [1000, 1500) from lower_bound(1000), keeping the returned iterator:\n";
+	BTREE_SET<int>::iterator from = s1.lower_bound(1000);
+	while (from != s1.end() && *from < 1500)
+		from = extEraseAt(s1, from);
+	std::cout << "stopped at: " << *from << std::endl;
+	printChecked(s1);
+
+	std::cout << "erase(begin()) until empty, the returned iterator being begin():\n";
+	wrong = 0;
+	for (BTREE_SET<int>::iterator it = s1.begin(); it != s1.end(); ) {
+		it = extEraseAt(s1, it);
+		wrong += it != s1.begin();
+	}
+	std::cout << "wrong: " << wrong << std::endl;
+	printChecked(s1);
+
+	std::cout << "sorted range of n values into an empty set, for n around a new level:\n";
+	int	sizes[] = {63, 64, 65, 66, 4159, 4160, 4161, 266303, 266304, 266305};
+	for (size_t n = 0; n < sizeof(sizes) / sizeof(*sizes); n++) {
+		std::vector<int> v;
+		for (int i = 0; i < sizes[n]; i++)
+			v.push_back(i * 2);
+		BTREE_SET<int>	s2;
+		s2.insert(v.begin(), v.end());
+		printChecked(s2);
+		if (sizes[n] == 4161) {
+			std::cout << "then the odd values as a sorted range, splitting the full leaves:\n";
+			v.clear();
+			for (int i = 0; i < sizes[n]; i++)
+				v.push_back(i * 2 + 1);
+			s2.insert(v.begin(), v.end());
+			printChecked(s2);
+			std::cout << "then a range from below the last value to past it, with repeats: [8300, 8400) twice:\n";
+			v.clear();
+			for (int k = 0; k < 2; k++)
+				for (int i = 8300; i < 8400; i++)
+					v.push_back(i);
+			s2.insert(v.begin(), v.end());
+			printChecked(s2);
+			std::cout << "then a descending range past the last value: (8500, 8400]:\n";
+			v.clear();
+			for (int i = 8500; i > 8400; i--)
+				v.push_back(i);
+			s2.insert(v.begin(), v.end());
+			printChecked(s2);
+		}
+	}
+	std::cout << std::endl;
+}
+
+/**
+ * @brief main
+ */
+
+int main(int ac, char **av) {
+	if (ac == 1) {
+		printTitle("Args help");
+
+		std::cout << "- \033[1;36mall\033[0m: launch all test\n"
+			<< "- \033[1;36mconstructTest\033[0m: launch about constructor test\n"
+			<< "- \033[1;36miteratorTest\033[0m: launch about iterator test\n"
+			<< "- \033[1;36memptyTest\033[0m: launch about empty test\n"
+			<< "- \033[1;36msizeTest\033[0m: launch about size/max_size test\n"
+			<< "- \033[1;36minsertTest\033[0m: launch about insert test\n"
+			<< "- \033[1;36meraseTest\033[0m: launch about erase test\n"
+			<< "- \033[1;36mswapTest\033[0m: launch about swap test\n"
+			<< "- \033[1;36mclearTest\033[0m: launch about clear test\n"
+			<< "- \033[1;36mkeyCompTest\033[0m: launch about keyComp test\n"
+			<< "- \033[1;36mvalueCompTest\033[0m: launch about valueComp test\n"
+			<< "- \033[1;36mfindTest\033[0m: launch about find test\n"
+			<< "- \033[1;36mcountTest\033[0m: launch about count test\n"
+			<< "- \033[1;36mboundTest\033[0m: launch about bound test\n"
+			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n"
+			<< "- \033[1;36mbtreeTest\033[0m: launch about B+ tree test\n";
+		return 0;
+	}
+
+	Test test[] = {
+		{"constructTest", &SetSuite<BTREE_SET>::constructTest},
+		{"iteratorTest", &SetSuite<BTREE_SET>::iteratorTest},
+		{"emptyTest", &SetSuite<BTREE_SET>::emptyTest},
+		{"sizeTest", &SetSuite<BTREE_SET>::sizeTest},
+		{"insertTest", &SetSuite<BTREE_SET>::insertTest},
+		{"eraseTest", &SetSuite<BTREE_SET>::eraseTest},
+		{"swapTest", &SetSuite<BTREE_SET>::swapTest},
+		{"clearTest", &SetSuite<BTREE_SET>::clearTest},
+		{"keyCompTest", &SetSuite<BTREE_SET>::keyCompTest},
+		{"valueCompTest", &SetSuite<BTREE_SET>::valueCompTest},
+		{"findTest", &SetSuite<BTREE_SET>::findTest},
+		{"countTest", &SetSuite<BTREE_SET>::countTest},
+		{"boundTest", &SetSuite<BTREE_SET>::boundTest},
+		{"equalRangeTest", &SetSuite<BTREE_SET>::equalRangeTest},
+		{"btreeTest", &btreeTest}};
+
+	if (std::string(av[1]) == "all") {
+		for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++)
+			test[i].fptr();
+		return 0;
+	}
+
+	std::string arg(av[1]);
+	for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++) {
+		if (test[i].testName == arg) {
+			test[i].fptr();
+			return 0;
+		}
+	}
+	return 1;
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_mapTest.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 18:40:02 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 18:40:02 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "MapSuite.hpp"
+#include "flat_map.hpp"
+#include <map>
+#include <vector>
+#include <iostream>
+#include <string>
+
+// #define __NS__ std // default namespace
+
+/** @note std has no flat_map: ft::flat_map is diffed against std::map */
+#ifdef __STD__
+# define FLAT_MAP std::map
+#else
+# define FLAT_MAP ft::flat_map
+#endif
+
+/**
+ * @brief flat extensions test (keys / values / reserve, the two paths of a range insertion, the proxies)
+ */
+
+/** @brief the arrays of the map against its elements: same size, same order */
+template < class Map, class Keys, class Values >
+void	printArrays(Map const & m, Keys const & keys, Values const & values) {
+	bool	aligned = keys.size() == m.size() && values.size() == m.size();
+	size_t	i = 0;
+
+	for (typename Map::const_iterator it = m.begin(); aligned && it != m.end(); ++it, ++i)
+		aligned = keys[i] == it->first && values[i] == it->second && (i == 0 || keys[i - 1] < keys[i]);
+	std::cout << "keys: " << keys.size() << ", values: " << values.size() << ", aligned: " << aligned << std::endl;
+}
+
+void	flatTest(void) {
+	printTitle("flat extensions");
+
+	std::cout << "keys() / values() along 3000 random insertions, erase, operator[] and a range:\n";
+	FLAT_MAP<int, int>	m1;
+	unsigned long		seed = 11;
+	for (int i = 0; i < 3000; i++)
+		m1.insert(__NS__::make_pair(nextRand(seed) % 5000, i));
+	printArrays(m1, extKeys(m1), extValues(m1));
+	m1.erase(m1.lower_bound(1000), m1.lower_bound(2000));
+	for (int k = 0; k < 5000; k += 7)
+		m1.erase(k);
+	printArrays(m1, extKeys(m1), extValues(m1));
+	for (int k = 1000; k < 2000; k += 3)
+		m1[k] = -k;
+	std::vector<__NS__::pair<int, int> >	batch;
+	for (int i = 0; i < 500; i++)
+		batch.push_back(__NS__::make_pair(nextRand(seed) % 6000, -i));
+	m1.insert(batch.begin(), batch.end());
+	printArrays(m1, extKeys(m1), extValues(m1));
+	printDigest(m1);
+
+	std::cout << "reserve(1000), then 999 keys appended after the first one, by hint and by a sorted range:\n";
+	FLAT_MAP<int, int>	m2;
+	extReserve(m2, 1000);
+	m2[0] = 0;
+	const int	*firstKey = &m2.begin()->first;
+	int			*firstValue = &m2.begin()->second;
+	for (int i = 1; i < 500; i++)
+		m2.insert(m2.end(), __NS__::make_pair(i, i * 2));
+	batch.clear();
+	for (int i = 999; i >= 500; i--)
+		batch.push_back(__NS__::make_pair(i, i * 2));
+	m2.insert(batch.begin(), batch.end());
+	printDigest(m2);
+	std::cout << "the first element did not move: " << (firstKey == &m2.begin()->first) << ", " << (firstValue == &m2.begin()->second) << std::endl;
+	printArrays(m2, extKeys(m2), extValues(m2));
+
+	std::cout << "range insertion after every key (appended), with repeats: + (15, 1) (12, 2) (15, 3) (11, 4) (19, 5) (12, 6):\n";
+	FLAT_MAP<int, int>	m3;
+	for (int i = 0; i < 10; i++)
+		m3[i] = i;
+	int	after[][2] = {{15, 1}, {12, 2}, {15, 3}, {11, 4}, {19, 5}, {12, 6}};
+	batch.clear();
+	for (size_t i = 0; i < sizeof(after) / sizeof(*after); i++)
+		batch.push_back(__NS__::make_pair(after[i][0], after[i][1]));
+	m3.insert(batch.begin(), batch.end());
+	printContent(m3);
+
+	std::cout << "range starting at the last key (merged): + (19, 7) (25, 8) (20, 9):\n";
+	int	last[][2] = {{19, 7}, {25, 8}, {20, 9}};
+	batch.clear();
+	for (size_t i = 0; i < sizeof(last) / sizeof(*last); i++)
+		batch.push_back(__NS__::make_pair(last[i][0], last[i][1]));
+	m3.insert(batch.begin(), batch.end());
+	printContent(m3);
+
+	std::cout << "range between the keys (merged), with keys present and repeats: + (3, 10) (13, 11) (-1, 12) (13, 13) (30, 14) (-1, 15):\n";
+	int	between[][2] = {{3, 10}, {13, 11}, {-1, 12}, {13, 13}, {30, 14}, {-1, 15}};
+	batch.clear();
+	for (size_t i = 0; i < sizeof(between) / sizeof(*between); i++)
+		batch.push_back(__NS__::make_pair(between[i][0], between[i][1]));
+	m3.insert(batch.begin(), batch.end());
+	printContent(m3);
+	printArrays(m3, extKeys(m3), extValues(m3));
+
+	std::cout << "empty range, then a range into an empty map:\n";
+	m3.insert(batch.begin(), batch.begin());
+	FLAT_MAP<int, int>	m4;
+	m4.insert(batch.begin(), batch.end());
+	printContent(m4);
+
+	std::cout << "compare elements: (1, 10) (2, 20) (3, 10), and (1, 11) in another map:\n";
+	FLAT_MAP<int, int>	m5;
+	m5[1] = 10;
+	m5[2] = 20;
+	m5[3] = 10;
+	FLAT_MAP<int, int>	m6;
+	m6[1] = 11;
+	FLAT_MAP<int, int>::iterator	one = m5.find(1);
+	FLAT_MAP<int, int>::iterator	two = m5.find(2);
+	FLAT_MAP<int, int>::iterator	other = m6.find(1);
+	std::cout << "(1, 10) == (1, 10): " << (*one == *m5.begin()) << ", (1, 10) == (2, 20): " << (*one == *two)
+		<< ", (1, 10) != (2, 20): " << (*one != *two) << ", (1, 10) != (1, 10): " << (*one != *m5.begin()) << std::endl;
+	std::cout << "(1, 10) < (2, 20): " << (*one < *two) << ", (2, 20) < (1, 10): " << (*two < *one)
+		<< ", (1, 10) < (1, 11): " << (*one < *other) << ", (1, 11) < (1, 10): " << (*other < *one)
+		<< ", (1, 10) < (1, 10): " << (*one < *one) << std::endl;
+	FLAT_MAP<int, int> const &		cm5 = m5;
+	FLAT_MAP<int, int>::const_iterator	cthree = cm5.find(3);
+	std::cout << "const: (3, 10) == (3, 10): " << (*cthree == *cm5.rbegin()) << ", (1, 10) < (3, 10): " << (*cm5.begin() < *cthree) << std::endl;
+	__NS__::pair<const int, int>	copy = *two;
+	two->second = 21;
+	std::cout << "copy of (2, 20), then the element set to 21: " << copy.first << ", " << copy.second << " / " << two->second << std::endl;
+
+	std::cout << "operator-> through reverse_iterator: every mapped value += its key, from the end:\n";
+	for (FLAT_MAP<int, int>::reverse_iterator rit = m5.rbegin(); rit != m5.rend(); ++rit)
+		rit->second += rit->first;
+	for (FLAT_MAP<int, int>::const_reverse_iterator crit = cm5.rbegin(); crit != cm5.rend(); ++crit)
+		std::cout << crit->first << ": " << crit->second << std::endl;
+	FLAT_MAP<int, int>::reverse_iterator	rit = m5.rbegin();
+	++rit;
+	std::cout << "second from the end: " << rit->first << ", " << (*rit).second << ", base: " << rit.base()->first << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief main
+ */
+
+int main(int ac, char **av) {
+	if (ac == 1) {
+		printTitle("Args help");
+
+		std::cout << "- \033[1;36mall\033[0m: launch all test\n"
+			<< "- \033[1;36mconstructTest\033[0m: launch about constructor test\n"
+			<< "- \033[1;36miteratorTest\033[0m: launch about iterator test\n"
+			<< "- \033[1;36memptyTest\033[0m: launch about empty test\n"
+			<< "- \033[1;36msizeTest\033[0m: launch about size/max_size test\n"
+			<< "- \033[1;36melementAccessTest\033[0m: launch about element access test\n"
+			<< "- \033[1;36minsertTest\033[0m: launch about insert test\n"
+			<< "- \033[1;36meraseTest\033[0m: launch about erase test\n"
+			<< "- \033[1;36mswapTest\033[0m: launch about swap test\n"
+			<< "- \033[1;36mclearTest\033[0m: launch about clear test\n"
+			<< "- \033[1;36mkeyCompTest\033[0m: launch about keyComp test\n"
+			<< "- \033[1;36mvalueCompTest\033[0m: launch about valueComp test\n"
+			<< "- \033[1;36mfindTest\033[0m: launch about find test\n"
+			<< "- \033[1;36mcountTest\033[0m: launch about count test\n"
+			<< "- \033[1;36mboundTest\033[0m: launch about bound test\n"
+			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n"
+			<< "- \033[1;36mflatTest\033[0m: launch about flat extensions test\n";
+		return 0;
+	}
+
+	Test test[] = {
+		{"constructTest", &MapSuite<FLAT_MAP>::constructTest},
+		{"iteratorTest", &MapSuite<FLAT_MAP>::iteratorTest},
+		{"emptyTest", &MapSuite<FLAT_MAP>::emptyTest},
+		{"sizeTest", &MapSuite<FLAT_MAP>::sizeTest},
+		{"elementAccessTest", &MapSuite<FLAT_MAP>::elementAccessTest},
+		{"insertTest", &MapSuite<FLAT_MAP>::insertTest},
+		{"eraseTest", &MapSuite<FLAT_MAP>::eraseTest},
+		{"swapTest", &MapSuite<FLAT_MAP>::swapTest},
+		{"clearTest", &MapSuite<FLAT_MAP>::clearTest},
+		{"keyCompTest", &MapSuite<FLAT_MAP>::keyCompTest},
+		{"valueCompTest", &MapSuite<FLAT_MAP>::valueCompTest},
+		{"findTest", &MapSuite<FLAT_MAP>::findTest},
+		{"countTest", &MapSuite<FLAT_MAP>::countTest},
+		{"boundTest", &MapSuite<FLAT_MAP>::boundTest},
+		{"equalRangeTest", &MapSuite<FLAT_MAP>::equalRangeTest},
+		{"flatTest", &flatTest}};
+
+	if (std::string(av[1]) == "all") {
+		for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++)
+			test[i].fptr();
+		return 0;
+	}
+
+	std::string arg(av[1]);
+	for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++) {
+		if (test[i].testName == arg) {
+			test[i].fptr();
+			return 0;
+		}
+	}
+	return 1;
+}
\ No newline at end of file
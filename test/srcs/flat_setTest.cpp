@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_setTest.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 19:12:45 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 19:12:45 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "SetSuite.hpp"
+#include "flat_set.hpp"
+#include <set>
+#include <vector>
+#include <iostream>
+#include <string>
+
+// #define __NS__ std // default namespace
+
+/** @note std has no flat_set: ft::flat_set is diffed against std::set */
+#ifdef __STD__
+# define FLAT_SET std::set
+#else
+# define FLAT_SET ft::flat_set
+#endif
+
+/**
+ * @brief flat extensions test (values / reserve, the two paths of a range insertion)
+ */
+
+/** @brief the array of the set against its elements: same size, same order */
+template < class Set, class Values >
+void	printArray(Set const & s, Values const & values) {
+	bool	aligned = values.size() == s.size();
+	size_t	i = 0;
+
+	for (typename Set::const_iterator it = s.begin(); aligned && it != s.end(); ++it, ++i)
+		aligned = values[i] == *it && (i == 0 || values[i - 1] < values[i]);
+	std::cout << "values: " << values.size() << ", aligned: " << aligned << std::endl;
+}
+
+void	flatTest(void) {
+	printTitle("flat extensions");
+
+	std::cout << "values() along 3000 random insertions, erase and a range:\n";
+	FLAT_SET<int>	s1;
+	unsigned long	seed = 11;
+	for (int i = 0; i < 3000; i++)
+		s1.insert(nextRand(seed) % 5000);
+	printArray(s1, extValues(s1));
+	s1.erase(s1.lower_bound(1000), s1.lower_bound(2000));
+	for (int v = 0; v < 5000; v += 7)
+		s1.erase(v);
+	printArray(s1, extValues(s1));
+	std::vector<int>	batch;
+	for (int i = 0; i < 500; i++)
+		batch.push_back(nextRand(seed) % 6000);
+	s1.insert(batch.begin(), batch.end());
+	printArray(s1, extValues(s1));
+	printDigest(s1);
+
+	std::cout << "reserve(1000), then 999 values appended after the first one, by hint and by a sorted range:\n";
+	FLAT_SET<int>	s2;
+	extReserve(s2, 1000);
+	s2.insert(0);
+	const int	*first = &*s2.begin();
+	for (int i = 1; i < 500; i++)
+		s2.insert(s2.end(), i);
+	batch.clear();
+	for (int i = 999; i >= 500; i--)
+		batch.push_back(i);
+	s2.insert(batch.begin(), batch.end());
+	printDigest(s2);
+	std::cout << "the first element did not move: " << (first == &*s2.begin()) << std::endl;
+
+	std::cout << "range insertion after every value (appended), with repeats: + 15 12 15 11 19 12:\n";
+	FLAT_SET<int>	s3;
+	for (int i = 0; i < 10; i++)
+		s3.insert(i);
+	int	after[] = {15, 12, 15, 11, 19, 12};
+	s3.insert(after, after + sizeof(after) / sizeof(*after));
+	printContent(s3);
+
+	std::cout << "range starting at the last value (merged): + 19 25 20:\n";
+	int	last[] = {19, 25, 20};
+	s3.insert(last, last + sizeof(last) / sizeof(*last));
+	printContent(s3);
+
+	std::cout << "range between the values (merged), with values present and repeats: + 3 13 -1 13 30 -1:\n";
+	int	between[] = {3, 13, -1, 13, 30, -1};
+	s3.insert(between, between + sizeof(between) / sizeof(*between));
+	printContent(s3);
+	printArray(s3, extValues(s3));
+
+	std::cout << "empty range, then a range into an empty set:\n";
+	s3.insert(between, between);
+	FLAT_SET<int>	s4;
+	s4.insert(between, between + sizeof(between) / sizeof(*between));
+	printContent(s4);
+	std::cout << std::endl;
+}
+
+/**
+ * @brief main
+ */
+
+int main(int ac, char **av) {
+	if (ac == 1) {
+		printTitle("Args help");
+
+		std::cout << "- \033[1;36mall\033[0m: launch all test\n"
+			<< "- \033[1;36mconstructTest\033[0m: launch about constructor test\n"
+			<< "- \033[1;36miteratorTest\033[0m: launch about iterator test\n"
+			<< "- \033[1;36memptyTest\033[0m: launch about empty test\n"
+			<< "- \033[1;36msizeTest\033[0m: launch about size/max_size test\n"
+			<< "- \033[1;36minsertTest\033[0m: launch about insert test\n"
+			<< "- \033[1;36meraseTest\033[0m: launch about erase test\n"
+			<< "- \033[1;36mswapTest\033[0m: launch about swap test\n"
+			<< "- \033[1;36mclearTest\033[0m: launch about clear test\n"
+			<< "- \033[1;36mkeyCompTest\033[0m: launch about keyComp test\n"
+			<< "- \033[1;36mvalueCompTest\033[0m: launch about valueComp test\n"
+			<< "- \033[1;36mfindTest\033[0m: launch about find test\n"
+			<< "- \033[1;36mcountTest\033[0m: launch about count test\n"
+			<< "- \033[1;36mboundTest\033[0m: launch about bound test\n"
+			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n"
+			<< "- \033[1;36mflatTest\033[0m: launch about flat extensions test\n";
+		return 0;
+	}
+
+	Test test[] = {
+		{"constructTest", &SetSuite<FLAT_SET>::constructTest},
+		{"iteratorTest", &SetSuite<FLAT_SET>::iteratorTest},
+		{"emptyTest", &SetSuite<FLAT_SET>::emptyTest},
+		{"sizeTest", &SetSuite<FLAT_SET>::sizeTest},
+		{"insertTest", &SetSuite<FLAT_SET>::insertTest},
+		{"eraseTest", &SetSuite<FLAT_SET>::eraseTest},
+		{"swapTest", &SetSuite<FLAT_SET>::swapTest},
+		{"clearTest", &SetSuite<FLAT_SET>::clearTest},
+		{"keyCompTest", &SetSuite<FLAT_SET>::keyCompTest},
+		{"valueCompTest", &SetSuite<FLAT_SET>::valueCompTest},
+		{"findTest", &SetSuite<FLAT_SET>::findTest},
+		{"countTest", &SetSuite<FLAT_SET>::countTest},
+		{"boundTest", &SetSuite<FLAT_SET>::boundTest},
+		{"equalRangeTest", &SetSuite<FLAT_SET>::equalRangeTest},
+		{"flatTest", &flatTest}};
+
+	if (std::string(av[1]) == "all") {
+		for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++)
+			test[i].fptr();
+		return 0;
+	}
+
+	std::string arg(av[1]);
+	for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++) {
+		if (test[i].testName == arg) {
+			test[i].fptr();
+			return 0;
+		}
+	}
+	return 1;
+}
\ No newline at end of file
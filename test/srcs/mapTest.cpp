@@ -11,8 +11,11 @@
 /* ************************************************************************** */
 
 #include "Custom.hpp"
+#include "Extension.hpp"
 #include "map.hpp"
 #include <map>
+#include <vector>
+#include <iterator>
 #include <iostream>
 #include <string>
 
@@ -35,15 +38,23 @@ void	printTitle(std::string const & title) {
 
 template < class Key, class T >
 void	printSize(__NS__::map<Key, T> m) {
+	__NS__::map<Key, T>	copy(m);
+
 	std::cout << "size: " << m.size() << std::endl;
-	std::cout << "maxSize: " << m.max_size() << std::endl;
+	// the node layout is implementation defined: only what max_size promises is compared
+	std::cout << "maxSize > 0: " << (m.max_size() > 0) << ", >= size: " << (m.max_size() >= m.size())
+		<< ", same for a copy: " << (copy.max_size() == m.max_size()) << std::endl;
 	std::cout << std::endl;
 }
 
 template < class Key, class T, class Compare >
 void	printSize(__NS__::map<Key, T, Compare> m) {
+	__NS__::map<Key, T, Compare>	copy(m);
+
 	std::cout << "size: " << m.size() << std::endl;
-	std::cout << "maxSize: " << m.max_size() << std::endl;
+	// the node layout is implementation defined: only what max_size promises is compared
+	std::cout << "maxSize > 0: " << (m.max_size() > 0) << ", >= size: " << (m.max_size() >= m.size())
+		<< ", same for a copy: " << (copy.max_size() == m.max_size()) << std::endl;
 	std::cout << std::endl;
 }
 
@@ -711,6 +722,883 @@ void	equalRangeTest(void) {
 	std::cout << ret.second->first << " => " << ret.second->second << '\n';
 }
 
+/**
+ * @brief utils of the tests on many elements
+ */
+
+template < class Map >
+void	printContent(Map const & m) {
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		std::cout << it->first << " => " << it->second << '\n';
+	std::cout << "size: " << m.size() << "\n\n";
+}
+
+/** @brief size, sum of the keys and of the values, first and last: enough to diff big maps */
+template < class Map >
+void	printDigest(Map const & m) {
+	long			keys = 0;
+	long			values = 0;
+	std::size_t		n = 0;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it, ++n) {
+		keys += it->first;
+		values += it->second;
+	}
+	std::cout << "size: " << m.size() << ", iterated: " << n << ", keys: " << keys << ", values: " << values;
+	if (m.empty() == false)
+		std::cout << ", first: " << m.begin()->first << ", last: " << (--m.end())->first;
+	std::cout << std::endl;
+}
+
+/** @brief deterministic pseudo random numbers (LCG) */
+int	nextRand(unsigned long & seed) {
+	seed = seed * 1103515245UL + 12345UL;
+	return static_cast<int>((seed >> 8) % 100000);
+}
+
+/**
+ * @brief hint insert test
+ */
+
+void	hintInsertTest(void) {
+	printTitle("hint insert");
+
+	typedef __NS__::map<int, int>	int_map;
+
+	std::cout << "ascending keys, hint end():\n";
+	int_map m1;
+	for (int i = 0; i < 2000; i++)
+		m1.insert(m1.end(), __NS__::make_pair(i, i));
+	printDigest(m1);
+
+	std::cout << "descending keys, hint begin():\n";
+	int_map m2;
+	for (int i = 2000; i > 0; i--)
+		m2.insert(m2.begin(), __NS__::make_pair(i, -i));
+	printDigest(m2);
+
+	std::cout << "hint at the element after the key, and right before it:\n";
+	int_map m3;
+	for (int i = 0; i < 100; i += 10)
+		m3[i] = i;
+	int_map::iterator it = m3.insert(m3.find(50), __NS__::make_pair(45, 45));
+	std::cout << it->first << " => " << it->second << '\n';
+	it = m3.insert(m3.find(40), __NS__::make_pair(41, 41));
+	std::cout << it->first << " => " << it->second << '\n';
+
+	std::cout << "wrong hints (far from the key):\n";
+	it = m3.insert(m3.begin(), __NS__::make_pair(95, 95));
+	std::cout << it->first << " => " << it->second << '\n';
+	it = m3.insert(m3.end(), __NS__::make_pair(-5, -5));
+	std::cout << it->first << " => " << it->second << '\n';
+
+	std::cout << "key already in the map, with the right and a wrong hint:\n";
+	it = m3.insert(m3.find(30), __NS__::make_pair(30, 300));
+	std::cout << it->first << " => " << it->second << '\n';
+	it = m3.insert(m3.begin(), __NS__::make_pair(90, 900));
+	std::cout << it->first << " => " << it->second << '\n';
+	printContent(m3);
+
+	std::cout << "random keys, hint lower_bound(key):\n";
+	int_map			m4;
+	unsigned long	seed = 11;
+	for (int i = 0; i < 5000; i++) {
+		int k = nextRand(seed) % 3000;
+		m4.insert(m4.lower_bound(k), __NS__::make_pair(k, i));
+	}
+	printDigest(m4);
+	std::cout << std::endl;
+}
+
+/**
+ * @brief sorted range test
+ */
+
+void	sortedRangeTest(void) {
+	printTitle("sorted range");
+
+	typedef __NS__::map<int, int>	int_map;
+
+	std::cout << "sorted range with duplicates, the first of equal keys is kept:\n";
+	std::vector<__NS__::pair<int, int> > v;
+	for (int i = 0; i < 3000; i++)
+		v.push_back(__NS__::make_pair(i / 3, i));
+	int_map m1(v.begin(), v.end());
+	printDigest(m1);
+	std::cout << "m1[10]: " << m1[10] << '\n';
+
+	std::cout << "reverse sorted range:\n";
+	int_map m2(v.rbegin(), v.rend());
+	printDigest(m2);
+	std::cout << "m2[10]: " << m2[10] << '\n';
+
+	std::cout << "unsorted range:\n";
+	std::vector<__NS__::pair<int, int> >	u;
+	unsigned long							seed = 5;
+	for (int i = 0; i < 3000; i++)
+		u.push_back(__NS__::make_pair(nextRand(seed) % 1000, i));
+	int_map m3(u.begin(), u.end());
+	printDigest(m3);
+
+	std::cout << "sorted range from another map, then insert(range) into a non empty map:\n";
+	int_map m4(m1.begin(), m1.find(500));
+	printDigest(m4);
+	m4.insert(m3.begin(), m3.end());
+	printDigest(m4);
+
+	std::cout << "empty range, one element:\n";
+	int_map m5(v.begin(), v.begin());
+	printDigest(m5);
+	int_map m6(v.begin(), v.begin() + 1);
+	printDigest(m6);
+	std::cout << "the built tree keeps working: erase the even keys of m1, insert [3000, 3100):\n";
+	for (int i = 0; i < 1000; i += 2)
+		m1.erase(i);
+	for (int i = 3000; i < 3100; i++)
+		m1.insert(__NS__::make_pair(i, i));
+	printDigest(m1);
+	std::cout << std::endl;
+}
+
+/**
+ * @brief transparent lookup test
+ */
+
+void	transparentTest(void) {
+	printTitle("transparent lookup");
+
+	typedef __NS__::map<std::string, int, EXT_TRANSPARENT_LESS(std::string)>	str_map;
+
+	str_map m1;
+	m1["apple"] = 1;
+	m1["banana"] = 2;
+	m1["cherry"] = 3;
+	m1["date"] = 4;
+	m1["elder"] = 5;
+
+	const char	*key = "cherry";
+	const char	*missing = "coconut";
+
+	std::cout << "find(cherry): " << m1.find(key)->second << '\n';
+	std::cout << "find(coconut) == end: " << (m1.find(missing) == m1.end()) << '\n';
+	std::cout << "count(banana): " << m1.count("banana") << ", count(coconut): " << m1.count(missing) << '\n';
+	std::cout << "lower_bound(coconut): " << m1.lower_bound(missing)->first << '\n';
+	std::cout << "upper_bound(cherry): " << m1.upper_bound(key)->first << '\n';
+
+	__NS__::pair<str_map::iterator, str_map::iterator> ret = m1.equal_range(key);
+	std::cout << "equal_range(cherry): " << ret.first->first << " .. " << ret.second->first << '\n';
+
+	const str_map & cm1 = m1;
+	std::cout << "const find(date): " << cm1.find("date")->second << '\n';
+
+	std::cout << "erase(banana): " << m1.erase("banana") << ", erase(coconut): " << m1.erase(missing) << '\n';
+	printContent(m1);
+}
+
+/**
+ * @brief set operations test
+ */
+
+void	setOpsTest(void) {
+	printTitle("set operations");
+
+	typedef __NS__::map<int, int>	int_map;
+
+	int_map evens;
+	int_map threes;
+	int_map few;
+	for (int i = 0; i < 3000; i += 2)
+		evens[i] = i;
+	for (int i = 0; i < 4500; i += 3)
+		threes[i] = -i;
+	few[6] = 6;
+	few[7] = 7;
+	few[2999] = 2999;
+	few[5000] = 5000;
+
+	std::cout << "union (big with big), other keeps the common keys:\n";
+	int_map	a(evens);
+	int_map	b(threes);
+	extSetUnion(a, b);
+	printDigest(a);
+	printDigest(b);
+
+	std::cout << "union (big with small), (small with big):\n";
+	int_map	c(evens);
+	int_map	d(few);
+	extSetUnion(c, d);
+	printDigest(c);
+	printDigest(d);
+	int_map	e(few);
+	int_map	f(threes);
+	extSetUnion(e, f);
+	printDigest(e);
+	printDigest(f);
+
+	std::cout << "intersection:\n";
+	int_map g(evens);
+	extSetIntersection(g, threes);
+	printDigest(g);
+	int_map h(evens);
+	extSetIntersection(h, few);
+	printContent(h);
+	int_map i(few);
+	extSetIntersection(i, threes);
+	printContent(i);
+
+	std::cout << "difference:\n";
+	int_map j(evens);
+	extSetDifference(j, threes);
+	printDigest(j);
+	int_map k(threes);
+	extSetDifference(k, few);
+	printDigest(k);
+	int_map l(few);
+	extSetDifference(l, evens);
+	printContent(l);
+
+	std::cout << "with an empty map, and with itself (a copy):\n";
+	int_map empty;
+	int_map m(evens);
+	extSetUnion(m, empty);
+	extSetIntersection(m, int_map(evens));
+	printDigest(m);
+	extSetDifference(m, int_map(m));
+	printDigest(m);
+	extSetIntersection(empty, evens);
+	printDigest(empty);
+
+	std::cout << "the trees keep working: + [0, 100) to g, - the odd keys of j:\n";
+	for (int x = 0; x < 100; x++)
+		g.insert(__NS__::make_pair(x, x));
+	for (int x = 1; x < 3000; x += 2)
+		j.erase(x);
+	printDigest(g);
+	printDigest(j);
+	std::cout << std::endl;
+}
+
+/**
+ * @brief order statistics test (extension, walked for std)
+ */
+
+template < class Map >
+void	orderStatRun(void) {
+	Map				m;
+	unsigned long	seed = 17;
+	for (int i = 0; i < 3000; i++)
+		m.insert(__NS__::make_pair(nextRand(seed) % 5000, i));
+	printDigest(m);
+
+	std::cout << "nth(0), nth(size / 2), nth(size - 1), nth(size) == end:\n";
+	std::cout << extNth(m, 0)->first << ", " << extNth(m, m.size() / 2)->first << ", " << extNth(m, m.size() - 1)->first
+		<< ", " << (extNth(m, m.size()) == m.end()) << '\n';
+
+	std::cout << "rank of some keys (in the map or not):\n";
+	for (int k = -1; k < 5100; k += 850)
+		std::cout << k << ": " << extRank(m, k) << '\n';
+
+	std::cout << "count_range:\n";
+	std::cout << "[0, 5000): " << extCountRange(m, 0, 5000) << ", [1000, 2000): " << extCountRange(m, 1000, 2000)
+		<< ", [2000, 1000): " << extCountRange(m, 2000, 1000) << ", [7, 7): " << extCountRange(m, 7, 7) << '\n';
+
+	std::cout << "nth(rank(k)) is lower_bound(k):\n";
+	bool	ok = true;
+	for (int k = 0; k < 5000; k += 7) {
+		typename Map::size_type r = extRank(m, k);
+		if (r < m.size() && extNth(m, r)->first != m.lower_bound(k)->first)
+			ok = false;
+	}
+	std::cout << ok << '\n';
+
+	std::cout << "erase [1000, 3000), then nth / rank again:\n";
+	m.erase(m.lower_bound(1000), m.lower_bound(3000));
+	printDigest(m);
+	std::cout << extNth(m, m.size() / 2)->first << ", " << extRank(m, 2500) << ", " << extCountRange(m, 500, 3500) << '\n';
+}
+
+void	orderStatTest(void) {
+	printTitle("order statistics");
+
+	std::cout << "RBT_SizedNodeBase:\n";
+	orderStatRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_SizedNodeBase)>::type>();
+	std::cout << "RBT_WeightBalanced:\n";
+	orderStatRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_WeightBalanced)>::type>();
+	std::cout << "RBT_AVL with RBT_SizedNodeBase:\n";
+	orderStatRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_AVL), EXT_POLICY(RBT_SizedNodeBase)>::type>();
+	std::cout << "RBT_Splay with RBT_SizedNodeBase:\n";
+	orderStatRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_Splay), EXT_POLICY(RBT_SizedNodeBase)>::type>();
+	std::cout << std::endl;
+}
+
+/**
+ * @brief aggregate test (extension, folded for std)
+ */
+
+/** @brief sum of the mapped values */
+struct SumPolicy {
+	typedef long	summary_type;
+
+	static long	identity(void) { return 0; }
+
+	template < class V >
+	static long	summarize(V const & val) { return val.second; }
+
+	static long	combine(long a, long b) { return a + b; }
+};
+
+/** @brief the mapped values in key order (not commutative) */
+struct ConcatPolicy {
+	typedef std::string	summary_type;
+
+	static std::string	identity(void) { return std::string(); }
+
+	template < class V >
+	static std::string	summarize(V const & val) { return std::string(1, val.second); }
+
+	static std::string	combine(std::string const & a, std::string const & b) { return a + b; }
+};
+
+void	aggregateTest(void) {
+	printTitle("aggregate");
+
+	typedef ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >,
+		EXT_POLICY(RBT_RedBlack), ext_augment<SumPolicy>::type>::type		sum_map;
+	typedef ext_basic_map<int, char, __NS__::less<int>, std::allocator<__NS__::pair<const int, char> >,
+		EXT_POLICY(RBT_RedBlack), ext_augment<ConcatPolicy>::type>::type	str_map;
+
+	std::cout << "sums: + (i, i % 100) for 2000 random i:\n";
+	sum_map			m1;
+	unsigned long	seed = 23;
+	for (int i = 0; i < 2000; i++) {
+		int k = nextRand(seed) % 10000;
+		m1.insert(__NS__::make_pair(k, k % 100));
+	}
+	std::cout << "summary: " << extSummary<SumPolicy>(m1) << '\n';
+	for (int lo = -100; lo < 10000; lo += 1700)
+		std::cout << "aggregate(" << lo << ", " << lo + 2500 << "): " << extAggregate<SumPolicy>(m1, lo, lo + 2500) << '\n';
+	std::cout << "aggregate(500, 500): " << extAggregate<SumPolicy>(m1, 500, 500) << ", aggregate(900, 100): " << extAggregate<SumPolicy>(m1, 900, 100) << '\n';
+
+	std::cout << "erase [2000, 4000), erase some keys, insert others:\n";
+	m1.erase(m1.lower_bound(2000), m1.lower_bound(4000));
+	for (int k = 0; k < 10000; k += 97)
+		m1.erase(k);
+	for (int k = 2000; k < 4000; k += 10)
+		m1.insert(__NS__::make_pair(k, 1));
+	std::cout << "summary: " << extSummary<SumPolicy>(m1) << ", aggregate(1000, 5000): " << extAggregate<SumPolicy>(m1, 1000, 5000) << '\n';
+
+	std::cout << "set every mapped value to 2 in place, refresh:\n";
+	for (sum_map::iterator it = m1.begin(); it != m1.end(); ++it) {
+		it->second = 2;
+		extRefresh(m1, it);
+	}
+	std::cout << "summary: " << extSummary<SumPolicy>(m1) << ", size * 2: " << m1.size() * 2 << '\n';
+
+	std::cout << "copy, swap, assign keep the summaries:\n";
+	sum_map m2(m1);
+	sum_map m3;
+	m3.swap(m2);
+	m2 = m3;
+	std::cout << extSummary<SumPolicy>(m2) << ", " << extSummary<SumPolicy>(m3) << ", " << extAggregate<SumPolicy>(m3, 0, 5000) << '\n';
+
+	typedef ext_arena_allocator<__NS__::pair<const int, int> >	arena_alloc;
+	typedef ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >,
+		EXT_POLICY(RBT_AVL), ext_augment<SumPolicy>::type>::type		avl_sum_map;
+	typedef ext_basic_map<int, int, __NS__::less<int>, arena_alloc::type,
+		EXT_POLICY(RBT_Splay), ext_augment<SumPolicy>::type>::type		splay_sum_map;
+
+	std::cout << "the same sums on an AVL tree, and on a splay tree in an arena:\n";
+	ExtArena		arena;
+	avl_sum_map		m5(m1.begin(), m1.end());
+	splay_sum_map	m6((__NS__::less<int>()), arena_alloc::make(arena));
+	for (sum_map::iterator it = m1.begin(); it != m1.end(); ++it)
+		m6.insert(*it);
+	for (int k = 0; k < 10000; k += 31) {
+		m5.erase(k);
+		m6.erase(k);
+		m6.find(k + 1);
+	}
+	std::cout << extSummary<SumPolicy>(m5) << ", " << extSummary<SumPolicy>(m6) << '\n';
+	for (int lo = 0; lo < 10000; lo += 2600)
+		std::cout << "aggregate(" << lo << ", " << lo + 3000 << "): " << extAggregate<SumPolicy>(m5, lo, lo + 3000)
+			<< ", " << extAggregate<SumPolicy>(m6, lo, lo + 3000) << '\n';
+
+	std::cout << "concatenation (in key order): + (i, 'a' + i) for i in [0, 26), shuffled:\n";
+	str_map m4;
+	for (int i = 0; i < 26; i++)
+		m4.insert(__NS__::make_pair(i * 7 % 26, static_cast<char>('a' + i * 7 % 26)));
+	std::cout << "summary: " << extSummary<ConcatPolicy>(m4) << '\n';
+	std::cout << "aggregate(3, 11): " << extAggregate<ConcatPolicy>(m4, 3, 11) << '\n';
+	std::cout << "aggregate(20, 100): " << extAggregate<ConcatPolicy>(m4, 20, 100) << '\n';
+	m4.erase(4);
+	m4.erase(5);
+	std::cout << "erase 4, 5, aggregate(0, 10): " << extAggregate<ConcatPolicy>(m4, 0, 10) << '\n';
+	std::cout << std::endl;
+}
+
+/**
+ * @brief interval_map test (extension, searched one by one for std)
+ */
+
+void	intervalMapTest(void) {
+	printTitle("interval_map");
+
+	typedef ext_interval_map<int, int>::type	interval_map;
+
+	interval_map	im;
+	unsigned long	seed = 31;
+	for (int i = 0; i < 1000; i++) {
+		int start = nextRand(seed) % 10000;
+		int len = 1 + nextRand(seed) % (i % 10 == 0 ? 2000 : 50);
+		im.insert(__NS__::make_pair(__NS__::make_pair(start, start + len), i));
+	}
+	std::cout << "size: " << im.size() << '\n';
+
+	std::cout << "find_overlap:\n";
+	for (int lo = -500; lo < 10500; lo += 1500) {
+		interval_map::iterator it = im.find_overlap(lo, lo + 10);
+		if (it == im.end())
+			std::cout << "[" << lo << ", " << lo + 10 << "): none\n";
+		else
+			std::cout << "[" << lo << ", " << lo + 10 << "): [" << it->first.first << ", " << it->first.second << ") => " << it->second << '\n';
+	}
+
+	std::cout << "find_overlaps / count_overlaps:\n";
+	for (int lo = 0; lo < 10000; lo += 2300) {
+		std::vector<interval_map::iterator> found;
+		im.find_overlaps(lo, lo + 100, std::back_inserter(found));
+		long sum = 0;
+		for (std::size_t n = 0; n < found.size(); n++)
+			sum += found[n]->second;
+		std::cout << "[" << lo << ", " << lo + 100 << "): " << found.size() << " (" << im.count_overlaps(lo, lo + 100) << "), sum: " << sum;
+		if (found.empty() == false)
+			std::cout << ", first: [" << found[0]->first.first << ", " << found[0]->first.second << ")";
+		std::cout << '\n';
+	}
+
+	std::cout << "find_containing:\n";
+	for (int point = 1; point < 10000; point += 3333) {
+		std::vector<interval_map::iterator> found;
+		im.find_containing(point, std::back_inserter(found));
+		std::cout << point << ": " << found.size() << '\n';
+		for (std::size_t n = 0; n < found.size() && n < 3; n++)
+			std::cout << "  [" << found[n]->first.first << ", " << found[n]->first.second << ") => " << found[n]->second << '\n';
+	}
+
+	std::cout << "empty ranges, bounds exactly on the ends:\n";
+	interval_map small;
+	small.insert(__NS__::make_pair(__NS__::make_pair(10, 20), 1));
+	small.insert(__NS__::make_pair(__NS__::make_pair(20, 30), 2));
+	std::cout << small.count_overlaps(20, 20) << ", " << small.count_overlaps(19, 21) << ", " << small.count_overlaps(30, 40)
+		<< ", " << small.count_overlaps(0, 10) << ", " << small.find_overlap(20, 25)->second << '\n';
+
+	std::cout << "erase every other interval, count again:\n";
+	bool odd = false;
+	for (interval_map::iterator it = im.begin(); it != im.end(); odd = !odd) {
+		if (odd)
+			im.erase(it++);
+		else
+			++it;
+	}
+	std::cout << "size: " << im.size() << ", [0, 10000): " << im.count_overlaps(0, 10000) << ", [5000, 5001): " << im.count_overlaps(5000, 5001) << '\n';
+
+	typedef ext_arena_allocator<__NS__::pair<const __NS__::pair<int, int>, int> >	arena_alloc;
+	typedef ext_interval_map<int, int, arena_alloc::type>::type					arena_interval_map;
+
+	std::cout << "the intervals left, copied to a map in an arena:\n";
+	ExtArena			arena;
+	arena_interval_map	am((__NS__::less<int>()), arena_alloc::make(arena));
+	for (interval_map::iterator it = im.begin(); it != im.end(); ++it)
+		am.insert(*it);
+	arena_interval_map	copy(am);
+	std::vector<arena_interval_map::iterator> found;
+	copy.find_containing(5000, std::back_inserter(found));
+	std::cout << "size: " << am.size() << ", [0, 10000): " << am.count_overlaps(0, 10000) << ", [5000, 5001): " << am.count_overlaps(5000, 5001)
+		<< ", containing 5000 in the copy: " << found.size() << '\n';
+	std::cout << std::endl;
+}
+
+/**
+ * @brief balancing policies test (extension, std::allocator for std)
+ */
+
+template < class Map >
+void	policyRun(typename Map::allocator_type const & alloc = typename Map::allocator_type()) {
+	Map				m((typename Map::key_compare()), alloc);
+	unsigned long	seed = 41;
+	for (int i = 0; i < 4000; i++)
+		m.insert(__NS__::make_pair(nextRand(seed) % 6000, i));
+	for (int i = 0; i < 500; i++)
+		m.insert(m.end(), __NS__::make_pair(6000 + i, i));
+	printDigest(m);
+
+	long	found = 0;
+	for (int k = 0; k < 7000; k += 3) {
+		typename Map::iterator it = m.find(k);
+		if (it != m.end())
+			found += it->second;
+	}
+	std::cout << "found: " << found << ", lower_bound(3001): " << m.lower_bound(3001)->first << ", upper_bound(3001): " << m.upper_bound(3001)->first << '\n';
+
+	seed = 41;
+	for (int i = 0; i < 3000; i++)
+		m.erase(nextRand(seed) % 6000);
+	for (typename Map::iterator it = m.begin(); it != m.end(); ) {
+		if (it->first % 5 == 0)
+			m.erase(it++);
+		else
+			++it;
+	}
+	printDigest(m);
+
+	Map		copy(m);
+	long	backward = 0;
+	for (typename Map::reverse_iterator it = copy.rbegin(); it != copy.rend(); ++it)
+		backward = backward * 3 % 1000003 + it->first;
+	std::cout << "copy: " << copy.size() << ", backward hash: " << backward << ", equal: " << (copy == m) << '\n';
+
+	m.erase(m.begin(), m.lower_bound(5000));
+	for (int i = 0; i < 100; i++)
+		m[i * 50] += 1;
+	printDigest(m);
+	m.clear();
+	m[1] = 1;
+	printDigest(m);
+}
+
+void	policyTest(void) {
+	printTitle("balancing policies");
+
+	std::cout << "red black (default):\n";
+	policyRun<__NS__::map<int, int> >();
+	std::cout << "RBT_AVL:\n";
+	policyRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_AVL)>::type>();
+	std::cout << "RBT_WeightBalanced:\n";
+	policyRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_WeightBalanced)>::type>();
+	std::cout << "RBT_Splay:\n";
+	policyRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_Splay)>::type>();
+	std::cout << "RBT_SizedNodeBase:\n";
+	policyRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_SizedNodeBase)>::type>();
+	std::cout << "RBT_IndexStorage:\n";
+	policyRun<ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type>();
+
+	typedef ext_arena_allocator<__NS__::pair<const int, int> >	arena_alloc;
+	ExtArena	arena;
+	std::cout << "RBT_AVL and RBT_WeightBalanced on an arena:\n";
+	policyRun<ext_basic_map<int, int, __NS__::less<int>, arena_alloc::type, EXT_POLICY(RBT_AVL)>::type>(arena_alloc::make(arena));
+	policyRun<ext_basic_map<int, int, __NS__::less<int>, arena_alloc::type, EXT_POLICY(RBT_WeightBalanced)>::type>(arena_alloc::make(arena));
+	std::cout << "RBT_IndexStorage on an arena:\n";
+	policyRun<ext_basic_map<int, int, __NS__::less<int>, arena_alloc::type,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type>(arena_alloc::make(arena));
+	std::cout << std::endl;
+}
+
+/**
+ * @brief index storage test (extension, the node storage for std)
+ */
+
+void	indexAllocTest(void) {
+	printTitle("RBT_IndexStorage");
+
+	typedef ext_basic_map<int, NoDefault, __NS__::less<int>, std::allocator<__NS__::pair<const int, NoDefault> >,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type	index_map;
+
+	std::cout << "mapped type without default constructor: + (i, i * 10) for i in [0, 100):\n";
+	index_map m1;
+	for (int i = 0; i < 100; i++)
+		m1.insert(__NS__::make_pair(i, NoDefault(i * 10)));
+	std::cout << "size: " << m1.size() << std::endl;
+
+	std::cout << "find 42: " << m1.find(42)->second.getI() << '\n';
+	std::cout << "erase [10, 90):\n";
+	m1.erase(m1.find(10), m1.find(90));
+	for (index_map::iterator it = m1.begin(); it != m1.end(); ++it)
+		std::cout << it->first << " => " << it->second.getI() << '\n';
+
+	std::cout << "copy, then + (i, -i) for i in [200, 1200):\n";
+	index_map m2(m1);
+	for (int i = 200; i < 1200; i++)
+		m2.insert(__NS__::make_pair(i, NoDefault(-i)));
+	std::cout << "size: " << m2.size() << " / " << m1.size() << '\n';
+	std::cout << "lower_bound 555: " << m2.lower_bound(555)->second.getI() << '\n';
+
+	std::cout << "clear, + (7, 70):\n";
+	m2.clear();
+	m2.insert(__NS__::make_pair(7, NoDefault(70)));
+	std::cout << m2.begin()->first << " => " << m2.begin()->second.getI() << '\n';
+	std::cout << "m1 == m1 copy: " << (m1.size() == index_map(m1).size()) << '\n';
+
+	std::cout << "merge + (i, -i) for i in [80, 300) (ft: copied, the nodes cannot leave the array), then union with + (i, i) for i in [290, 310):\n";
+	{
+		index_map m6;
+		for (int i = 80; i < 300; i++)
+			m6.insert(__NS__::make_pair(i, NoDefault(-i)));
+		index_map m7(m1);
+		extMerge(m7, m6);
+		std::cout << "size: " << m7.size() << " / " << m6.size() << ", find 95: " << m7.find(95)->second.getI()
+			<< ", find 250: " << m7.find(250)->second.getI() << ", source first: " << m6.begin()->first << '\n';
+
+		index_map m8;
+		for (int i = 290; i < 310; i++)
+			m8.insert(__NS__::make_pair(i, NoDefault(i)));
+		extSetUnion(m7, m8);
+		std::cout << "size: " << m7.size() << " / " << m8.size() << ", last: " << m7.rbegin()->first
+			<< " => " << m7.rbegin()->second.getI() << ", other last: " << m8.rbegin()->first << '\n';
+	}
+
+	typedef ext_basic_map<int, CopyThrower, __NS__::less<int>, std::allocator<__NS__::pair<const int, CopyThrower> >,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type	throw_map;
+
+	std::cout << "+ (7, 7) in a full array, the third copy throws (ft: while the array grows) and the insertion is retried:\n";
+	{
+		throw_map m3;
+		for (int i = 0; i < 7; i++)
+			m3.insert(__NS__::make_pair(i, CopyThrower(i)));
+
+		__NS__::pair<const int, CopyThrower> extra(7, CopyThrower(7));
+		for (int attempt = 0, done = 0; !done; attempt++) {
+			CopyThrower::countdown = attempt == 0 ? 3 : 0;
+			try {
+				m3.insert(extra);
+				done = 1;
+			}
+			catch (std::exception const &) {}
+		}
+		CopyThrower::countdown = 0;
+		std::cout << "size: " << m3.size() << ", live: " << CopyThrower::live - 1 << '\n';
+		for (throw_map::iterator it = m3.begin(); it != m3.end(); ++it)
+			std::cout << it->first << " => " << it->second.getI() << '\n';
+	}
+	std::cout << "live after the map: " << CopyThrower::live << '\n';
+
+	typedef ext_arena_allocator<__NS__::pair<const int, NoDefault> >	arena_alloc;
+	typedef ext_basic_map<int, NoDefault, __NS__::less<int>, arena_alloc::type,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type	arena_map;
+
+	std::cout << "on an arena: + (i, i * i) for i in [0, 200), erase the multiples of 3:\n";
+	ExtArena	arena;
+	arena_map	m4((__NS__::less<int>()), arena_alloc::make(arena));
+	for (int i = 0; i < 200; i++)
+		m4.insert(__NS__::make_pair(i, NoDefault(i * i)));
+	for (int i = 0; i < 200; i += 3)
+		m4.erase(i);
+	arena_map	m5(m4);
+	std::cout << "size: " << m4.size() << " / " << m5.size() << ", find 100: " << m5.find(100)->second.getI()
+		<< ", first: " << m4.begin()->first << ", last: " << m4.rbegin()->first << '\n';
+}
+
+/**
+ * @brief node handle test (extension, emulated with copies for std)
+ */
+
+void	nodeHandleTest(void) {
+	printTitle("node handle");
+
+	typedef __NS__::map<int, std::string>	str_map;
+	typedef ext_node<str_map>::type			node_type;
+
+	str_map m1;
+	for (int i = 0; i < 10; i++)
+		m1[i] = std::string(1, 'a' + i);
+
+	std::cout << "extract(3):\n";
+	node_type nh1 = extExtract(m1, 3);
+	std::cout << "empty: " << nh1.empty() << ", " << nh1.key() << " => " << nh1.mapped() << '\n';
+	std::cout << "count(3): " << m1.count(3) << '\n';
+
+	std::cout << "extract(42), not in the map:\n";
+	node_type none = extExtract(m1, 42);
+	std::cout << "empty: " << none.empty() << '\n';
+
+	std::cout << "extract(find(7)):\n";
+	node_type nh2 = extExtract(m1, m1.find(7));
+	std::cout << nh2.key() << " => " << nh2.mapped() << '\n';
+	printContent(m1);
+
+	std::cout << "copy transfers the node:\n";
+	node_type nh3 = nh1;
+	std::cout << "source empty: " << nh1.empty() << ", copy: " << nh3.key() << '\n';
+
+	std::cout << "key 3 -> 30, insert(node):\n";
+	nh3.key() = 30;
+	nh3.mapped() = "thirty";
+	ext_insert_return<str_map>::type ret1 = extInsert(m1, nh3);
+	std::cout << "inserted: " << ret1.inserted << ", position: " << ret1.position->first << " => " << ret1.position->second
+		<< ", handle empty: " << nh3.empty() << ", returned node empty: " << ret1.node.empty() << '\n';
+
+	std::cout << "insert(node) with a key already in the map (5):\n";
+	node_type dup = extExtract(m1, 5);
+	m1[5] = "five";
+	dup.mapped() = "lost";
+	ext_insert_return<str_map>::type ret2 = extInsert(m1, dup);
+	std::cout << "inserted: " << ret2.inserted << ", position: " << ret2.position->first << " => " << ret2.position->second
+		<< ", handle empty: " << dup.empty() << ", returned node: " << ret2.node.key() << " => " << ret2.node.mapped() << '\n';
+
+	std::cout << "insert(node) with an empty node:\n";
+	ext_insert_return<str_map>::type ret3 = extInsert(m1, node_type());
+	std::cout << "inserted: " << ret3.inserted << ", at end: " << (ret3.position == m1.end()) << '\n';
+
+	std::cout << "insert(end(), node 7):\n";
+	str_map::iterator it = extInsert(m1, m1.end(), nh2);
+	std::cout << it->first << " => " << it->second << ", handle empty: " << nh2.empty() << '\n';
+
+	std::cout << "insert(begin(), node 8) with 8 already in the map:\n";
+	node_type nh4 = extExtract(m1, 8);
+	m1[8] = "eight";
+	it = extInsert(m1, m1.begin(), nh4);
+	std::cout << it->first << " => " << it->second << ", handle empty: " << nh4.empty() << '\n';
+	printContent(m1);
+
+	std::cout << "handle outliving its map:\n";
+	node_type kept;
+	{
+		str_map tmp;
+		for (int i = 100; i < 105; i++)
+			tmp[i] = "tmp";
+		kept = extExtract(tmp, 102);
+	}
+	std::cout << kept.key() << " => " << kept.mapped() << '\n';
+	extInsert(m1, kept);
+	printContent(m1);
+
+	std::cout << "merge m2 [5, 15) into m1:\n";
+	str_map m2;
+	for (int i = 5; i < 15; i++)
+		m2[i] = "m2";
+	extMerge(m1, m2);
+	printContent(m1);
+	printContent(m2);
+
+	std::cout << "merge m3 [50, 55) into m2, extract 52 from m2, destroy m3 and m2:\n";
+	node_type moved;
+	{
+		str_map m3;
+		for (int i = 50; i < 55; i++)
+			m3[i] = "m3";
+		extMerge(m2, m3);
+		moved = extExtract(m2, 52);
+		extMerge(m1, m2);
+		m2.clear();
+	}
+	std::cout << moved.key() << " => " << moved.mapped() << '\n';
+	extInsert(m1, m1.begin(), moved);
+	printContent(m1);
+
+	std::cout << "merge between maps on one arena (equal allocators, distinct pools):\n";
+	typedef ext_arena_allocator<__NS__::pair<const int, int> >									arena_alloc;
+	typedef __NS__::map<int, int, __NS__::less<int>, arena_alloc::type>							arena_map;
+	ExtArena	arena;
+	arena_map	a1((__NS__::less<int>()), arena_alloc::make(arena));
+	{
+		arena_map	a2((__NS__::less<int>()), arena_alloc::make(arena));
+
+		for (int i = 0; i < 20; i++) {
+			a1[i * 2] = i;
+			a2[i * 3] = -i;
+		}
+		extMerge(a1, a2);
+		std::cout << "a2 size: " << a2.size() << '\n';
+	}
+	printContent(a1);
+
+	std::cout << "merge, union and node insertion from maps on another arena (allocators not equal), that arena destroyed:\n";
+	{
+		ExtArena	other;
+		arena_map	b1((__NS__::less<int>()), arena_alloc::make(other));
+		arena_map	b2((__NS__::less<int>()), arena_alloc::make(other));
+
+		for (int i = 0; i < 10; i++) {
+			b1[i * 5] = i * 100;
+			b2[i * 7 + 1] = -i * 100;
+		}
+		extMerge(a1, b1);
+		extSetUnion(a1, b2);
+		b1[1000] = 1000;
+		b2[2000] = 2000;
+		ext_insert_return<arena_map>::type	ret = extInsert(a1, extExtract(b1, 1000));
+		ext_node<arena_map>::type			nh = extExtract(b2, 2000);
+		arena_map::iterator					pos = extInsert(a1, a1.end(), nh);
+		std::cout << "inserted: " << ret.inserted << ", node empty: " << ret.node.empty() << ", hinted: " << pos->first
+			<< " (nh empty: " << nh.empty() << "), left: " << b1.size() << " / " << b2.size() << '\n';
+	}
+	printContent(a1);
+}
+
+/**
+ * @brief skewed access test (extension, std::map for std)
+ */
+
+void	splayTest(void) {
+	printTitle("skewed access");
+
+	typedef ext_basic_map<int, int, __NS__::less<int>, std::allocator<__NS__::pair<const int, int> >, EXT_POLICY(RBT_Splay)>::type	splay_map;
+
+	splay_map m1;
+	for (int i = 0; i < 5000; i++)
+		m1.insert(__NS__::make_pair(i * 2, 0));
+	printDigest(m1);
+
+	std::cout << "30000 lookups, 9 in 10 on 16 hot keys, the others on any key (present or not):\n";
+	unsigned long	seed = 53;
+	long			found = 0;
+	for (int i = 0; i < 30000; i++) {
+		int r = nextRand(seed);
+		int k = r % 10 != 0 ? (r / 10 % 16) * 613 : r / 10 % 10001;
+
+		splay_map::iterator it = m1.find(k);
+		if (it != m1.end())
+			found += ++it->second;
+		if (i % 7 == 0)
+			++m1[k | 1];
+		if (i % 11 == 0)
+			found += m1.lower_bound(k)->first;
+	}
+	std::cout << "found: " << found << '\n';
+	printDigest(m1);
+
+	std::cout << "the hot keys:\n";
+	for (int h = 0; h < 16; h++) {
+		splay_map::iterator it = m1.find(h * 613);
+		if (it != m1.end())
+			std::cout << it->first << " => " << it->second << '\n';
+	}
+
+	std::cout << "in order both ways after the rotations:\n";
+	long	forward = 0;
+	long	backward = 0;
+	for (splay_map::iterator it = m1.begin(); it != m1.end(); ++it)
+		forward = forward * 3 % 1000003 + it->first;
+	for (splay_map::reverse_iterator it = m1.rbegin(); it != m1.rend(); ++it)
+		backward = backward * 3 % 1000003 + it->first;
+	std::cout << forward << ", " << backward << '\n';
+
+	std::cout << "bounds held while other bounds splay their nodes to the root:\n";
+	__NS__::pair<splay_map::iterator, splay_map::iterator> range = m1.equal_range(4000);
+	splay_map::iterator	low = m1.lower_bound(3990);
+	splay_map::iterator	high = m1.upper_bound(4011);
+	for (int k = 9999; k >= 0; k -= 97) {
+		m1.lower_bound(k);
+		m1.upper_bound(k);
+		m1.equal_range(k + 1);
+	}
+	std::cout << "equal_range(4000): " << range.first->first << ", " << range.second->first << '\n';
+	for (splay_map::iterator it = low; it != high; ++it)
+		std::cout << it->first << " => " << it->second << '\n';
+	for (splay_map::iterator it = high; it != low; )
+		std::cout << (--it)->first << (it == low ? '\n' : ' ');
+
+	std::cout << "sorted lookups of every key (the tree becomes a path), then erase the hot keys:\n";
+	for (int k = 0; k < 10001; k++)
+		m1.find(k);
+	for (int h = 0; h < 16; h++)
+		m1.erase(h * 613);
+	splay_map m2(m1);
+	printDigest(m1);
+	std::cout << "copy equal: " << (m2 == m1) << ", count(9999): " << m2.count(9999) << ", find(9998): " << m2.find(9998)->second << '\n';
+	std::cout << std::endl;
+}
+
 /**
  * @brief main
  */
@@ -734,7 +1622,18 @@ int main(int ac, char **av) {
 			<< "- \033[1;36mfindTest\033[0m: launch about find test\n"
 			<< "- \033[1;36mcountTest\033[0m: launch about count test\n"
 			<< "- \033[1;36mboundTest\033[0m: launch about bound test\n"
-			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n";
+			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n"
+			<< "- \033[1;36mhintInsertTest\033[0m: launch about hint insert test\n"
+			<< "- \033[1;36msortedRangeTest\033[0m: launch about sorted range construct test\n"
+			<< "- \033[1;36mtransparentTest\033[0m: launch about transparent lookup test\n"
+			<< "- \033[1;36msetOpsTest\033[0m: launch about set_union/set_intersection/set_difference test\n"
+			<< "- \033[1;36morderStatTest\033[0m: launch about nth/rank/count_range test\n"
+			<< "- \033[1;36maggregateTest\033[0m: launch about summary/aggregate test\n"
+			<< "- \033[1;36mintervalMapTest\033[0m: launch about interval_map test\n"
+			<< "- \033[1;36mpolicyTest\033[0m: launch about balancing policies test\n"
+			<< "- \033[1;36mindexAllocTest\033[0m: launch about index storage test\n"
+			<< "- \033[1;36mnodeHandleTest\033[0m: launch about node handle test\n"
+			<< "- \033[1;36msplayTest\033[0m: launch about skewed access (RBT_Splay) test\n";
 		return 0;
 	}
 
@@ -753,16 +1652,27 @@ int main(int ac, char **av) {
 		{"findTest", &findTest},
 		{"countTest", &countTest},
 		{"boundTest", &boundTest},
-		{"equalRangeTest", &equalRangeTest}};
+		{"equalRangeTest", &equalRangeTest},
+		{"hintInsertTest", &hintInsertTest},
+		{"sortedRangeTest", &sortedRangeTest},
+		{"transparentTest", &transparentTest},
+		{"setOpsTest", &setOpsTest},
+		{"orderStatTest", &orderStatTest},
+		{"aggregateTest", &aggregateTest},
+		{"intervalMapTest", &intervalMapTest},
+		{"policyTest", &policyTest},
+		{"indexAllocTest", &indexAllocTest},
+		{"nodeHandleTest", &nodeHandleTest},
+		{"splayTest", &splayTest}};
 
 	if (std::string(av[1]) == "all") {
-		for (int i = 0; i < 15; i++)
+		for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++)
 			test[i].fptr();
 		return 0;
 	}
 
 	std::string arg(av[1]);
-	for (int i = 0; i < 15; i++) {
+	for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++) {
 		if (test[i].testName == arg) {
 			test[i].fptr();
 			return 0;
@@ -11,8 +11,10 @@
 /* ************************************************************************** */
 
 #include "Custom.hpp"
+#include "Extension.hpp"
 #include "set.hpp"
 #include <set>
+#include <vector>
 #include <iostream>
 #include <string>
 
@@ -35,15 +37,23 @@ void	printTitle(std::string const & title) {
 
 template < class T >
 void	printSize(__NS__::set<T> s) {
+	__NS__::set<T>	copy(s);
+
 	std::cout << "size: " << s.size() << std::endl;
-	std::cout << "maxSize: " << s.max_size() << std::endl;
+	// the node layout is implementation defined: only what max_size promises is compared
+	std::cout << "maxSize > 0: " << (s.max_size() > 0) << ", >= size: " << (s.max_size() >= s.size())
+		<< ", same for a copy: " << (copy.max_size() == s.max_size()) << std::endl;
 	std::cout << std::endl;
 }
 
 template < class T, class Compare >
 void	printSize(__NS__::set<T, Compare> s) {
+	__NS__::set<T, Compare>	copy(s);
+
 	std::cout << "size: " << s.size() << std::endl;
-	std::cout << "maxSize: " << s.max_size() << std::endl;
+	// the node layout is implementation defined: only what max_size promises is compared
+	std::cout << "maxSize > 0: " << (s.max_size() > 0) << ", >= size: " << (s.max_size() >= s.size())
+		<< ", same for a copy: " << (copy.max_size() == s.max_size()) << std::endl;
 	std::cout << std::endl;
 }
 
@@ -624,6 +634,669 @@ void	equalRangeTest(void) {
 	std::cout << *ret.second << '\n';
 }
 
+/**
+ * @brief utils of the tests on many elements
+ */
+
+template < class Set >
+void	printContent(Set const & s) {
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+		std::cout << *it << ' ';
+	std::cout << "\nsize: " << s.size() << "\n\n";
+}
+
+/** @brief size, sum of the values, first and last: enough to diff big sets */
+template < class Set >
+void	printDigest(Set const & s) {
+	long			values = 0;
+	std::size_t		n = 0;
+
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it, ++n)
+		values += *it;
+	std::cout << "size: " << s.size() << ", iterated: " << n << ", values: " << values;
+	if (s.empty() == false)
+		std::cout << ", first: " << *s.begin() << ", last: " << *(--s.end());
+	std::cout << std::endl;
+}
+
+/** @brief deterministic pseudo random numbers (LCG) */
+int	nextRand(unsigned long & seed) {
+	seed = seed * 1103515245UL + 12345UL;
+	return static_cast<int>((seed >> 8) % 100000);
+}
+
+/**
+ * @brief hint insert test
+ */
+
+void	hintInsertTest(void) {
+	printTitle("hint insert");
+
+	typedef __NS__::set<int>	int_set;
+
+	std::cout << "ascending values, hint end():\n";
+	int_set s1;
+	for (int i = 0; i < 2000; i++)
+		s1.insert(s1.end(), i);
+	printDigest(s1);
+
+	std::cout << "descending values, hint begin():\n";
+	int_set s2;
+	for (int i = 2000; i > 0; i--)
+		s2.insert(s2.begin(), i);
+	printDigest(s2);
+
+	std::cout << "hint at the element after the value, and right before it:\n";
+	int_set s3;
+	for (int i = 0; i < 100; i += 10)
+		s3.insert(i);
+	int_set::iterator it = s3.insert(s3.find(50), 45);
+	std::cout << *it << '\n';
+	it = s3.insert(s3.find(40), 41);
+	std::cout << *it << '\n';
+
+	std::cout << "wrong hints (far from the value):\n";
+	it = s3.insert(s3.begin(), 95);
+	std::cout << *it << '\n';
+	it = s3.insert(s3.end(), -5);
+	std::cout << *it << '\n';
+
+	std::cout << "value already in the set, with the right and a wrong hint:\n";
+	it = s3.insert(s3.find(30), 30);
+	std::cout << *it << ", next: " << *(++it) << '\n';
+	it = s3.insert(s3.begin(), 90);
+	std::cout << *it << ", next: " << *(++it) << '\n';
+	printContent(s3);
+
+	std::cout << "random values, hint lower_bound(value):\n";
+	int_set			s4;
+	unsigned long	seed = 11;
+	for (int i = 0; i < 5000; i++) {
+		int v = nextRand(seed) % 3000;
+		s4.insert(s4.lower_bound(v), v);
+	}
+	printDigest(s4);
+	std::cout << std::endl;
+}
+
+/**
+ * @brief sorted range test
+ */
+
+void	sortedRangeTest(void) {
+	printTitle("sorted range");
+
+	typedef __NS__::set<int>	int_set;
+
+	std::cout << "sorted range with duplicates:\n";
+	std::vector<int> v;
+	for (int i = 0; i < 3000; i++)
+		v.push_back(i / 3);
+	int_set s1(v.begin(), v.end());
+	printDigest(s1);
+
+	std::cout << "reverse sorted range:\n";
+	int_set s2(v.rbegin(), v.rend());
+	printDigest(s2);
+
+	std::cout << "unsorted range:\n";
+	std::vector<int>	u;
+	unsigned long		seed = 5;
+	for (int i = 0; i < 3000; i++)
+		u.push_back(nextRand(seed) % 1000);
+	int_set s3(u.begin(), u.end());
+	printDigest(s3);
+
+	std::cout << "sorted range from another set, then insert(range) into a non empty set:\n";
+	int_set s4(s1.begin(), s1.find(500));
+	printDigest(s4);
+	s4.insert(s3.begin(), s3.end());
+	printDigest(s4);
+
+	std::cout << "empty range, one element:\n";
+	int_set s5(v.begin(), v.begin());
+	printDigest(s5);
+	int_set s6(v.begin(), v.begin() + 1);
+	printDigest(s6);
+
+	std::cout << "the built tree keeps working: erase the even values of s1, insert [3000, 3100):\n";
+	for (int i = 0; i < 1000; i += 2)
+		s1.erase(i);
+	for (int i = 3000; i < 3100; i++)
+		s1.insert(i);
+	printDigest(s1);
+	std::cout << std::endl;
+}
+
+/**
+ * @brief transparent lookup test
+ */
+
+void	transparentTest(void) {
+	printTitle("transparent lookup");
+
+	typedef __NS__::set<std::string, EXT_TRANSPARENT_LESS(std::string)>	str_set;
+
+	str_set s1;
+	s1.insert("apple");
+	s1.insert("banana");
+	s1.insert("cherry");
+	s1.insert("date");
+	s1.insert("elder");
+
+	const char	*key = "cherry";
+	const char	*missing = "coconut";
+
+	std::cout << "find(cherry): " << *s1.find(key) << '\n';
+	std::cout << "find(coconut) == end: " << (s1.find(missing) == s1.end()) << '\n';
+	std::cout << "count(banana): " << s1.count("banana") << ", count(coconut): " << s1.count(missing) << '\n';
+	std::cout << "lower_bound(coconut): " << *s1.lower_bound(missing) << '\n';
+	std::cout << "upper_bound(cherry): " << *s1.upper_bound(key) << '\n';
+
+	__NS__::pair<str_set::iterator, str_set::iterator> ret = s1.equal_range(key);
+	std::cout << "equal_range(cherry): " << *ret.first << " .. " << *ret.second << '\n';
+
+	const str_set & cs1 = s1;
+	std::cout << "const find(date): " << *cs1.find("date") << '\n';
+
+	std::cout << "erase(banana): " << s1.erase("banana") << ", erase(coconut): " << s1.erase(missing) << '\n';
+	printContent(s1);
+}
+
+/**
+ * @brief set operations test
+ */
+
+void	setOpsTest(void) {
+	printTitle("set operations");
+
+	typedef __NS__::set<int>	int_set;
+
+	int_set evens;
+	int_set threes;
+	int_set few;
+	for (int i = 0; i < 3000; i += 2)
+		evens.insert(i);
+	for (int i = 0; i < 4500; i += 3)
+		threes.insert(i);
+	few.insert(6);
+	few.insert(7);
+	few.insert(2999);
+	few.insert(5000);
+
+	std::cout << "union (big with big), other keeps the common values:\n";
+	int_set	a(evens);
+	int_set	b(threes);
+	extSetUnion(a, b);
+	printDigest(a);
+	printDigest(b);
+
+	std::cout << "union (big with small), (small with big):\n";
+	int_set	c(evens);
+	int_set	d(few);
+	extSetUnion(c, d);
+	printDigest(c);
+	printDigest(d);
+	int_set	e(few);
+	int_set	f(threes);
+	extSetUnion(e, f);
+	printDigest(e);
+	printDigest(f);
+
+	std::cout << "intersection:\n";
+	int_set g(evens);
+	extSetIntersection(g, threes);
+	printDigest(g);
+	int_set h(evens);
+	extSetIntersection(h, few);
+	printContent(h);
+	int_set i(few);
+	extSetIntersection(i, threes);
+	printContent(i);
+
+	std::cout << "difference:\n";
+	int_set j(evens);
+	extSetDifference(j, threes);
+	printDigest(j);
+	int_set k(threes);
+	extSetDifference(k, few);
+	printDigest(k);
+	int_set l(few);
+	extSetDifference(l, evens);
+	printContent(l);
+
+	std::cout << "with an empty set, and with itself (a copy):\n";
+	int_set empty;
+	int_set m(evens);
+	extSetUnion(m, empty);
+	extSetIntersection(m, int_set(evens));
+	printDigest(m);
+	extSetDifference(m, int_set(m));
+	printDigest(m);
+	extSetIntersection(empty, evens);
+	printDigest(empty);
+
+	std::cout << "the trees keep working: + [0, 100) to g, - the odd values of j:\n";
+	for (int x = 0; x < 100; x++)
+		g.insert(x);
+	for (int x = 1; x < 3000; x += 2)
+		j.erase(x);
+	printDigest(g);
+	printDigest(j);
+	std::cout << std::endl;
+}
+
+/**
+ * @brief order statistics test (extension, walked for std)
+ */
+
+template < class Set >
+void	orderStatRun(void) {
+	Set				s;
+	unsigned long	seed = 17;
+	for (int i = 0; i < 3000; i++)
+		s.insert(nextRand(seed) % 5000);
+	printDigest(s);
+
+	std::cout << "nth(0), nth(size / 2), nth(size - 1), nth(size) == end:\n";
+	std::cout << *extNth(s, 0) << ", " << *extNth(s, s.size() / 2) << ", " << *extNth(s, s.size() - 1)
+		<< ", " << (extNth(s, s.size()) == s.end()) << '\n';
+
+	std::cout << "rank of some values (in the set or not):\n";
+	for (int v = -1; v < 5100; v += 850)
+		std::cout << v << ": " << extRank(s, v) << '\n';
+
+	std::cout << "count_range:\n";
+	std::cout << "[0, 5000): " << extCountRange(s, 0, 5000) << ", [1000, 2000): " << extCountRange(s, 1000, 2000)
+		<< ", [2000, 1000): " << extCountRange(s, 2000, 1000) << ", [7, 7): " << extCountRange(s, 7, 7) << '\n';
+
+	std::cout << "nth(rank(v)) is lower_bound(v):\n";
+	bool	ok = true;
+	for (int v = 0; v < 5000; v += 7) {
+		typename Set::size_type r = extRank(s, v);
+		if (r < s.size() && *extNth(s, r) != *s.lower_bound(v))
+			ok = false;
+	}
+	std::cout << ok << '\n';
+
+	std::cout << "erase [1000, 3000), then nth / rank again:\n";
+	s.erase(s.lower_bound(1000), s.lower_bound(3000));
+	printDigest(s);
+	std::cout << *extNth(s, s.size() / 2) << ", " << extRank(s, 2500) << ", " << extCountRange(s, 500, 3500) << '\n';
+}
+
+void	orderStatTest(void) {
+	printTitle("order statistics");
+
+	std::cout << "RBT_SizedNodeBase:\n";
+	orderStatRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>, EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_SizedNodeBase)>::type>();
+	std::cout << "RBT_WeightBalanced:\n";
+	orderStatRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>, EXT_POLICY(RBT_WeightBalanced)>::type>();
+	std::cout << "RBT_AVL with RBT_SizedNodeBase:\n";
+	orderStatRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>, EXT_POLICY(RBT_AVL), EXT_POLICY(RBT_SizedNodeBase)>::type>();
+	std::cout << "RBT_Splay with RBT_SizedNodeBase:\n";
+	orderStatRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>, EXT_POLICY(RBT_Splay), EXT_POLICY(RBT_SizedNodeBase)>::type>();
+	std::cout << std::endl;
+}
+
+/**
+ * @brief aggregate test (extension, folded for std)
+ */
+
+/** @brief sum and number of the values */
+struct SumPolicy {
+	typedef __NS__::pair<long, int>	summary_type;
+
+	static summary_type	identity(void) { return summary_type(0, 0); }
+
+	static summary_type	summarize(int const & val) { return summary_type(val, 1); }
+
+	static summary_type	combine(summary_type const & a, summary_type const & b) {
+		return summary_type(a.first + b.first, a.second + b.second);
+	}
+};
+
+/** @brief the values in order (not commutative) */
+struct ConcatPolicy {
+	typedef std::string	summary_type;
+
+	static std::string	identity(void) { return std::string(); }
+
+	static std::string	summarize(char const & val) { return std::string(1, val); }
+
+	static std::string	combine(std::string const & a, std::string const & b) { return a + b; }
+};
+
+template < class Summary >
+void	printSummary(std::string const & title, Summary const & sum) {
+	std::cout << title << ": " << sum.first << " (" << sum.second << ")\n";
+}
+
+void	aggregateTest(void) {
+	printTitle("aggregate");
+
+	typedef ext_basic_set<int, __NS__::less<int>, std::allocator<int>,
+		EXT_POLICY(RBT_RedBlack), ext_augment<SumPolicy>::type>::type		sum_set;
+	typedef ext_basic_set<char, __NS__::less<char>, std::allocator<char>,
+		EXT_POLICY(RBT_RedBlack), ext_augment<ConcatPolicy>::type>::type	str_set;
+
+	std::cout << "sums: + 2000 random values:\n";
+	sum_set			s1;
+	unsigned long	seed = 23;
+	for (int i = 0; i < 2000; i++)
+		s1.insert(nextRand(seed) % 10000);
+	printSummary("summary", extSummary<SumPolicy>(s1));
+	for (int lo = -100; lo < 10000; lo += 1700)
+		printSummary("aggregate", extAggregate<SumPolicy>(s1, lo, lo + 2500));
+	printSummary("aggregate(500, 500)", extAggregate<SumPolicy>(s1, 500, 500));
+	printSummary("aggregate(900, 100)", extAggregate<SumPolicy>(s1, 900, 100));
+
+	std::cout << "erase [2000, 4000), erase some values, insert others:\n";
+	s1.erase(s1.lower_bound(2000), s1.lower_bound(4000));
+	for (int v = 0; v < 10000; v += 97)
+		s1.erase(v);
+	for (int v = 2000; v < 4000; v += 10)
+		s1.insert(v);
+	printSummary("summary", extSummary<SumPolicy>(s1));
+	printSummary("aggregate(1000, 5000)", extAggregate<SumPolicy>(s1, 1000, 5000));
+
+	std::cout << "copy, swap, assign keep the summaries:\n";
+	sum_set s2(s1);
+	sum_set s3;
+	s3.swap(s2);
+	s2 = s3;
+	printSummary("s2", extSummary<SumPolicy>(s2));
+	printSummary("s3", extAggregate<SumPolicy>(s3, 0, 5000));
+
+	typedef ext_arena_allocator<int>	arena_alloc;
+	typedef ext_basic_set<int, __NS__::less<int>, std::allocator<int>,
+		EXT_POLICY(RBT_AVL), ext_augment<SumPolicy>::type>::type		avl_sum_set;
+	typedef ext_basic_set<int, __NS__::less<int>, arena_alloc::type,
+		EXT_POLICY(RBT_Splay), ext_augment<SumPolicy>::type>::type	splay_sum_set;
+
+	std::cout << "the same sums on an AVL tree, and on a splay tree in an arena:\n";
+	ExtArena		arena;
+	avl_sum_set		s5(s1.begin(), s1.end());
+	splay_sum_set	s6((__NS__::less<int>()), arena_alloc::make(arena));
+	for (sum_set::iterator it = s1.begin(); it != s1.end(); ++it)
+		s6.insert(*it);
+	for (int v = 0; v < 10000; v += 31) {
+		s5.erase(v);
+		s6.erase(v);
+		s6.find(v + 1);
+	}
+	printSummary("AVL", extSummary<SumPolicy>(s5));
+	printSummary("splay", extSummary<SumPolicy>(s6));
+	for (int lo = 0; lo < 10000; lo += 2600) {
+		printSummary("AVL aggregate", extAggregate<SumPolicy>(s5, lo, lo + 3000));
+		printSummary("splay aggregate", extAggregate<SumPolicy>(s6, lo, lo + 3000));
+	}
+
+	std::cout << "concatenation (in order): + the letters, shuffled:\n";
+	str_set s4;
+	for (int i = 0; i < 26; i++)
+		s4.insert(static_cast<char>('a' + i * 7 % 26));
+	std::cout << "summary: " << extSummary<ConcatPolicy>(s4) << '\n';
+	std::cout << "aggregate(d, l): " << extAggregate<ConcatPolicy>(s4, 'd', 'l') << '\n';
+	std::cout << "aggregate(u, ~): " << extAggregate<ConcatPolicy>(s4, 'u', '~') << '\n';
+	s4.erase('e');
+	s4.erase('f');
+	std::cout << "erase e, f, aggregate(a, k): " << extAggregate<ConcatPolicy>(s4, 'a', 'k') << '\n';
+	std::cout << std::endl;
+}
+
+/**
+ * @brief balancing policies test (extension, std::allocator for std)
+ */
+
+template < class Set >
+void	policyRun(typename Set::allocator_type const & alloc = typename Set::allocator_type()) {
+	Set				s((typename Set::key_compare()), alloc);
+	unsigned long	seed = 41;
+	for (int i = 0; i < 4000; i++)
+		s.insert(nextRand(seed) % 6000);
+	for (int i = 0; i < 500; i++)
+		s.insert(s.end(), 6000 + i);
+	printDigest(s);
+
+	long	found = 0;
+	for (int v = 0; v < 7000; v += 3) {
+		typename Set::iterator it = s.find(v);
+		if (it != s.end())
+			found += *it;
+	}
+	std::cout << "found: " << found << ", lower_bound(3001): " << *s.lower_bound(3001) << ", upper_bound(3001): " << *s.upper_bound(3001) << '\n';
+
+	seed = 41;
+	for (int i = 0; i < 3000; i++)
+		s.erase(nextRand(seed) % 6000);
+	for (typename Set::iterator it = s.begin(); it != s.end(); ) {
+		if (*it % 5 == 0)
+			s.erase(it++);
+		else
+			++it;
+	}
+	printDigest(s);
+
+	Set		copy(s);
+	long	backward = 0;
+	for (typename Set::reverse_iterator it = copy.rbegin(); it != copy.rend(); ++it)
+		backward = backward * 3 % 1000003 + *it;
+	std::cout << "copy: " << copy.size() << ", backward hash: " << backward << ", equal: " << (copy == s) << '\n';
+
+	s.erase(s.begin(), s.lower_bound(5000));
+	for (int i = 0; i < 100; i++)
+		s.insert(i * 50);
+	printDigest(s);
+	s.clear();
+	s.insert(1);
+	printDigest(s);
+}
+
+void	policyTest(void) {
+	printTitle("balancing policies");
+
+	std::cout << "red black (default):\n";
+	policyRun<__NS__::set<int> >();
+	std::cout << "RBT_AVL:\n";
+	policyRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>, EXT_POLICY(RBT_AVL)>::type>();
+	std::cout << "RBT_WeightBalanced:\n";
+	policyRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>, EXT_POLICY(RBT_WeightBalanced)>::type>();
+	std::cout << "RBT_Splay:\n";
+	policyRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>, EXT_POLICY(RBT_Splay)>::type>();
+	std::cout << "RBT_SizedNodeBase:\n";
+	policyRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>, EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_SizedNodeBase)>::type>();
+	std::cout << "RBT_IndexStorage:\n";
+	policyRun<ext_basic_set<int, __NS__::less<int>, std::allocator<int>,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type>();
+
+	typedef ext_arena_allocator<int>	arena_alloc;
+	ExtArena	arena;
+	std::cout << "RBT_AVL and RBT_WeightBalanced on an arena:\n";
+	policyRun<ext_basic_set<int, __NS__::less<int>, arena_alloc::type, EXT_POLICY(RBT_AVL)>::type>(arena_alloc::make(arena));
+	policyRun<ext_basic_set<int, __NS__::less<int>, arena_alloc::type, EXT_POLICY(RBT_WeightBalanced)>::type>(arena_alloc::make(arena));
+	std::cout << "RBT_IndexStorage on an arena:\n";
+	policyRun<ext_basic_set<int, __NS__::less<int>, arena_alloc::type,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type>(arena_alloc::make(arena));
+	std::cout << std::endl;
+}
+
+/**
+ * @brief index storage test (extension, the node storage for std)
+ */
+
+void	indexAllocTest(void) {
+	printTitle("RBT_IndexStorage");
+
+	typedef ext_basic_set<int, __NS__::less<int>, std::allocator<int>,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type	index_set;
+
+	std::cout << "+ i * 3 % 1000 for i in [0, 1000):\n";
+	index_set s1;
+	for (int i = 0; i < 1000; i++)
+		s1.insert(i * 3 % 1000);
+	std::cout << "size: " << s1.size() << std::endl;
+
+	std::cout << "erase the odd values:\n";
+	for (int i = 1; i < 1000; i += 2)
+		s1.erase(i);
+	std::cout << "size: " << s1.size() << std::endl;
+	std::cout << "count 500: " << s1.count(500) << ", count 501: " << s1.count(501) << '\n';
+
+	std::cout << "swap with a copy of [0, 10):\n";
+	index_set s2;
+	for (int i = 0; i < 10; i++)
+		s2.insert(i);
+	s1.swap(s2);
+	for (index_set::iterator it = s1.begin(); it != s1.end(); ++it)
+		std::cout << *it << ' ';
+	std::cout << '\n';
+	std::cout << "size: " << s1.size() << " / " << s2.size() << '\n';
+	std::cout << "reverse first: " << *s2.rbegin() << '\n';
+
+	std::cout << "merge [5, 2000) (ft: copied, the nodes cannot leave the array), then union with [1990, 2010):\n";
+	{
+		index_set s5;
+		for (int i = 5; i < 2000; i++)
+			s5.insert(i);
+		index_set s6(s1);
+		extMerge(s6, s5);
+		std::cout << "size: " << s6.size() << " / " << s5.size() << ", first: " << *s6.begin()
+			<< ", source: " << *s5.begin() << " to " << *s5.rbegin() << '\n';
+
+		index_set s7;
+		for (int i = 1990; i < 2010; i++)
+			s7.insert(i);
+		extSetUnion(s6, s7);
+		std::cout << "size: " << s6.size() << " / " << s7.size() << ", last: " << *s6.rbegin()
+			<< ", other last: " << *s7.rbegin() << '\n';
+	}
+
+	typedef ext_arena_allocator<int>	arena_alloc;
+	typedef ext_basic_set<int, __NS__::less<int>, arena_alloc::type,
+		EXT_POLICY(RBT_RedBlack), EXT_POLICY(RBT_NodeBase), EXT_POLICY(RBT_IndexStorage)>::type	arena_set;
+
+	std::cout << "on an arena: + i * 7 % 500 for i in [0, 500), erase [100, 400), swap with a copy:\n";
+	ExtArena	arena;
+	arena_set	s3((__NS__::less<int>()), arena_alloc::make(arena));
+	for (int i = 0; i < 500; i++)
+		s3.insert(i * 7 % 500);
+	s3.erase(s3.lower_bound(100), s3.lower_bound(400));
+	arena_set	s4(s3);
+	s4.insert(250);
+	s3.swap(s4);
+	std::cout << "size: " << s3.size() << " / " << s4.size() << ", count 250: " << s3.count(250) << " / " << s4.count(250)
+		<< ", first: " << *s3.begin() << ", last: " << *s3.rbegin() << '\n';
+}
+
+/**
+ * @brief node handle test (extension, emulated with copies for std)
+ */
+
+void	nodeHandleTest(void) {
+	printTitle("node handle");
+
+	typedef __NS__::set<std::string>		str_set;
+	typedef ext_node<str_set>::type			node_type;
+
+	str_set s1;
+	for (int i = 0; i < 10; i++)
+		s1.insert(std::string(2, 'a' + i));
+
+	std::cout << "extract(\"cc\"):\n";
+	node_type nh1 = extExtract(s1, std::string("cc"));
+	std::cout << "empty: " << nh1.empty() << ", value: " << nh1.value() << '\n';
+
+	std::cout << "extract(\"zz\"), not in the set:\n";
+	node_type none = extExtract(s1, std::string("zz"));
+	std::cout << "empty: " << none.empty() << '\n';
+
+	std::cout << "extract(begin()):\n";
+	node_type nh2 = extExtract(s1, s1.begin());
+	std::cout << nh2.value() << '\n';
+	printContent(s1);
+
+	std::cout << "value \"cc\" -> \"zz\", insert(node):\n";
+	nh1.value() = "zz";
+	ext_insert_return<str_set>::type ret1 = extInsert(s1, nh1);
+	std::cout << "inserted: " << ret1.inserted << ", position: " << *ret1.position
+		<< ", handle empty: " << nh1.empty() << ", returned node empty: " << ret1.node.empty() << '\n';
+
+	std::cout << "insert(node) with a value already in the set (\"dd\"):\n";
+	node_type dup = extExtract(s1, std::string("dd"));
+	s1.insert("dd");
+	ext_insert_return<str_set>::type ret2 = extInsert(s1, dup);
+	std::cout << "inserted: " << ret2.inserted << ", position: " << *ret2.position
+		<< ", handle empty: " << dup.empty() << ", returned node: " << ret2.node.value() << '\n';
+
+	std::cout << "insert(end(), node \"aa\"):\n";
+	str_set::iterator it = extInsert(s1, s1.end(), nh2);
+	std::cout << *it << ", handle empty: " << nh2.empty() << '\n';
+	printContent(s1);
+
+	std::cout << "handle outliving its set:\n";
+	node_type kept;
+	{
+		str_set tmp;
+		tmp.insert("tmp1");
+		tmp.insert("tmp2");
+		kept = extExtract(tmp, std::string("tmp2"));
+	}
+	std::cout << kept.value() << '\n';
+	extInsert(s1, s1.begin(), kept);
+	printContent(s1);
+
+	std::cout << "merge s2 into s1, destroy s2:\n";
+	{
+		str_set s2;
+		s2.insert("aa");
+		s2.insert("mm");
+		s2.insert("nn");
+		extMerge(s1, s2);
+		printContent(s2);
+	}
+	printContent(s1);
+
+	std::cout << "merge between sets on one arena (equal allocators, distinct pools):\n";
+	typedef ext_arena_allocator<int>												arena_alloc;
+	typedef __NS__::set<int, __NS__::less<int>, arena_alloc::type>					arena_set;
+	ExtArena	arena;
+	arena_set	a1((__NS__::less<int>()), arena_alloc::make(arena));
+	{
+		arena_set	a2((__NS__::less<int>()), arena_alloc::make(arena));
+
+		for (int i = 0; i < 20; i++) {
+			a1.insert(i * 2);
+			a2.insert(i * 3);
+		}
+		extMerge(a1, a2);
+		printContent(a2);
+	}
+	printContent(a1);
+
+	std::cout << "merge, union and node insertion from sets on another arena (allocators not equal), that arena destroyed:\n";
+	{
+		ExtArena	other;
+		arena_set	b1((__NS__::less<int>()), arena_alloc::make(other));
+		arena_set	b2((__NS__::less<int>()), arena_alloc::make(other));
+
+		for (int i = 0; i < 10; i++) {
+			b1.insert(i * 5);
+			b2.insert(i * 7 + 1);
+		}
+		extMerge(a1, b1);
+		extSetUnion(a1, b2);
+		b1.insert(1000);
+		b2.insert(2000);
+		ext_insert_return<arena_set>::type	ret = extInsert(a1, extExtract(b1, 1000));
+		ext_node<arena_set>::type			nh = extExtract(b2, 2000);
+		arena_set::iterator					pos = extInsert(a1, a1.end(), nh);
+		std::cout << "inserted: " << ret.inserted << ", node empty: " << ret.node.empty() << ", hinted: " << *pos
+			<< " (nh empty: " << nh.empty() << "), left: " << b1.size() << " / " << b2.size() << '\n';
+	}
+	printContent(a1);
+}
+
 /**
  * @brief main
  */
@@ -646,7 +1319,16 @@ int main(int ac, char **av) {
 			<< "- \033[1;36mfindTest\033[0m: launch about find test\n"
 			<< "- \033[1;36mcountTest\033[0m: launch about count test\n"
 			<< "- \033[1;36mboundTest\033[0m: launch about bound test\n"
-			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n";
+			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n"
+			<< "- \033[1;36mhintInsertTest\033[0m: launch about hint insert test\n"
+			<< "- \033[1;36msortedRangeTest\033[0m: launch about sorted range construct test\n"
+			<< "- \033[1;36mtransparentTest\033[0m: launch about transparent lookup test\n"
+			<< "- \033[1;36msetOpsTest\033[0m: launch about set_union/set_intersection/set_difference test\n"
+			<< "- \033[1;36morderStatTest\033[0m: launch about nth/rank/count_range test\n"
+			<< "- \033[1;36maggregateTest\033[0m: launch about summary/aggregate test\n"
+			<< "- \033[1;36mpolicyTest\033[0m: launch about balancing policies test\n"
+			<< "- \033[1;36mindexAllocTest\033[0m: launch about index storage test\n"
+			<< "- \033[1;36mnodeHandleTest\033[0m: launch about node handle test\n";
 		return 0;
 	}
 
@@ -664,16 +1346,25 @@ int main(int ac, char **av) {
 		{"findTest", &findTest},
 		{"countTest", &countTest},
 		{"boundTest", &boundTest},
-		{"equalRangeTest", &equalRangeTest}};
+		{"equalRangeTest", &equalRangeTest},
+		{"hintInsertTest", &hintInsertTest},
+		{"sortedRangeTest", &sortedRangeTest},
+		{"transparentTest", &transparentTest},
+		{"setOpsTest", &setOpsTest},
+		{"orderStatTest", &orderStatTest},
+		{"aggregateTest", &aggregateTest},
+		{"policyTest", &policyTest},
+		{"indexAllocTest", &indexAllocTest},
+		{"nodeHandleTest", &nodeHandleTest}};
 
 	if (std::string(av[1]) == "all") {
-		for (int i = 0; i < 14; i++)
+		for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++)
 			test[i].fptr();
 		return 0;
 	}
 
 	std::string arg(av[1]);
-	for (int i = 0; i < 14; i++) {
+	for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++) {
 		if (test[i].testName == arg) {
 			test[i].fptr();
 			return 0;
@@ -0,0 +1,507 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_mapTest.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 19:40:18 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 19:40:18 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Custom.hpp"
+#include "Extension.hpp"
+#include "Tester.hpp"
+#include "unordered_map.hpp"
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+// #define __NS__ std // default namespace
+
+/**
+ * @note std of C++98 has no unordered_map: ft::unordered_map is diffed against std::map,
+ * the elements are sorted before being printed. the hash policy only exists for ft.
+ */
+#ifdef __STD__
+# define UNORDERED_MAP std::map
+
+template < class Map >
+void	rehash(Map &, std::size_t) {}
+
+template < class Map >
+void	reserve(Map &, std::size_t) {}
+
+template < class Map >
+void	setMaxLoadFactor(Map &, float) {}
+
+template < class Map >
+bool	loadIsBelowMax(Map const &) { return true; }
+
+#else
+# define UNORDERED_MAP ft::unordered_map
+
+template < class Map >
+void	rehash(Map & m, std::size_t n) { m.rehash(n); }
+
+template < class Map >
+void	reserve(Map & m, std::size_t n) { m.reserve(n); }
+
+template < class Map >
+void	setMaxLoadFactor(Map & m, float z) { m.max_load_factor(z); }
+
+template < class Map >
+bool	loadIsBelowMax(Map const & m) { return m.load_factor() <= m.max_load_factor(); }
+
+#endif
+
+/**
+ * @brief utils
+ */
+
+/** @brief the elements in key order, and how many the iterators went through */
+template < class Map >
+void	printContent(Map const & m) {
+	std::vector<std::pair<typename Map::key_type, typename Map::mapped_type> > v;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		v.push_back(std::make_pair(it->first, it->second));
+	std::sort(v.begin(), v.end());
+	for (std::size_t i = 0; i < v.size(); i++)
+		std::cout << v[i].first << ": " << v[i].second << std::endl;
+	std::cout << "iterated: " << v.size() << std::endl;
+	printSize(m);
+}
+
+/** @brief size, sum of the keys and of the values (order free): enough to diff big maps */
+template < class Map >
+void	printDigest(Map const & m) {
+	long			keys = 0;
+	long			values = 0;
+	std::size_t		n = 0;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it, ++n) {
+		keys += it->first;
+		values += it->second;
+	}
+	std::cout << "size: " << m.size() << ", iterated: " << n << ", keys: " << keys << ", values: " << values << std::endl;
+}
+
+/**
+ * @brief constructor test
+ */
+
+void	constructTest(void) {
+	printTitle("Constructor");
+
+	std::cout << "basic construct: + (a, 10) (b, 20) (c, 30) (d, 40):\n";
+	UNORDERED_MAP<char, int> m1;
+	m1['a'] = 10;
+	m1['b'] = 20;
+	m1['c'] = 30;
+	m1['d'] = 40;
+	printContent(m1);
+
+	std::cout << "range: vector of 1000 pairs, with duplicates:\n";
+	std::vector<__NS__::pair<int, int> >	v;
+	unsigned long							seed = 42;
+	for (int i = 0; i < 1000; i++)
+		v.push_back(__NS__::make_pair(nextRand(seed) % 700, i));
+	UNORDERED_MAP<int, int> m2(v.begin(), v.end());
+	printDigest(m2);
+
+	std::cout << "copy: m3(m2):\n";
+	UNORDERED_MAP<int, int> m3(m2);
+	printDigest(m3);
+	std::cout << "m3 == m2: " << (m3 == m2) << std::endl;
+
+	std::cout << "assign: m4 = m2, then clear m2:\n";
+	UNORDERED_MAP<int, int> m4;
+	m4[1] = 1;
+	m4 = m2;
+	m2.clear();
+	printDigest(m4);
+	printDigest(m2);
+	std::cout << "m4 != m2: " << (m4 != m2) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief iterator test
+ */
+
+void	iteratorTest(void) {
+	printTitle("Iterator");
+
+	UNORDERED_MAP<int, int> m1;
+	std::cout << "+ (i * 7 % 500, i) for i in [0, 500):\n";
+	for (int i = 0; i < 500; i++)
+		m1[i * 7 % 500] = i;
+	printDigest(m1);
+
+	std::cout << "const_iterator from iterator: ";
+	UNORDERED_MAP<int, int>::const_iterator cit = m1.begin();
+	std::cout << (cit == m1.begin() ? "equal" : "different") << std::endl;
+
+	std::cout << "write through the iterator: second *= 2:\n";
+	for (UNORDERED_MAP<int, int>::iterator it = m1.begin(); it != m1.end(); ++it)
+		it->second *= 2;
+	printDigest(m1);
+
+	std::cout << "post increment:\n";
+	UNORDERED_MAP<int, int>::iterator it = m1.begin();
+	UNORDERED_MAP<int, int>::iterator prev = it++;
+	std::cout << "prev != it: " << (prev != it) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief empty test
+ */
+
+void	emptyTest(void) {
+	printTitle("Empty");
+
+	UNORDERED_MAP<std::string, int> m1;
+	std::cout << (m1.empty() == true ? "m1 is empty" : "m1 is not empty") << std::endl;
+	std::cout << "begin == end: " << (m1.begin() == m1.end()) << std::endl;
+	m1["one"] = 1;
+	std::cout << (m1.empty() == true ? "m1 is empty" : "m1 is not empty") << std::endl;
+	m1.erase("one");
+	std::cout << (m1.empty() == true ? "m1 is empty" : "m1 is not empty") << std::endl;
+	std::cout << "begin == end: " << (m1.begin() == m1.end()) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief size test
+ */
+
+void	sizeTest(void) {
+	printTitle("Size");
+
+	UNORDERED_MAP<int, int> m1;
+	printSize(m1);
+
+	std::cout << "+ 10000 keys:\n";
+	for (int i = 0; i < 10000; i++)
+		m1.insert(__NS__::make_pair(i, i));
+	printSize(m1);
+
+	std::cout << "- every key but multiples of 100:\n";
+	for (int i = 0; i < 10000; i++) {
+		if (i % 100 != 0)
+			m1.erase(i);
+	}
+	printSize(m1);
+	printDigest(m1);
+}
+
+/**
+ * @brief element access test
+ */
+
+void	elementAccessTest(void) {
+	printTitle("Element access");
+
+	UNORDERED_MAP<std::string, std::string> m1;
+	std::cout << "Insert with operator[]:\n";
+	m1["c"] = "s";
+	m1["a"] = "c";
+	m1["b"] = "u";
+	m1["d"];
+	std::cout << "change a:\n";
+	m1["a"] = "changed";
+	printContent(m1);
+
+	std::cout << "counter with operator[]: ++m[k % 37] for 5000 k\n";
+	UNORDERED_MAP<int, int> m2;
+	for (int k = 0; k < 5000; k++)
+		++m2[k * 13 % 37];
+	printContent(m2);
+}
+
+/**
+ * @brief insert test
+ */
+
+void	insertTest(void) {
+	printTitle("insert");
+
+	UNORDERED_MAP<int, std::string> m1;
+	std::cout << "insert 2 -> two, 1 -> one, 2 -> again:\n";
+	__NS__::pair<UNORDERED_MAP<int, std::string>::iterator, bool> ret;
+	ret = m1.insert(__NS__::make_pair(2, std::string("two")));
+	std::cout << ret.first->first << " " << ret.first->second << " " << ret.second << std::endl;
+	ret = m1.insert(__NS__::make_pair(1, std::string("one")));
+	std::cout << ret.first->first << " " << ret.first->second << " " << ret.second << std::endl;
+	ret = m1.insert(__NS__::make_pair(2, std::string("again")));
+	std::cout << ret.first->first << " " << ret.first->second << " " << ret.second << std::endl;
+
+	std::cout << "hint insert (the hint is ignored by ft): 3, then 2 (present):\n";
+	UNORDERED_MAP<int, std::string>::iterator it;
+	it = m1.insert(m1.begin(), __NS__::make_pair(3, std::string("three")));
+	std::cout << it->first << " " << it->second << std::endl;
+	it = m1.insert(m1.end(), __NS__::make_pair(2, std::string("hint")));
+	std::cout << it->first << " " << it->second << std::endl;
+	printContent(m1);
+
+	std::cout << "20000 random insertions:\n";
+	UNORDERED_MAP<int, int>	m2;
+	unsigned long			seed = 7;
+	int						inserted = 0;
+	for (int i = 0; i < 20000; i++)
+		inserted += m2.insert(__NS__::make_pair(nextRand(seed), i)).second;
+	std::cout << "inserted: " << inserted << std::endl;
+	printDigest(m2);
+
+	std::cout << "insert range of m2 into m3:\n";
+	UNORDERED_MAP<int, int> m3;
+	m3[500000] = -1;
+	m3.insert(m2.begin(), m2.end());
+	printDigest(m3);
+}
+
+/**
+ * @brief erase test
+ */
+
+void	eraseTest(void) {
+	printTitle("erase");
+
+	UNORDERED_MAP<int, int> m1;
+	for (int i = 0; i < 5000; i++)
+		m1[i] = i * 3;
+
+	std::cout << "erase(key) of 10 present and 1 absent key: ";
+	std::size_t n = 0;
+	for (int i = 0; i < 5500; i += 500)
+		n += m1.erase(i);
+	std::cout << n << std::endl;
+	printDigest(m1);
+
+	std::cout << "erase(iterator) of the odd keys:\n";
+	UNORDERED_MAP<int, int>::iterator it = m1.begin();
+	while (it != m1.end()) {
+		if (it->first % 2 == 1)
+			it = extEraseAt(m1, it);
+		else
+			++it;
+	}
+	printDigest(m1);
+
+	std::cout << "erase of the random keys of a big map, one by one (tombstones):\n";
+	UNORDERED_MAP<int, int>	m2;
+	unsigned long			seed = 3;
+	for (int i = 0; i < 20000; i++)
+		m2[nextRand(seed)] = i;
+	printDigest(m2);
+	seed = 3;
+	n = 0;
+	for (int i = 0; i < 15000; i++)
+		n += m2.erase(nextRand(seed));
+	std::cout << "erased: " << n << std::endl;
+	printDigest(m2);
+	std::cout << "insert them back:\n";
+	seed = 3;
+	for (int i = 0; i < 15000; i++)
+		m2[nextRand(seed)] = -i;
+	printDigest(m2);
+
+	std::cout << "erase(begin(), end()):\n";
+	m2.erase(m2.begin(), m2.end());
+	printDigest(m2);
+	m2[1] = 1;
+	printDigest(m2);
+}
+
+/**
+ * @brief swap test
+ */
+
+void	swapTest(void) {
+	printTitle("swap");
+
+	UNORDERED_MAP<int, int> m1;
+	UNORDERED_MAP<int, int> m2;
+	for (int i = 0; i < 1000; i++)
+		m1[i] = i;
+	m2[-1] = -1;
+
+	UNORDERED_MAP<int, int>::iterator it = m1.find(500);
+	std::cout << "swap, iterators follow their elements:\n";
+	m1.swap(m2);
+	printDigest(m1);
+	printDigest(m2);
+	std::cout << "it still in m2: " << (it == m2.find(500)) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief clear test
+ */
+
+void	clearTest(void) {
+	printTitle("clear");
+
+	UNORDERED_MAP<std::string, std::string> m1;
+	for (int i = 0; i < 300; i++)
+		m1[std::string(1 + i % 7, static_cast<char>('a' + i % 26))] = "x";
+	printSize(m1);
+	m1.clear();
+	printSize(m1);
+	m1["after"] = "clear";
+	printContent(m1);
+}
+
+/**
+ * @brief find test
+ */
+
+void	findTest(void) {
+	printTitle("find");
+
+	UNORDERED_MAP<int, int> m1;
+	for (int i = 0; i < 2000; i += 2)
+		m1[i] = -i;
+	const UNORDERED_MAP<int, int> & cm1 = m1;
+
+	int found = 0;
+	for (int i = -5; i < 2005; i++) {
+		if (m1.find(i) != m1.end() && cm1.find(i)->second == -i)
+			++found;
+	}
+	std::cout << "found: " << found << std::endl;
+	std::cout << "find(1998): " << m1.find(1998)->second << std::endl;
+	std::cout << "find(1999) == end: " << (m1.find(1999) == m1.end()) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief count test
+ */
+
+void	countTest(void) {
+	printTitle("count");
+
+	UNORDERED_MAP<std::string, int> m1;
+	m1["a"] = 1;
+	m1["b"] = 2;
+	m1["cc"] = 3;
+	std::cout << "count(a): " << m1.count("a") << ", count(c): " << m1.count("c") << ", count(cc): " << m1.count("cc") << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief equal_range test
+ */
+
+void	equalRangeTest(void) {
+	printTitle("equal_range");
+
+	UNORDERED_MAP<int, int> m1;
+	for (int i = 1; i <= 10; i++)
+		m1[i * 10] = i;
+
+	__NS__::pair<UNORDERED_MAP<int, int>::iterator, UNORDERED_MAP<int, int>::iterator> ret = m1.equal_range(30);
+	std::cout << "equal_range(30): " << ret.first->first << ", one element: " << (++ret.first == ret.second) << std::endl;
+	ret = m1.equal_range(35);
+	std::cout << "equal_range(35) empty: " << (ret.first == ret.second) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief hash policy test (ft only, std keeps its content)
+ */
+
+void	hashPolicyTest(void) {
+	printTitle("hash policy");
+
+	UNORDERED_MAP<int, int> m1;
+	for (int i = 0; i < 3000; i++)
+		m1[i * 31] = i;
+	std::cout << "load below max: " << loadIsBelowMax(m1) << std::endl;
+
+	std::cout << "rehash(10000), rehash(0):\n";
+	rehash(m1, 10000);
+	printDigest(m1);
+	rehash(m1, 0);
+	printDigest(m1);
+
+	std::cout << "max_load_factor(0.25), then 0.875 and 1 (clamped):\n";
+	setMaxLoadFactor(m1, 0.25f);
+	std::cout << "load below max: " << loadIsBelowMax(m1) << std::endl;
+	setMaxLoadFactor(m1, 0.875f);
+	setMaxLoadFactor(m1, 1.0f);
+	std::cout << "load below max: " << loadIsBelowMax(m1) << std::endl;
+	printDigest(m1);
+
+	std::cout << "reserve(50000), insert 40000 keys:\n";
+	UNORDERED_MAP<int, int> m2;
+	reserve(m2, 50000);
+	for (int i = 0; i < 40000; i++)
+		m2[i] = i;
+	printDigest(m2);
+	std::cout << "load below max: " << loadIsBelowMax(m2) << std::endl;
+	std::cout << "find(39999): " << m2.find(39999)->second << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief main
+ */
+
+int main(int ac, char **av) {
+	if (ac == 1) {
+		printTitle("Args help");
+
+		std::cout << "- \033[1;36mall\033[0m: launch all test\n"
+			<< "- \033[1;36mconstructTest\033[0m: launch about constructor test\n"
+			<< "- \033[1;36miteratorTest\033[0m: launch about iterator test\n"
+			<< "- \033[1;36memptyTest\033[0m: launch about empty test\n"
+			<< "- \033[1;36msizeTest\033[0m: launch about size/max_size test\n"
+			<< "- \033[1;36melementAccessTest\033[0m: launch about element access test\n"
+			<< "- \033[1;36minsertTest\033[0m: launch about insert test\n"
+			<< "- \033[1;36meraseTest\033[0m: launch about erase test\n"
+			<< "- \033[1;36mswapTest\033[0m: launch about swap test\n"
+			<< "- \033[1;36mclearTest\033[0m: launch about clear test\n"
+			<< "- \033[1;36mfindTest\033[0m: launch about find test\n"
+			<< "- \033[1;36mcountTest\033[0m: launch about count test\n"
+			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n"
+			<< "- \033[1;36mhashPolicyTest\033[0m: launch about rehash/reserve/max_load_factor test\n";
+		return 0;
+	}
+
+	Test test[] = {
+		{"constructTest", &constructTest},
+		{"iteratorTest", &iteratorTest},
+		{"emptyTest", &emptyTest},
+		{"sizeTest", &sizeTest},
+		{"elementAccessTest", &elementAccessTest},
+		{"insertTest", &insertTest},
+		{"eraseTest", &eraseTest},
+		{"swapTest", &swapTest},
+		{"clearTest", &clearTest},
+		{"findTest", &findTest},
+		{"countTest", &countTest},
+		{"equalRangeTest", &equalRangeTest},
+		{"hashPolicyTest", &hashPolicyTest}};
+
+	if (std::string(av[1]) == "all") {
+		for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++)
+			test[i].fptr();
+		return 0;
+	}
+
+	std::string arg(av[1]);
+	for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++) {
+		if (test[i].testName == arg) {
+			test[i].fptr();
+			return 0;
+		}
+	}
+	return 1;
+}
\ No newline at end of file
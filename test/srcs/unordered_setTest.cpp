@@ -0,0 +1,473 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_setTest.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kaye <kaye@student.42.fr>                  +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2021/10/17 19:40:18 by kaye              #+#    #+#             */
+/*   Updated: 2021/10/17 19:40:18 by kaye             ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Custom.hpp"
+#include "Extension.hpp"
+#include "Tester.hpp"
+#include "unordered_set.hpp"
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+// #define __NS__ std // default namespace
+
+/**
+ * @note std of C++98 has no unordered_set: ft::unordered_set is diffed against std::set,
+ * the elements are sorted before being printed. the hash policy only exists for ft.
+ */
+#ifdef __STD__
+# define UNORDERED_SET std::set
+
+template < class Set >
+void	rehash(Set &, std::size_t) {}
+
+template < class Set >
+void	reserve(Set &, std::size_t) {}
+
+template < class Set >
+void	setMaxLoadFactor(Set &, float) {}
+
+template < class Set >
+bool	loadIsBelowMax(Set const &) { return true; }
+
+#else
+# define UNORDERED_SET ft::unordered_set
+
+template < class Set >
+void	rehash(Set & s, std::size_t n) { s.rehash(n); }
+
+template < class Set >
+void	reserve(Set & s, std::size_t n) { s.reserve(n); }
+
+template < class Set >
+void	setMaxLoadFactor(Set & s, float z) { s.max_load_factor(z); }
+
+template < class Set >
+bool	loadIsBelowMax(Set const & s) { return s.load_factor() <= s.max_load_factor(); }
+
+#endif
+
+/**
+ * @brief utils
+ */
+
+/** @brief the elements in key order, and how many the iterators went through */
+template < class Set >
+void	printContent(Set const & s) {
+	std::vector<typename Set::value_type> v;
+
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+		v.push_back(*it);
+	std::sort(v.begin(), v.end());
+	for (std::size_t i = 0; i < v.size(); i++)
+		std::cout << v[i] << std::endl;
+	std::cout << "iterated: " << v.size() << std::endl;
+	printSize(s);
+}
+
+/** @brief size and sum of the values (order free): enough to diff big sets */
+template < class Set >
+void	printDigest(Set const & s) {
+	long			values = 0;
+	std::size_t		n = 0;
+
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it, ++n)
+		values += *it;
+	std::cout << "size: " << s.size() << ", iterated: " << n << ", values: " << values << std::endl;
+}
+
+/**
+ * @brief constructor test
+ */
+
+void	constructTest(void) {
+	printTitle("Constructor");
+
+	std::cout << "basic construct: + 10 20 30 40:\n";
+	UNORDERED_SET<int> s1;
+	s1.insert(10);
+	s1.insert(20);
+	s1.insert(30);
+	s1.insert(40);
+	printContent(s1);
+
+	std::cout << "range: vector of 1000 values, with duplicates:\n";
+	std::vector<int>	v;
+	unsigned long		seed = 42;
+	for (int i = 0; i < 1000; i++)
+		v.push_back(nextRand(seed) % 700);
+	UNORDERED_SET<int> s2(v.begin(), v.end());
+	printDigest(s2);
+
+	std::cout << "copy: s3(s2):\n";
+	UNORDERED_SET<int> s3(s2);
+	printDigest(s3);
+	std::cout << "s3 == s2: " << (s3 == s2) << std::endl;
+
+	std::cout << "assign: s4 = s2, then clear s2:\n";
+	UNORDERED_SET<int> s4;
+	s4.insert(1);
+	s4 = s2;
+	s2.clear();
+	printDigest(s4);
+	printDigest(s2);
+	std::cout << "s4 != s2: " << (s4 != s2) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief iterator test
+ */
+
+void	iteratorTest(void) {
+	printTitle("Iterator");
+
+	UNORDERED_SET<int> s1;
+	std::cout << "+ i * 7 % 500 for i in [0, 500):\n";
+	for (int i = 0; i < 500; i++)
+		s1.insert(i * 7 % 500);
+	printDigest(s1);
+
+	std::cout << "const_iterator from iterator: ";
+	UNORDERED_SET<int>::const_iterator cit = s1.begin();
+	std::cout << (cit == s1.begin() ? "equal" : "different") << std::endl;
+
+	std::cout << "post increment:\n";
+	UNORDERED_SET<int>::iterator it = s1.begin();
+	UNORDERED_SET<int>::iterator prev = it++;
+	std::cout << "prev != it: " << (prev != it) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief empty test
+ */
+
+void	emptyTest(void) {
+	printTitle("Empty");
+
+	UNORDERED_SET<std::string> s1;
+	std::cout << (s1.empty() == true ? "s1 is empty" : "s1 is not empty") << std::endl;
+	std::cout << "begin == end: " << (s1.begin() == s1.end()) << std::endl;
+	s1.insert("one");
+	std::cout << (s1.empty() == true ? "s1 is empty" : "s1 is not empty") << std::endl;
+	s1.erase("one");
+	std::cout << (s1.empty() == true ? "s1 is empty" : "s1 is not empty") << std::endl;
+	std::cout << "begin == end: " << (s1.begin() == s1.end()) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief size test
+ */
+
+void	sizeTest(void) {
+	printTitle("Size");
+
+	UNORDERED_SET<int> s1;
+	printSize(s1);
+
+	std::cout << "+ 10000 values:\n";
+	for (int i = 0; i < 10000; i++)
+		s1.insert(i);
+	printSize(s1);
+
+	std::cout << "- every value but multiples of 100:\n";
+	for (int i = 0; i < 10000; i++) {
+		if (i % 100 != 0)
+			s1.erase(i);
+	}
+	printSize(s1);
+	printDigest(s1);
+}
+
+/**
+ * @brief insert test
+ */
+
+void	insertTest(void) {
+	printTitle("insert");
+
+	UNORDERED_SET<std::string> s1;
+	std::cout << "insert two, one, two:\n";
+	__NS__::pair<UNORDERED_SET<std::string>::iterator, bool> ret;
+	ret = s1.insert("two");
+	std::cout << *ret.first << " " << ret.second << std::endl;
+	ret = s1.insert("one");
+	std::cout << *ret.first << " " << ret.second << std::endl;
+	ret = s1.insert("two");
+	std::cout << *ret.first << " " << ret.second << std::endl;
+
+	std::cout << "hint insert (the hint is ignored by ft): three, then one (present):\n";
+	UNORDERED_SET<std::string>::iterator it;
+	it = s1.insert(s1.begin(), "three");
+	std::cout << *it << std::endl;
+	it = s1.insert(s1.end(), "one");
+	std::cout << *it << std::endl;
+	printContent(s1);
+
+	std::cout << "20000 random insertions:\n";
+	UNORDERED_SET<int>	s2;
+	unsigned long		seed = 7;
+	int					inserted = 0;
+	for (int i = 0; i < 20000; i++)
+		inserted += s2.insert(nextRand(seed)).second;
+	std::cout << "inserted: " << inserted << std::endl;
+	printDigest(s2);
+
+	std::cout << "insert range of s2 into s3:\n";
+	UNORDERED_SET<int> s3;
+	s3.insert(500000);
+	s3.insert(s2.begin(), s2.end());
+	printDigest(s3);
+}
+
+/**
+ * @brief erase test
+ */
+
+void	eraseTest(void) {
+	printTitle("erase");
+
+	UNORDERED_SET<int> s1;
+	for (int i = 0; i < 5000; i++)
+		s1.insert(i);
+
+	std::cout << "erase(value) of 10 present and 1 absent value: ";
+	std::size_t n = 0;
+	for (int i = 0; i < 5500; i += 500)
+		n += s1.erase(i);
+	std::cout << n << std::endl;
+	printDigest(s1);
+
+	std::cout << "erase(iterator) of the odd values:\n";
+	UNORDERED_SET<int>::iterator it = s1.begin();
+	while (it != s1.end()) {
+		if (*it % 2 == 1)
+			it = extEraseAt(s1, it);
+		else
+			++it;
+	}
+	printDigest(s1);
+
+	std::cout << "erase of the random values of a big set, one by one (tombstones):\n";
+	UNORDERED_SET<int>	s2;
+	unsigned long		seed = 3;
+	for (int i = 0; i < 20000; i++)
+		s2.insert(nextRand(seed));
+	printDigest(s2);
+	seed = 3;
+	n = 0;
+	for (int i = 0; i < 15000; i++)
+		n += s2.erase(nextRand(seed));
+	std::cout << "erased: " << n << std::endl;
+	printDigest(s2);
+	std::cout << "insert them back:\n";
+	seed = 3;
+	for (int i = 0; i < 15000; i++)
+		s2.insert(nextRand(seed));
+	printDigest(s2);
+
+	std::cout << "erase(begin(), end()):\n";
+	s2.erase(s2.begin(), s2.end());
+	printDigest(s2);
+	s2.insert(1);
+	printDigest(s2);
+}
+
+/**
+ * @brief swap test
+ */
+
+void	swapTest(void) {
+	printTitle("swap");
+
+	UNORDERED_SET<int> s1;
+	UNORDERED_SET<int> s2;
+	for (int i = 0; i < 1000; i++)
+		s1.insert(i);
+	s2.insert(-1);
+
+	UNORDERED_SET<int>::iterator it = s1.find(500);
+	std::cout << "swap, iterators follow their elements:\n";
+	s1.swap(s2);
+	printDigest(s1);
+	printDigest(s2);
+	std::cout << "it still in s2: " << (it == s2.find(500)) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief clear test
+ */
+
+void	clearTest(void) {
+	printTitle("clear");
+
+	UNORDERED_SET<std::string> s1;
+	for (int i = 0; i < 300; i++)
+		s1.insert(std::string(1 + i % 7, static_cast<char>('a' + i % 26)));
+	printSize(s1);
+	s1.clear();
+	printSize(s1);
+	s1.insert("after");
+	printContent(s1);
+}
+
+/**
+ * @brief find test
+ */
+
+void	findTest(void) {
+	printTitle("find");
+
+	UNORDERED_SET<int> s1;
+	for (int i = 0; i < 2000; i += 2)
+		s1.insert(i);
+	const UNORDERED_SET<int> & cs1 = s1;
+
+	int found = 0;
+	for (int i = -5; i < 2005; i++) {
+		if (s1.find(i) != s1.end() && *cs1.find(i) == i)
+			++found;
+	}
+	std::cout << "found: " << found << std::endl;
+	std::cout << "find(1998): " << *s1.find(1998) << std::endl;
+	std::cout << "find(1999) == end: " << (s1.find(1999) == s1.end()) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief count test
+ */
+
+void	countTest(void) {
+	printTitle("count");
+
+	UNORDERED_SET<std::string> s1;
+	s1.insert("a");
+	s1.insert("b");
+	s1.insert("cc");
+	std::cout << "count(a): " << s1.count("a") << ", count(c): " << s1.count("c") << ", count(cc): " << s1.count("cc") << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief equal_range test
+ */
+
+void	equalRangeTest(void) {
+	printTitle("equal_range");
+
+	UNORDERED_SET<int> s1;
+	for (int i = 1; i <= 10; i++)
+		s1.insert(i * 10);
+
+	__NS__::pair<UNORDERED_SET<int>::iterator, UNORDERED_SET<int>::iterator> ret = s1.equal_range(30);
+	std::cout << "equal_range(30): " << *ret.first << ", one element: " << (++ret.first == ret.second) << std::endl;
+	ret = s1.equal_range(35);
+	std::cout << "equal_range(35) empty: " << (ret.first == ret.second) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief hash policy test (ft only, std keeps its content)
+ */
+
+void	hashPolicyTest(void) {
+	printTitle("hash policy");
+
+	UNORDERED_SET<int> s1;
+	for (int i = 0; i < 3000; i++)
+		s1.insert(i * 31);
+	std::cout << "load below max: " << loadIsBelowMax(s1) << std::endl;
+
+	std::cout << "rehash(10000), rehash(0):\n";
+	rehash(s1, 10000);
+	printDigest(s1);
+	rehash(s1, 0);
+	printDigest(s1);
+
+	std::cout << "max_load_factor(0.25), then 0.875 and 1 (clamped):\n";
+	setMaxLoadFactor(s1, 0.25f);
+	std::cout << "load below max: " << loadIsBelowMax(s1) << std::endl;
+	setMaxLoadFactor(s1, 0.875f);
+	setMaxLoadFactor(s1, 1.0f);
+	std::cout << "load below max: " << loadIsBelowMax(s1) << std::endl;
+	printDigest(s1);
+
+	std::cout << "reserve(50000), insert 40000 values:\n";
+	UNORDERED_SET<int> s2;
+	reserve(s2, 50000);
+	for (int i = 0; i < 40000; i++)
+		s2.insert(i);
+	printDigest(s2);
+	std::cout << "load below max: " << loadIsBelowMax(s2) << std::endl;
+	std::cout << "find(39999): " << *s2.find(39999) << std::endl;
+	std::cout << std::endl;
+}
+
+/**
+ * @brief main
+ */
+
+int main(int ac, char **av) {
+	if (ac == 1) {
+		printTitle("Args help");
+
+		std::cout << "- \033[1;36mall\033[0m: launch all test\n"
+			<< "- \033[1;36mconstructTest\033[0m: launch about constructor test\n"
+			<< "- \033[1;36miteratorTest\033[0m: launch about iterator test\n"
+			<< "- \033[1;36memptyTest\033[0m: launch about empty test\n"
+			<< "- \033[1;36msizeTest\033[0m: launch about size/max_size test\n"
+			<< "- \033[1;36minsertTest\033[0m: launch about insert test\n"
+			<< "- \033[1;36meraseTest\033[0m: launch about erase test\n"
+			<< "- \033[1;36mswapTest\033[0m: launch about swap test\n"
+			<< "- \033[1;36mclearTest\033[0m: launch about clear test\n"
+			<< "- \033[1;36mfindTest\033[0m: launch about find test\n"
+			<< "- \033[1;36mcountTest\033[0m: launch about count test\n"
+			<< "- \033[1;36mequalRangeTest\033[0m: launch about equalRange test\n"
+			<< "- \033[1;36mhashPolicyTest\033[0m: launch about rehash/reserve/max_load_factor test\n";
+		return 0;
+	}
+
+	Test test[] = {
+		{"constructTest", &constructTest},
+		{"iteratorTest", &iteratorTest},
+		{"emptyTest", &emptyTest},
+		{"sizeTest", &sizeTest},
+		{"insertTest", &insertTest},
+		{"eraseTest", &eraseTest},
+		{"swapTest", &swapTest},
+		{"clearTest", &clearTest},
+		{"findTest", &findTest},
+		{"countTest", &countTest},
+		{"equalRangeTest", &equalRangeTest},
+		{"hashPolicyTest", &hashPolicyTest}};
+
+	if (std::string(av[1]) == "all") {
+		for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++)
+			test[i].fptr();
+		return 0;
+	}
+
+	std::string arg(av[1]);
+	for (size_t i = 0; i < sizeof(test) / sizeof(*test); i++) {
+		if (test[i].testName == arg) {
+			test[i].fptr();
+			return 0;
+		}
+	}
+	return 1;
+}
\ No newline at end of file
@@ -23,7 +23,7 @@ FLAGS=-Wall -Wextra -Werror -std=c++98
 
 ## Var: tester utils
 
-containers=('vector' 'stack' 'map' 'set')
+containers=('vector' 'stack' 'map' 'set' 'btree_map' 'btree_set' 'flat_map' 'flat_set' 'unordered_map' 'unordered_set')
 folders=('deepthought' 'log')
 namespace=('std' 'ft')
 
@@ -47,7 +47,7 @@ printUsage() {
 echo -e "usage: ./test.sh [${GREEN}agrs${NONE}]
 args:	${GREEN}all${NONE}: launch all test
 	${GREEN}clean${NONE}: clear deepthought/log directory and file
-	${GREEN}containers${NONE}: vector/stack/map/set (diff + log)
+	${GREEN}containers${NONE}: vector/stack/map/set/btree_map/btree_set/flat_map/flat_set/unordered_map/unordered_set (diff + log)
 Tips: ${PURPLE}Changer the path in test.sh with 'CONTAINERS_FOLDER'${NONE}
 Tips2: ${PURPLE}You can use the execute std/ft{containersNames} (after tester launch) to compare one by one${NONE}"
 }
@@ -92,7 +92,7 @@ cleanAll
 printHeader
 
 if [ $# -eq 1 ] && [ $1 = 'all' ] ; then
-	containersArray=('vector' 'stack' 'map' 'set')
+	containersArray=('vector' 'stack' 'map' 'set' 'btree_map' 'btree_set' 'flat_map' 'flat_set' 'unordered_map' 'unordered_set')
 
 else
 	if [ $# -lt 1 ] ; then
@@ -111,7 +111,7 @@ if [ $# -eq 1 ] && [ $1 = 'clean' ] ; then
 	exit
 fi
 
-functionArray=('constructTest' 'iteratorTest' 'emptyTest' 'sizeTest' 'resizeTest' 'elementAccessTest' 'assignTest' 'pbTest' 'insertTest' 'eraseTest' 'swapTest' 'clearTest' 'keyCompTest' 'valueCompTest' 'findTest' 'countTest' 'boundTest' 'equalRangeTest')
+functionArray=('constructTest' 'iteratorTest' 'emptyTest' 'sizeTest' 'resizeTest' 'elementAccessTest' 'assignTest' 'pbTest' 'insertTest' 'eraseTest' 'swapTest' 'clearTest' 'keyCompTest' 'valueCompTest' 'findTest' 'countTest' 'boundTest' 'equalRangeTest' 'hintInsertTest' 'sortedRangeTest' 'transparentTest' 'setOpsTest' 'orderStatTest' 'aggregateTest' 'intervalMapTest' 'policyTest' 'hashPolicyTest' 'indexAllocTest' 'nodeHandleTest' 'splayTest')
 
 for CONT in ${containersArray[@]}
 do